@@ -98,7 +98,7 @@ _aff3ct() {
 	if [[ ${codetype} == "POLAR"      && ${simutype} == "GEN" ]]
 	then
 		opts="$opts --enc-fb-awgn-path --enc-fb-gen-method --dec-snr \
-		      --dec-gen-path --sim-pb-path"
+		      --dec-gen-path"
 	fi
 
 	# add contents of Launcher_BFER_RA.cpp
@@ -125,7 +125,7 @@ _aff3ct() {
 	if [[ ${codetype} == "POLAR"      && ${simutype} == "BFER" || \
 	      ${codetype} == "POLAR"      && ${simutype} == "BFERI" ]]
 	then
-		opts="$opts --sim-pb-path --enc-fb-awgn-path --enc-fb-gen-method \
+		opts="$opts --enc-fb-awgn-path --enc-fb-gen-method \
 		      --enc-fb-sigma --dec-type -D --dec-ite -i --dec-implem"
 	fi
 
@@ -134,7 +134,8 @@ _aff3ct() {
 	then
 		opts="$opts --crc-type --crc-poly --crc-rate --enc-no-sys \
 		      --dec-lists -L --dec-simd --dec-polar-nodes         \
-		      --dec-partial-adaptive"
+		      --dec-partial-adaptive --dec-jit-path --dec-jit-cxx \
+		      --dec-jit-flags"
 	fi
 
 	# add contents of Launcher_BFER_repetition.cpp
@@ -163,7 +164,7 @@ _aff3ct() {
 	# add contents of Launcher_EXIT_polar.cpp
 	if [[ ${codetype} == "POLAR"      && ${simutype} == "EXIT" ]]
 	then
-		opts="$opts --sim-pb-path --enc-fb-sigma --enc-fb-awgn-path        \
+		opts="$opts --enc-fb-sigma --enc-fb-awgn-path \
 		      --enc-fb-gen-method --dec-type -D --dec-implem  --dec-ite -i \
 		      --dec-lists -L"
 	fi
@@ -209,7 +210,8 @@ _aff3ct() {
 		-L | --enc-json-path | --dec-off | --dec-norm | --ter-freq |           \
 		--sim-seed | --sim-mpi-comm | --sim-pyber | --dec-polar-nodes |        \
 		--itl-cols | --dec-synd-depth | --pct-pattern |                        \
-		--dec-fnc-q | --dec-fnc-ite-m | --dec-fnc-ite-M | --dec-fnc-ite-s      )
+		--dec-fnc-q | --dec-fnc-ite-m | --dec-fnc-ite-M | --dec-fnc-ite-s |    \
+		--dec-jit-cxx | --dec-jit-flags                                        )
 			COMPREPLY=()
 			;;
 
@@ -264,7 +266,7 @@ _aff3ct() {
 				RA)    params="AZCW COSET USER RA"                     ;;
 				BCH)   params="AZCW COSET USER BCH"                    ;;
 				TURBO) params="AZCW COSET USER TURBO"                  ;;
-				LDPC)  params="AZCW COSET USER LDPC LDPC_H LDPC_DVBS2" ;;
+				LDPC)  params="AZCW COSET USER LDPC LDPC_H LDPC_DVBS2 LDPC_QC LDPC_QC_DD" ;;
 			esac
 			COMPREPLY=( $(compgen -W "${params}" -- ${cur}) )
 			;;
@@ -284,7 +286,7 @@ _aff3ct() {
 			;;
 
 		--dec-implem)
-			local params="NAIVE GENERIC STD FAST VERY_FAST"
+			local params="NAIVE GENERIC STD FAST VERY_FAST JIT"
 			if [ "${codetype}" == 'LDPC' ]; then
 				params="ONMS SPA LSPA GALA"
 			fi
@@ -296,9 +298,9 @@ _aff3ct() {
 			COMPREPLY=( $(compgen -W "${params}" -- ${cur}) )
 			;;
 
-		--enc-fb-awgn-path | --dec-gen-path | --sim-pb-path | --itl-path | \
+		--enc-fb-awgn-path | --dec-gen-path | --itl-path | \
 		--mdm-const-path | --src-path | --enc-path | --chn-path |          \
-		--dec-h-path | --sim-err-trk-path)
+		--dec-h-path | --sim-err-trk-path | --dec-jit-path)
 			_filedir
 			;;
 
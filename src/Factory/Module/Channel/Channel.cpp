@@ -8,6 +8,8 @@
 
 #include "Tools/Algo/Gaussian_noise_generator/Standard/Gaussian_noise_generator_std.hpp"
 #include "Tools/Algo/Gaussian_noise_generator/Fast/Gaussian_noise_generator_fast.hpp"
+#include "Tools/Algo/Gaussian_noise_generator/Threefry/Gaussian_noise_generator_threefry.hpp"
+#include "Tools/Algo/Gaussian_noise_generator/Ziggurat/Gaussian_noise_generator_ziggurat.hpp"
 #ifdef CHANNEL_MKL
 #include "Tools/Algo/Gaussian_noise_generator/MKL/Gaussian_noise_generator_MKL.hpp"
 #endif
@@ -58,7 +60,7 @@ void Channel::parameters
 		 "type of the channel to use in the simulation.",
 		 "NO, USER, AWGN, RAYLEIGH, RAYLEIGH_USER"};
 
-	std::string implem_avail = "STD, FAST";
+	std::string implem_avail = "STD, FAST, THREEFRY, ZIGGURAT";
 #ifdef CHANNEL_GSL
 	implem_avail += ", GSL";
 #endif
@@ -154,13 +156,15 @@ module::Channel<R>* Channel::parameters
 ::build() const
 {
 	tools::Gaussian_noise_generator<R>* n = nullptr;
-	     if (implem == "STD" ) n = new tools::Gaussian_noise_generator_std <R>(seed);
-	else if (implem == "FAST") n = new tools::Gaussian_noise_generator_fast<R>(seed);
+	     if (implem == "STD"     ) n = new tools::Gaussian_noise_generator_std     <R>(seed);
+	else if (implem == "FAST"    ) n = new tools::Gaussian_noise_generator_fast    <R>(seed);
+	else if (implem == "THREEFRY") n = new tools::Gaussian_noise_generator_threefry<R>(seed, stream_id, n_streams);
+	else if (implem == "ZIGGURAT") n = new tools::Gaussian_noise_generator_ziggurat<R>(seed);
 #ifdef CHANNEL_MKL
-	else if (implem == "MKL" ) n = new tools::Gaussian_noise_generator_MKL <R>(seed);
+	else if (implem == "MKL"     ) n = new tools::Gaussian_noise_generator_MKL     <R>(seed);
 #endif
 #ifdef CHANNEL_GSL
-	else if (implem == "GSL" ) n = new tools::Gaussian_noise_generator_GSL <R>(seed);
+	else if (implem == "GSL"     ) n = new tools::Gaussian_noise_generator_GSL     <R>(seed);
 #endif
 	else
 		throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
@@ -171,7 +175,7 @@ module::Channel<R>* Channel::parameters
 	else
 	{
 		module::Channel<R>* c = nullptr;
-		     if (type == "USER") c = new module::Channel_user<R>(N, path, add_users, n_frames);
+		     if (type == "USER") c = new module::Channel_user<R>(N, path, add_users, n_frames, stream_id, n_streams);
 		else if (type == "NO"  ) c = new module::Channel_NO  <R>(N,       add_users, n_frames);
 
 		delete n;
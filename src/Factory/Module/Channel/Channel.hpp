@@ -34,6 +34,10 @@ struct Channel : public Factory
 		int         gain_occur   = 1;
 		float       sigma        = -1.f;
 
+		// the frames read from the file (USER) or the noise blocks (THREEFRY) of a thread among 'n_streams'
+		int         stream_id    = 0;
+		int         n_streams    = 1;
+
 		// ---------------------------------------------------------------------------------------------------- METHODS
 		explicit parameters(const std::string &p = Channel_prefix);
 		virtual ~parameters();
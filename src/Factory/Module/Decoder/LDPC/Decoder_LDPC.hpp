@@ -2,8 +2,10 @@
 #define FACTORY_DECODER_LDPC_HPP
 
 #include <string>
+#include <memory>
 
 #include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
+#include "Tools/Code/LDPC/BP_flooding/LDPC_BP_flooding_tables.hpp"
 
 #include "Module/Decoder/Decoder_SIHO.hpp"
 #include "Module/Decoder/Decoder_SISO_SIHO.hpp"
@@ -33,7 +35,9 @@ struct Decoder_LDPC : public Decoder
 		float       norm_factor     = 1.f;
 		float       offset          = 0.f;
 		bool        enable_syndrome = true;
+		bool        compress_msg    = false;
 		int         syndrome_depth  = 2;
+		int         stable_depth    = 0;
 		int         n_ite           = 10;
 
 		// ---------------------------------------------------------------------------------------------------- METHODS
@@ -50,24 +54,28 @@ struct Decoder_LDPC : public Decoder
 		template <typename B = int, typename Q = float>
 		module::Decoder_SIHO<B,Q>* build(const tools::Sparse_matrix &H,
 		                                 const std::vector<unsigned> &info_bits_pos,
-		                                 module::Encoder<B> *encoder = nullptr) const;
+		                                 module::Encoder<B> *encoder = nullptr,
+		                                 std::shared_ptr<const tools::LDPC_BP_flooding_tables> flooding_tables = nullptr) const;
 
 		template <typename B = int, typename Q = float>
 		module::Decoder_SISO_SIHO<B,Q>* build_siso(const tools::Sparse_matrix &H,
 		                                           const std::vector<unsigned> &info_bits_pos,
-		                                           module::Encoder<B> *encoder = nullptr) const;
+		                                           module::Encoder<B> *encoder = nullptr,
+		                                           std::shared_ptr<const tools::LDPC_BP_flooding_tables> flooding_tables = nullptr) const;
 	};
 
 	template <typename B = int, typename Q = float>
 	static module::Decoder_SIHO<B,Q>* build(const parameters& params, const tools::Sparse_matrix &H,
 	                                        const std::vector<unsigned> &info_bits_pos, 
-	                                        module::Encoder<B> *encoder = nullptr);
+	                                        module::Encoder<B> *encoder = nullptr,
+	                                        std::shared_ptr<const tools::LDPC_BP_flooding_tables> flooding_tables = nullptr);
 
 	template <typename B = int, typename Q = float>
 	static module::Decoder_SISO_SIHO<B,Q>* build_siso(const parameters& params, 
 	                                                  const tools::Sparse_matrix &H,
 	                                                  const std::vector<unsigned> &info_bits_pos, 
-	                                                  module::Encoder<B> *encoder = nullptr);
+	                                                  module::Encoder<B> *encoder = nullptr,
+	                                                  std::shared_ptr<const tools::LDPC_BP_flooding_tables> flooding_tables = nullptr);
 };
 }
 }
@@ -3,18 +3,22 @@
 #include "Module/Decoder/Polar/SC/Decoder_polar_SC_naive.hpp"
 #include "Module/Decoder/Polar/SC/Decoder_polar_SC_naive_sys.hpp"
 #include "Module/Decoder/Polar/SC/Decoder_polar_SC_fast_sys.hpp"
+#include "Module/Decoder/Polar/SC/Decoder_polar_SC_fast_sys_JIT.hpp"
 #include "Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_naive.hpp"
 #include "Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_naive_sys.hpp"
 #include "Module/Decoder/Polar/SCL/Decoder_polar_SCL_naive.hpp"
 #include "Module/Decoder/Polar/SCL/Decoder_polar_SCL_naive_sys.hpp"
 #include "Module/Decoder/Polar/SCL/Decoder_polar_SCL_fast_sys.hpp"
 #include "Module/Decoder/Polar/SCL/Decoder_polar_SCL_MEM_fast_sys.hpp"
+#include "Module/Decoder/Polar/SCL/Decoder_polar_SCL_inter_sys.hpp"
 #include "Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_naive_CA.hpp"
 #include "Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_naive_CA_sys.hpp"
 #include "Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_fast_CA_sys.hpp"
 #include "Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_MEM_fast_CA_sys.hpp"
+#include "Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_inter_CA_sys.hpp"
 #include "Module/Decoder/Polar/ASCL/Decoder_polar_ASCL_fast_CA_sys.hpp"
 #include "Module/Decoder/Polar/ASCL/Decoder_polar_ASCL_MEM_fast_CA_sys.hpp"
+#include "Module/Decoder/Polar/ASCL/Decoder_polar_ASCL_inter_CA_sys.hpp"
 
 //#define API_POLAR_DYNAMIC 1
 
@@ -103,6 +107,19 @@ void Decoder_polar::parameters
 	opt_args[{p+"-no-sys"}] =
 		{"",
 		 "does not suppose a systematic encoding."};
+
+	opt_args[{p+"-jit-path"}] =
+		{"string",
+		 "directory of the SC decoders compiled at runtime (with the \"JIT\" implementation)."};
+
+	opt_args[{p+"-jit-cxx"}] =
+		{"string",
+		 "compiler of the SC decoders compiled at runtime (with the \"JIT\" implementation)."};
+
+	opt_args[{p+"-jit-flags"}] =
+		{"string",
+		 "compilation flags of the SC decoders compiled at runtime (with the \"JIT\" implementation), they have to "
+		 "enable the same SIMD instructions than the flags of AFF3CT (by default the flags of AFF3CT are used)."};
 }
 
 void Decoder_polar::parameters
@@ -117,6 +134,9 @@ void Decoder_polar::parameters
 	if(exist(vals, {p+"-simd"            })) this->simd_strategy =           vals.at({p+"-simd"       });
 	if(exist(vals, {p+"-polar-nodes"     })) this->polar_nodes   =           vals.at({p+"-polar-nodes"});
 	if(exist(vals, {p+"-partial-adaptive"})) this->full_adaptive = false;
+	if(exist(vals, {p+"-jit-path"        })) this->jit_path      =           vals.at({p+"-jit-path"   });
+	if(exist(vals, {p+"-jit-cxx"         })) this->jit_cxx       =           vals.at({p+"-jit-cxx"    });
+	if(exist(vals, {p+"-jit-flags"       })) this->jit_flags     =           vals.at({p+"-jit-flags"  });
 
 	// force 1 iteration max if not SCAN (and polar code)
 	if (this->type != "SCAN") this->n_ite = 1;
@@ -151,8 +171,16 @@ void Decoder_polar::parameters
 		     this->type == "SCL"     ||
 		     this->type == "ASCL"    ||
 		     this->type == "SCL_MEM" ||
-		     this->type == "ASCL_MEM") && this->implem == "FAST")
+		     this->type == "ASCL_MEM") && (this->implem == "FAST" || this->implem == "JIT"))
 			headers[p].push_back(std::make_pair("Polar node types", this->polar_nodes));
+
+		if (this->type == "SC" && this->implem == "JIT")
+		{
+			headers[p].push_back(std::make_pair("JIT path",  this->jit_path ));
+			headers[p].push_back(std::make_pair("JIT flags", this->jit_flags.empty() ?
+			                                                 module::Decoder_polar_SC_fast_sys_JIT<>::default_flags() :
+			                                                 this->jit_flags));
+		}
 	}
 }
 
@@ -213,6 +241,13 @@ module::Decoder_SIHO<B,Q>* Decoder_polar::parameters
 				     if (this->type == "SC"  ) return new module::Decoder_polar_SC_fast_sys<B, Q, API_polar>(this->K, this->N_cw, frozen_bits, polar_patterns, idx_r0, idx_r1, this->n_frames);
 			}
 		}
+		else if (this->implem == "JIT")
+		{
+			if (crc == nullptr || crc->get_size() == 0)
+			{
+				     if (this->type == "SC"  ) return new module::Decoder_polar_SC_fast_sys_JIT<B, Q, API_polar>(this->K, this->N_cw, frozen_bits, polar_patterns, idx_r0, idx_r1, this->jit_path, this->jit_cxx, this->jit_flags, this->n_frames);
+			}
+		}
 	}
 
 	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
@@ -275,9 +310,21 @@ module::Decoder_SIHO<B,Q>* Decoder_polar::parameters
 			{
 				return _build_scl_fast<B,Q,tools::API_polar_dynamic_seq<B,Q>>(frozen_bits, crc, encoder);
 			}
+			else if (this->simd_strategy == "INTER" && this->type == "SCL" && this->systematic)
+			{
+				if (crc != nullptr && crc->get_size() > 0)
+					return new module::Decoder_polar_SCL_inter_CA_sys<B,Q>(this->K, this->N_cw, this->L, frozen_bits, *crc, this->n_frames);
+				else
+					return new module::Decoder_polar_SCL_inter_sys   <B,Q>(this->K, this->N_cw, this->L, frozen_bits,       this->n_frames);
+			}
+			else if (this->simd_strategy == "INTER" && this->type == "ASCL" && this->systematic && crc != nullptr &&
+			         crc->get_size() > 0)
+			{
+				return new module::Decoder_polar_ASCL_inter_CA_sys<B,Q>(this->K, this->N_cw, this->L, frozen_bits, *crc, this->full_adaptive, this->n_frames);
+			}
 		}
 
-		if (this->simd_strategy == "INTER" && this->type == "SC" && this->implem == "FAST")
+		if (this->simd_strategy == "INTER" && this->type == "SC" && (this->implem == "FAST" || this->implem == "JIT"))
 		{
 			if (typeid(B) == typeid(signed char))
 			{
@@ -306,7 +353,7 @@ module::Decoder_SIHO<B,Q>* Decoder_polar::parameters
 				return _build<B,Q,API_polar>(frozen_bits, crc, encoder);
 			}
 		}
-		else if (this->simd_strategy == "INTRA" && this->implem == "FAST")
+		else if (this->simd_strategy == "INTRA" && (this->implem == "FAST" || this->implem == "JIT"))
 		{
 			if (typeid(B) == typeid(signed char))
 			{
@@ -30,6 +30,9 @@ struct Decoder_polar : public Decoder
 		bool        full_adaptive = true;
 		int         n_ite         = 1;
 		int         L             = 8;
+		std::string jit_path      = "polar_jit";
+		std::string jit_cxx       = "c++";
+		std::string jit_flags     = ""; // empty: the compilation flags of AFF3CT
 
 		// ---------------------------------------------------------------------------------------------------- METHODS
 		explicit parameters(const std::string &p = Decoder_polar_prefix);
@@ -31,6 +31,10 @@ struct Encoder : public Factory
 		int         seed        = 0;
 		int         tail_length = 0;
 
+		// the frames read from the file (USER) of a thread among 'n_streams'
+		int         stream_id   = 0;
+		int         n_streams   = 1;
+
 		// deduced parameters
 		float       R           = -1.f;
 
@@ -3,6 +3,7 @@
 #include "Module/Encoder/LDPC/Encoder_LDPC.hpp"
 #include "Module/Encoder/LDPC/From_H/Encoder_LDPC_from_H.hpp"
 #include "Module/Encoder/LDPC/From_QC/Encoder_LDPC_from_QC.hpp"
+#include "Module/Encoder/LDPC/From_QC/Encoder_LDPC_from_QC_dual_diagonal.hpp"
 #include "Module/Encoder/LDPC/DVBS2/Encoder_LDPC_DVBS2.hpp"
 
 #include "Encoder_LDPC.hpp"
@@ -38,7 +39,7 @@ void Encoder_LDPC::parameters
 
 	auto p = this->get_prefix();
 
-	opt_args[{p+"-type"}][2] += ", LDPC, LDPC_H, LDPC_DVBS2, LDPC_QC";
+	opt_args[{p+"-type"}][2] += ", LDPC, LDPC_H, LDPC_DVBS2, LDPC_QC, LDPC_QC_DD";
 
 	opt_args[{p+"-h-path"}] =
 		{"string",
@@ -53,6 +54,11 @@ void Encoder_LDPC::parameters
 		 "specify if the check nodes (CNs) from H have to be reordered, 'NONE': do nothing (default), 'ASC': from the "
 		 "smallest to the biggest CNs, 'DSC': from the biggest to the smallest CNs.",
 		 "NONE, ASC, DSC"};
+
+	opt_args[{p+"-cache-path"}] =
+		{"string",
+		 "path to an existing directory where the matrices computed from H (G for the \"LDPC_H\" encoder, inverse of "
+		 "H2 for the \"LDPC_QC\" encoder) are stored to be reused by the next runs."};
 }
 
 void Encoder_LDPC::parameters
@@ -62,9 +68,10 @@ void Encoder_LDPC::parameters
 
 	auto p = this->get_prefix();
 
-	if(exist(vals, {p+"-h-path"   })) this->H_path    = vals.at({p+"-h-path"   });
-	if(exist(vals, {p+"-g-path"   })) this->G_path    = vals.at({p+"-g-path"   });
-	if(exist(vals, {p+"-h-reorder"})) this->H_reorder = vals.at({p+"-h-reorder"});
+	if(exist(vals, {p+"-h-path"    })) this->H_path     = vals.at({p+"-h-path"    });
+	if(exist(vals, {p+"-g-path"    })) this->G_path     = vals.at({p+"-g-path"    });
+	if(exist(vals, {p+"-h-reorder" })) this->H_reorder  = vals.at({p+"-h-reorder" });
+	if(exist(vals, {p+"-cache-path"})) this->cache_path = vals.at({p+"-cache-path"});
 }
 
 void Encoder_LDPC::parameters
@@ -76,20 +83,23 @@ void Encoder_LDPC::parameters
 
 	if (this->type == "LDPC")
 		headers[p].push_back(std::make_pair("G matrix path", this->G_path));
-	if (this->type == "LDPC_H" || this->type == "LDPC_QC")
+	if (this->type == "LDPC_H" || this->type == "LDPC_QC" || this->type == "LDPC_QC_DD")
 	{
 		headers[p].push_back(std::make_pair("H matrix path", this->H_path));
 		headers[p].push_back(std::make_pair("H matrix reordering", this->H_reorder));
 	}
+	if ((this->type == "LDPC_H" || this->type == "LDPC_QC") && !this->cache_path.empty())
+		headers[p].push_back(std::make_pair("Matrices cache path", this->cache_path));
 }
 
 template <typename B>
 module::Encoder_LDPC<B>* Encoder_LDPC::parameters
 ::build(const tools::Sparse_matrix &G, const tools::Sparse_matrix &H, const tools::dvbs2_values* dvbs2) const
 {
-	     if (this->type == "LDPC"      ) return new module::Encoder_LDPC        <B>(this->K, this->N_cw, G, this->n_frames);
-	else if (this->type == "LDPC_H"    ) return new module::Encoder_LDPC_from_H <B>(this->K, this->N_cw, H, this->n_frames);
-	else if (this->type == "LDPC_QC"   ) return new module::Encoder_LDPC_from_QC<B>(this->K, this->N_cw, H, this->n_frames);
+	     if (this->type == "LDPC"      ) return new module::Encoder_LDPC                      <B>(this->K, this->N_cw, G, this->n_frames);
+	else if (this->type == "LDPC_H"    ) return new module::Encoder_LDPC_from_H               <B>(this->K, this->N_cw, H, this->n_frames, this->cache_path);
+	else if (this->type == "LDPC_QC"   ) return new module::Encoder_LDPC_from_QC              <B>(this->K, this->N_cw, H, this->n_frames, this->cache_path);
+	else if (this->type == "LDPC_QC_DD") return new module::Encoder_LDPC_from_QC_dual_diagonal<B>(this->K, this->N_cw, H, this->n_frames);
 	else if (this->type == "LDPC_DVBS2" && dvbs2 != nullptr)
 		return new module::Encoder_LDPC_DVBS2  <B>(*dvbs2, this->n_frames);
 
@@ -26,7 +26,8 @@ struct Encoder_LDPC : public Encoder
 		std::string G_path = "";
 
 		// optional parameters
-		std::string H_reorder = "NONE";
+		std::string H_reorder  = "NONE";
+		std::string cache_path = "";
 
 		// ---------------------------------------------------------------------------------------------------- METHODS
 		explicit parameters(const std::string &p = Encoder_LDPC_prefix);
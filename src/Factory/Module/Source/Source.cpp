@@ -90,7 +90,8 @@ module::Source<B>* Source::parameters
 	     if (this->type == "RAND"     ) return new module::Source_random     <B>(this->K, this->seed, this->n_frames);
 	else if (this->type == "RAND_FAST") return new module::Source_random_fast<B>(this->K, this->seed, this->n_frames);
 	else if (this->type == "AZCW"     ) return new module::Source_AZCW       <B>(this->K,             this->n_frames);
-	else if (this->type == "USER"     ) return new module::Source_user       <B>(this->K, this->path, this->n_frames);
+	else if (this->type == "USER"     ) return new module::Source_user       <B>(this->K, this->path, this->n_frames,
+	                                                                             this->stream_id, this->n_streams);
 
 	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
 }
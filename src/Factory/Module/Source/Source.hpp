@@ -28,6 +28,10 @@ struct Source : public Factory
 		int         n_frames = 1;
 		int         seed     = 0;
 
+		// the frames read from the file (USER) of a thread among 'n_streams'
+		int         stream_id = 0;
+		int         n_streams = 1;
+
 		// ---------------------------------------------------------------------------------------------------- METHODS
 		explicit parameters(const std::string &p = Source_prefix);
 		virtual ~parameters();
@@ -124,6 +124,10 @@ void BFER::parameters
 	opt_args[{p+"-coded"}] =
 		{"",
 		 "enable the coded monitoring (extends the monitored bits to the entire codeword)."};
+
+	opt_args[{p+"-snr-concurrent"}] =
+		{"",
+		 "simulate several SNR points at the same time (the threads steal the SNR points of each other)."};
 }
 
 void BFER::parameters
@@ -144,12 +148,10 @@ void BFER::parameters
 	if(exist(vals, {p+"-err-trk"        })) this->err_track_enable    = true;
 	if(exist(vals, {p+"-coset",      "c"})) this->coset               = true;
 	if(exist(vals, {p+"-coded",         })) this->coded_monitoring    = true;
+	if(exist(vals, {p+"-snr-concurrent" })) this->snr_concurrent      = true;
 
 	if (this->err_track_revert)
-	{
 		this->err_track_enable = false;
-		this->n_threads = 1;
-	}
 }
 
 void BFER::parameters
@@ -162,6 +164,7 @@ void BFER::parameters
 	headers[p].push_back(std::make_pair("SNR type", this->snr_type));
 	headers[p].push_back(std::make_pair("Coset approach (c)", this->coset ? "yes" : "no"));
 	headers[p].push_back(std::make_pair("Coded monitoring", this->coded_monitoring ? "yes" : "no"));
+	headers[p].push_back(std::make_pair("Concurrent SNR points", this->snr_concurrent ? "yes" : "no"));
 
 	std::string enable_track = (this->err_track_enable) ? "on" : "off";
 	headers[p].push_back(std::make_pair("Bad frames tracking", enable_track));
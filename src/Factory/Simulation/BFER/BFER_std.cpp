@@ -43,18 +43,33 @@ void BFER_std::parameters
 ::get_description(arg_map &req_args, arg_map &opt_args) const
 {
 	BFER::parameters::get_description(req_args, opt_args);
+
+	auto p = this->get_prefix();
+
+	opt_args[{p+"-pipeline"}] =
+		{"",
+		 "split the communication chain in 3 stages running on their own threads (the decoder is replicated on "
+		 "'threads' - 2 threads)."};
 }
 
 void BFER_std::parameters
 ::store(const arg_val_map &vals)
 {
 	BFER::parameters::store(vals);
+
+	auto p = this->get_prefix();
+
+	if(exist(vals, {p+"-pipeline"})) this->pipeline = true;
 }
 
 void BFER_std::parameters
 ::get_headers(std::map<std::string,header_list>& headers, const bool full) const
 {
 	BFER::parameters::get_headers(headers, full);
+
+	auto p = this->get_prefix();
+
+	headers[p].push_back(std::make_pair("Pipeline", this->pipeline ? "yes" : "no"));
 }
 
 template <typename B, typename R, typename Q>
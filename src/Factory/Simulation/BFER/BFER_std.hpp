@@ -28,6 +28,9 @@ struct BFER_std : BFER
 	{
 	public:
 		// ------------------------------------------------------------------------------------------------- PARAMETERS
+		// optional parameters
+		bool pipeline = false;
+
 		// module parameters
 		Codec_SIHO::parameters *cdc = nullptr;
 
@@ -52,13 +52,12 @@ void Frozenbits_generator::parameters
 
 	opt_args[{p+"-awgn-path"}] =
 		{"string",
-		 "path to a file or a directory containing the best channels to use for information bits."};
+		 "path to a file or a directory containing the best channels to use for information bits (with the TV method, "
+		 "the channels computed are also cached in the directory)."};
 
-#ifdef ENABLE_POLAR_BOUNDS
-	opt_args[{p+"-pb-path"}] =
-		{"string",
-		 "path of the polar bounds code generator (generates best channels to use)."};
-#endif
+	opt_args[{p+"-threads"}] =
+		{"positive_int",
+		 "number of threads of the TV construction (0 to use all the cores)."};
 }
 
 void Frozenbits_generator::parameters
@@ -66,15 +65,12 @@ void Frozenbits_generator::parameters
 {
 	auto p = this->get_prefix();
 
-	if(exist(vals, {p+"-info-bits", "K"})) this->K       = std::stoi(vals.at({p+"-info-bits", "K"}));
-	if(exist(vals, {p+"-cw-size",   "N"})) this->N_cw    = std::stoi(vals.at({p+"-cw-size",   "N"}));
-	if(exist(vals, {p+"-sigma"         })) this->sigma   = std::stof(vals.at({p+"-sigma"         }));
-	if(exist(vals, {p+"-awgn-path"     })) this->path_fb =           vals.at({p+"-awgn-path"     });
-	if(exist(vals, {p+"-gen-method"    })) this->type    =           vals.at({p+"-gen-method"    });
-
-#ifdef ENABLE_POLAR_BOUNDS
-	if(exist(vals, {p+"-pb-path"})) this->path_pb = vals.at({p+"-pb-path"});
-#endif
+	if(exist(vals, {p+"-info-bits", "K"})) this->K         = std::stoi(vals.at({p+"-info-bits", "K"}));
+	if(exist(vals, {p+"-cw-size",   "N"})) this->N_cw      = std::stoi(vals.at({p+"-cw-size",   "N"}));
+	if(exist(vals, {p+"-sigma"         })) this->sigma     = std::stof(vals.at({p+"-sigma"         }));
+	if(exist(vals, {p+"-awgn-path"     })) this->path_fb   =           vals.at({p+"-awgn-path"     });
+	if(exist(vals, {p+"-gen-method"    })) this->type      =           vals.at({p+"-gen-method"    });
+	if(exist(vals, {p+"-threads"       })) this->n_threads = std::stoi(vals.at({p+"-threads"       }));
 }
 
 void Frozenbits_generator::parameters
@@ -86,20 +82,18 @@ void Frozenbits_generator::parameters
 	if (full) headers[p].push_back(std::make_pair("Info. bits (K)", std::to_string(this->K)));
 	if (full) headers[p].push_back(std::make_pair("Codeword size (N)", std::to_string(this->N_cw)));
 	headers[p].push_back(std::make_pair("Sigma", this->sigma == -1.0f ? "adaptive" : std::to_string(this->sigma)));
-#ifdef ENABLE_POLAR_BOUNDS
-	if (this->type == "TV")
-		headers[p].push_back(std::make_pair("PB path", this->path_pb));
-#endif
 	if (this->type == "TV" || this->type == "FILE")
 		headers[p].push_back(std::make_pair("Path", this->path_fb));
+	if (this->type == "TV")
+		headers[p].push_back(std::make_pair("Threads", this->n_threads ? std::to_string(this->n_threads) : "all"));
 }
 
 tools::Frozenbits_generator* Frozenbits_generator::parameters
 ::build() const
 {
-	     if (this->type == "GA"  ) return new tools::Frozenbits_generator_GA  (this->K, this->N_cw,                               this->sigma);
-	else if (this->type == "TV"  ) return new tools::Frozenbits_generator_TV  (this->K, this->N_cw, this->path_fb, this->path_pb, this->sigma);
-	else if (this->type == "FILE") return new tools::Frozenbits_generator_file(this->K, this->N_cw, this->path_fb                            );
+	     if (this->type == "GA"  ) return new tools::Frozenbits_generator_GA  (this->K, this->N_cw,                this->sigma);
+	else if (this->type == "TV"  ) return new tools::Frozenbits_generator_TV  (this->K, this->N_cw, this->path_fb, this->sigma, this->n_threads);
+	else if (this->type == "FILE") return new tools::Frozenbits_generator_file(this->K, this->N_cw, this->path_fb             );
 
 	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
 }
@@ -18,14 +18,14 @@ struct Frozenbits_generator : public Factory
 	public:
 		// ------------------------------------------------------------------------------------------------- PARAMETERS
 		// required parameters
-		int         K       = -1;
-		int         N_cw    = -1;
+		int         K         = -1;
+		int         N_cw      = -1;
 
 		// optional parameters
-		std::string type    = "GA";
-		std::string path_fb = "../conf/cde/awgn_polar_codes/TV";
-		std::string path_pb = "../lib/polar_bounds/bin/polar_bounds";
-		float       sigma   = -1.f;
+		std::string type      = "GA";
+		std::string path_fb   = "../conf/cde/awgn_polar_codes/TV";
+		float       sigma     = -1.f;
+		int         n_threads = 0; // number of threads of the TV construction (0 for all the cores)
 
 		// ---------------------------------------------------------------------------------------------------- METHODS
 		explicit parameters(const std::string &p = Frozenbits_generator_prefix);
@@ -28,6 +28,10 @@ struct Interleaver_core : public Factory
 		int         n_cols   = 4; // number of columns of the columns interleaver
 		int         n_frames = 1;
 		int         seed     = 0;
+
+		// the interleavers read from the file (USER) of a thread among 'n_streams'
+		int         stream_id = 0;
+		int         n_streams = 1;
 		bool        uniform  = false; // set at true to regenerate the interleaver at each new frame
 
 		// ---------------------------------------------------------------------------------------------------- METHODS
@@ -53,29 +53,37 @@ void Channel_AWGN_LLR<R>
 			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
 		}
 
-		noise_generator->generate(this->noise.data(), this->N, this->sigma);
-
 		std::fill(Y_N, Y_N + this->N, (R)0);
 		for (auto f = 0; f < this->n_frames; f++)
 			for (auto i = 0; i < this->N; i++)
 				Y_N[i] += X_N[f * this->N +i];
 
-		for (auto i = 0; i < this->N; i++)
-			Y_N[i] += this->noise[i];
+		if (this->is_noise_tracked())
+		{
+			noise_generator->generate(this->noise.data(), this->N, this->sigma);
+			for (auto i = 0; i < this->N; i++)
+				Y_N[i] += this->noise[i];
+		}
+		else
+			noise_generator->add_noise(Y_N, Y_N, this->N, this->sigma);
 	}
 	else
 	{
 		const auto f_start = (frame_id < 0) ? 0 : frame_id % this->n_frames;
 		const auto f_stop  = (frame_id < 0) ? this->n_frames : f_start +1;
 
-		if (frame_id < 0)
-			noise_generator->generate(this->noise, this->sigma);
-		else
-			noise_generator->generate(this->noise.data() + f_start * this->N, this->N, this->sigma);
+		const auto offset = f_start * this->N;
+		const auto length = (f_stop - f_start) * this->N;
+
+		if (this->is_noise_tracked())
+		{
+			noise_generator->generate(this->noise.data() + offset, length, this->sigma);
 
-		for (auto f = f_start; f < f_stop; f++)
-			for (auto n = 0; n < this->N; n++)
-				Y_N[f * this->N +n] = X_N[f * this->N +n] + this->noise[f * this->N +n];
+			for (auto n = offset; n < offset + length; n++)
+				Y_N[n] = X_N[n] + this->noise[n];
+		}
+		else // the noise is directly accumulated into 'Y_N'
+			noise_generator->add_noise(X_N + offset, Y_N + offset, length, this->sigma);
 	}
 }
 
@@ -51,7 +51,7 @@ protected:
 	const int N;     /*!< Size of one frame (= number of bits in one frame) */
 	      R   sigma; /*!< Sigma^2, the noise variance */
 
-	std::vector<R> noise;
+	std::vector<R> noise; /*!< The last generated noise, only stored when the noise is tracked */
 
 public:
 	/*!
@@ -62,7 +62,7 @@ public:
 	 * \param name:     Channel's name.
 	 */
 	Channel(const int N, const R sigma = -1.f, const int n_frames = 1)
-	: Module(n_frames), N(N), sigma(sigma), noise(this->N * this->n_frames, 0)
+	: Module(n_frames), N(N), sigma(sigma), noise()
 	{
 		const std::string name = "Channel";
 		this->set_name(name);
@@ -117,11 +117,33 @@ public:
 		return this->sigma;
 	}
 
+	/*!
+	 * \brief Gets the last generated noise (empty if the noise tracking is disabled).
+	 */
 	const std::vector<R>& get_noise() const
 	{
 		return noise;
 	}
 
+	/*!
+	 * \brief Enables or disables the storage of the generated noise in the 'noise' buffer.
+	 *
+	 * By default the noise is directly accumulated into the output frames and it is not stored. The noise tracking
+	 * is required to dump the noise of the erroneous frames (call it before registering get_noise() in a Dumper).
+	 *
+	 * \param enable: true to store the noise.
+	 */
+	void set_noise_tracking(const bool enable)
+	{
+		this->noise.resize(enable ? this->N * this->n_frames : 0, (R)0);
+		this->noise.shrink_to_fit();
+	}
+
+	bool is_noise_tracked() const
+	{
+		return !this->noise.empty();
+	}
+
 	virtual void set_sigma(const R sigma)
 	{
 		if (sigma <= 0)
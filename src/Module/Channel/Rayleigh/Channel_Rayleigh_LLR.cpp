@@ -74,7 +74,6 @@ void Channel_Rayleigh_LLR<R>
 		}
 
 		noise_generator->generate(this->gains, (R)1 / (R)std::sqrt((R)2));
-		noise_generator->generate(this->noise.data(), this->N, this->sigma);
 
 		std::fill(Y_N, Y_N + this->N, (R)0);
 
@@ -106,8 +105,7 @@ void Channel_Rayleigh_LLR<R>
 				}
 			}
 		}
-		for (auto i = 0; i < this->N; i++)
-			Y_N[i] += this->noise[i];
+		this->add_noise_to(Y_N, 0, this->N);
 	}
 	else
 	{
@@ -115,15 +113,9 @@ void Channel_Rayleigh_LLR<R>
 		const auto f_stop  = (frame_id < 0) ? this->n_frames : f_start +1;
 
 		if (frame_id < 0)
-		{
 			noise_generator->generate(this->gains, (R)1 / (R)std::sqrt((R)2));
-			noise_generator->generate(this->noise, this->sigma);
-		}
 		else
-		{
 			noise_generator->generate(this->gains.data() + f_start * this->N, this->N, (R)1 / (R)std::sqrt((R)2));
-			noise_generator->generate(this->noise.data() + f_start * this->N, this->N, this->sigma);
-		}
 
 		if (this->complex)
 		{
@@ -134,11 +126,8 @@ void Channel_Rayleigh_LLR<R>
 					const auto h_re = H_N[f * this->N + n   ] = this->gains[f * this->N + n   ];
 					const auto h_im = H_N[f * this->N + n +1] = this->gains[f * this->N + n +1];
 
-					const auto n_re = this->noise[f * this->N + n   ];
-					const auto n_im = this->noise[f * this->N + n +1];
-
-					Y_N[f * this->N + n   ] = (X_N[f * this->N + n   ] * h_re - X_N[f * this->N + n +1] * h_im) + n_re;
-					Y_N[f * this->N + n +1] = (X_N[f * this->N + n +1] * h_re + X_N[f * this->N + n   ] * h_im) + n_im;
+					Y_N[f * this->N + n   ] = X_N[f * this->N + n   ] * h_re - X_N[f * this->N + n +1] * h_im;
+					Y_N[f * this->N + n +1] = X_N[f * this->N + n +1] * h_re + X_N[f * this->N + n   ] * h_im;
 				}
 			}
 		}
@@ -152,11 +141,27 @@ void Channel_Rayleigh_LLR<R>
 					const auto h_im = this->gains[f * this->N + 2*n +1];
 
 					H_N[f * this->N + n] = std::sqrt(h_re * h_re + h_im * h_im);
-					Y_N[f * this->N + n] = X_N[f * this->N + n] * H_N[f * this->N + n] + this->noise[f * this->N + n];
+					Y_N[f * this->N + n] = X_N[f * this->N + n] * H_N[f * this->N + n];
 				}
 			}
 		}
+
+		this->add_noise_to(Y_N, f_start * this->N, (f_stop - f_start) * this->N);
+	}
+}
+
+template <typename R>
+void Channel_Rayleigh_LLR<R>
+::add_noise_to(R *Y_N, const int offset, const int length)
+{
+	if (this->is_noise_tracked())
+	{
+		noise_generator->generate(this->noise.data() + offset, length, this->sigma);
+		for (auto i = offset; i < offset + length; i++)
+			Y_N[i] += this->noise[i];
 	}
+	else // the noise is directly accumulated into 'Y_N'
+		noise_generator->add_noise(Y_N + offset, Y_N + offset, length, this->sigma);
 }
 
 // ==================================================================================== explicit template instantiation
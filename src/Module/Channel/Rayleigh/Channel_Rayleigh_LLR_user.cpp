@@ -125,16 +125,23 @@ void Channel_Rayleigh_LLR_user<R>
 		}
 	}
 
-	// generate the noise
-	noise_generator->generate(this->noise, this->sigma);
-
-	// use the noise and the gain to modify the signal
+	// use the gain to modify the signal
 	for (auto i = 0; i < this->N * this->n_frames; i++)
 	{
 		H_N[i] = this->gains[i];
 
-		Y_N[i] = X_N[i] * H_N[i] + this->noise[i];
+		Y_N[i] = X_N[i] * H_N[i];
+	}
+
+	// add the noise
+	if (this->is_noise_tracked())
+	{
+		noise_generator->generate(this->noise, this->sigma);
+		for (auto i = 0; i < this->N * this->n_frames; i++)
+			Y_N[i] += this->noise[i];
 	}
+	else // the noise is directly accumulated into 'Y_N'
+		noise_generator->add_noise(Y_N, Y_N, this->N * this->n_frames, this->sigma);
 }
 
 // ==================================================================================== explicit template instantiation
@@ -10,12 +10,21 @@ using namespace aff3ct::module;
 
 template <typename R>
 Channel_user<R>
-::Channel_user(const int N, const std::string &filename, const bool add_users, const int n_frames)
-: Channel<R>(N, (R)1, n_frames), add_users(add_users), noise_buff(), noise_counter(0)
+::Channel_user(const int N, const std::string &filename, const bool add_users, const int n_frames,
+               const int stream_id, const int n_streams)
+: Channel<R>(N, (R)1, n_frames), add_users(add_users), noise_buff(), noise_counter(0), n_streams(n_streams)
 {
 	const std::string name = "Channel_user";
 	this->set_name(name);
 
+	if (n_streams <= 0 || stream_id < 0 || stream_id >= n_streams)
+	{
+		std::stringstream message;
+		message << "'stream_id' has to be positive and smaller than 'n_streams' ('stream_id' = " << stream_id
+		        << ", 'n_streams' = " << n_streams << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
 	if (filename.empty())
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "'filename' should not be empty.");
 
@@ -97,6 +106,8 @@ Channel_user<R>
 		}
 
 		file.close();
+
+		this->noise_counter = stream_id % (int)n_fra;
 	}
 	else
 	{
@@ -130,15 +141,18 @@ void Channel_user<R>
 
 		for (auto f = 0; f < this->n_frames; f++)
 		{
-			std::copy(this->noise_buff[this->noise_counter].begin(),
-			          this->noise_buff[this->noise_counter].end  (),
-			          this->noise.data() + f * this->N);
+			if (this->is_noise_tracked())
+				std::copy(this->noise_buff[this->noise_counter].begin(),
+				          this->noise_buff[this->noise_counter].end  (),
+				          this->noise.data() + f * this->N);
 
-			this->noise_counter = (this->noise_counter +1) % (int)this->noise_buff.size();
-		}
+			// the noise of the first frame is added to the sum of the users
+			if (f == 0)
+				for (auto i = 0; i < this->N; i++)
+					Y_N[i] += this->noise_buff[this->noise_counter][i];
 
-		for (auto i = 0; i < this->N; i++)
-			Y_N[i] += this->noise[i];
+			this->noise_counter = (this->noise_counter + this->n_streams) % (int)this->noise_buff.size();
+		}
 	}
 	else
 	{
@@ -147,14 +161,15 @@ void Channel_user<R>
 
 		for (auto f = f_start; f < f_stop; f++)
 		{
-			std::copy(this->noise_buff[this->noise_counter].begin(),
-			          this->noise_buff[this->noise_counter].end  (),
-			          this->noise.data() + f * this->N);
+			const auto &noise = this->noise_buff[this->noise_counter];
+
+			if (this->is_noise_tracked())
+				std::copy(noise.begin(), noise.end(), this->noise.data() + f * this->N);
 
 			for (auto i = 0; i < this->N; i++)
-				Y_N[f * this->N +i] = X_N[f * this->N +i] + this->noise[f * this->N +i];
+				Y_N[f * this->N +i] = X_N[f * this->N +i] + noise[i];
 
-			this->noise_counter = (this->noise_counter +1) % (int)this->noise_buff.size();
+			this->noise_counter = (this->noise_counter + this->n_streams) % (int)this->noise_buff.size();
 		}
 	}
 }
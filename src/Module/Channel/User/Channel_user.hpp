@@ -17,9 +17,11 @@ private:
 	const bool add_users;
 	mipp::vector<mipp::vector<R>> noise_buff;
 	int noise_counter;
+	const int n_streams;
 
 public:
-	Channel_user(const int N, const std::string &filename, const bool add_users = false, const int n_frames = 1);
+	Channel_user(const int N, const std::string &filename, const bool add_users = false, const int n_frames = 1,
+	             const int stream_id = 0, const int n_streams = 1);
 	virtual ~Channel_user();
 
 	void add_noise(const R *X_N, R *Y_N, const int frame_id = -1);  using Channel<R>::add_noise;
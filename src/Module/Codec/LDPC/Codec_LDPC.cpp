@@ -1,4 +1,7 @@
+#include <map>
+#include <mutex>
 #include <string>
+#include <memory>
 #include <fstream>
 #include <sstream>
 #include <numeric>
@@ -7,6 +10,7 @@
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Code/LDPC/AList/AList.hpp"
 #include "Tools/Code/LDPC/QC/QC.hpp"
+#include "Tools/Code/LDPC/Matrix_handler/LDPC_matrix_cache.hpp"
 #include "Tools/general_utils.h"
 
 #include "Factory/Module/Puncturer/Puncturer.hpp"
@@ -52,7 +56,7 @@ Codec_LDPC<B,Q>
                    factory::Puncturer_LDPC::parameters *pct_params)
 : Codec          <B,Q>(enc_params.K, enc_params.N_cw, pct_params ? pct_params->N : enc_params.N_cw, enc_params.tail_length, enc_params.n_frames),
   Codec_SISO_SIHO<B,Q>(enc_params.K, enc_params.N_cw, pct_params ? pct_params->N : enc_params.N_cw, enc_params.tail_length, enc_params.n_frames),
-  info_bits_pos(enc_params.K), dvbs2(nullptr)
+  tabs(nullptr)
 {
 	const std::string name = "Codec_LDPC";
 	this->set_name(name);
@@ -83,6 +87,99 @@ Codec_LDPC<B,Q>
 	}
 
 	// ---------------------------------------------------------------------------------------------------------- tools
+	tabs = get_tables(enc_params, dec_params, pct_params, this->N);
+
+	if (pct_params && pct_params->pattern.empty() && !tabs->pct_pattern.empty())
+		pct_params->pattern = tabs->pct_pattern;
+
+	// ---------------------------------------------------------------------------------------------------- allocations
+	if (!pct_params)
+	{
+		factory::Puncturer::parameters pctno_params;
+		pctno_params.type     = "NO";
+		pctno_params.K        = enc_params.K;
+		pctno_params.N        = enc_params.N_cw;
+		pctno_params.N_cw     = enc_params.N_cw;
+		pctno_params.n_frames = enc_params.n_frames;
+
+		this->set_puncturer(factory::Puncturer::build<B,Q>(pctno_params));
+	}
+	else
+	{
+		try
+		{
+			this->set_puncturer(factory::Puncturer_LDPC::build<B,Q>(*pct_params));
+		}
+		catch (tools::cannot_allocate const&)
+		{
+			this->set_puncturer(factory::Puncturer::build<B,Q>(*pct_params));
+		}
+	}
+
+	try
+	{
+		this->set_encoder(factory::Encoder_LDPC::build<B>(enc_params, tabs->G, tabs->H, tabs->dvbs2.get()));
+	}
+	catch (tools::cannot_allocate const&)
+	{
+		this->set_encoder(factory::Encoder::build<B>(enc_params));
+	}
+
+	try
+	{
+		auto decoder_siso_siho = factory::Decoder_LDPC::build_siso<B,Q>(dec_params, tabs->H, tabs->info_bits_pos, this->get_encoder(), tabs->flooding);
+		this->set_decoder_siso(decoder_siso_siho);
+		this->set_decoder_siho(decoder_siso_siho);
+	}
+	catch (const std::exception&)
+	{
+		this->set_decoder_siho(factory::Decoder_LDPC::build<B,Q>(dec_params, tabs->H, tabs->info_bits_pos, this->get_encoder(), tabs->flooding));
+	}
+}
+
+template <typename B, typename Q>
+Codec_LDPC<B,Q>
+::~Codec_LDPC()
+{
+}
+
+template <typename B, typename Q>
+std::shared_ptr<const typename Codec_LDPC<B,Q>::tables> Codec_LDPC<B,Q>
+::get_tables(const factory::Encoder_LDPC  ::parameters &enc_params,
+             const factory::Decoder_LDPC  ::parameters &dec_params,
+             const factory::Puncturer_LDPC::parameters *pct_params,
+             const int N)
+{
+	std::stringstream key;
+	key << enc_params.type << "|" << enc_params.K << "|" << enc_params.N_cw << "|" << N << "|" << enc_params.G_path
+	    << "|" << dec_params.H_path << "|" << dec_params.H_reorder << "|" << (pct_params && pct_params->pattern.empty())
+	    << "|" << dec_params.type << "|" << dec_params.simd_strategy;
+
+	// the first thread builds the tables, the next ones get them as long as a codec uses them
+	static std::mutex mutex_tables;
+	static std::map<std::string, std::weak_ptr<const tables>> shared;
+	std::lock_guard<std::mutex> lock(mutex_tables);
+
+	auto tabs = shared[key.str()].lock();
+	if (tabs == nullptr)
+	{
+		tabs = std::shared_ptr<const tables>(build_tables(enc_params, dec_params, pct_params, N));
+		shared[key.str()] = tabs;
+	}
+
+	return tabs;
+}
+
+template <typename B, typename Q>
+typename Codec_LDPC<B,Q>::tables* Codec_LDPC<B,Q>
+::build_tables(const factory::Encoder_LDPC  ::parameters &enc_params,
+               const factory::Decoder_LDPC  ::parameters &dec_params,
+               const factory::Puncturer_LDPC::parameters *pct_params,
+               const int N)
+{
+	std::unique_ptr<tables> t(new tables());
+	t->info_bits_pos.resize(enc_params.K);
+
 	bool is_info_bits_pos = false;
 	if (enc_params.type == "LDPC")
 	{
@@ -98,15 +195,15 @@ Codec_LDPC<B,Q>
 		}
 		else if (G_format == "QC")
 		{
-			G = tools::QC::read(file_G);
+			t->G = tools::QC::read(file_G);
 		}
 		else if (G_format == "ALIST")
 		{
-			G = tools::AList::read(file_G);
+			t->G = tools::AList::read(file_G);
 
 			try
 			{
-				info_bits_pos = tools::AList::read_info_bits_pos(file_G, this->K, this->N_cw);
+				t->info_bits_pos = tools::AList::read_info_bits_pos(file_G, enc_params.K, enc_params.N_cw);
 				is_info_bits_pos = true;
 			}
 			catch (std::exception const&)
@@ -119,9 +216,9 @@ Codec_LDPC<B,Q>
 
 	if (enc_params.type == "LDPC_DVBS2")
 	{
-		dvbs2 = tools::build_dvbs2(this->K, this->N);
+		t->dvbs2.reset(tools::build_dvbs2(enc_params.K, N));
 
-		H = tools::build_H(*dvbs2);
+		t->H = tools::build_H(*t->dvbs2);
 	}
 	else
 	{
@@ -144,17 +241,17 @@ Codec_LDPC<B,Q>
 		}
 		else if (H_format == "QC")
 		{
-			H = tools::QC::read(file_H);
+			t->H = tools::QC::read(file_H);
 			if (pct_params && pct_params->pattern.empty())
-				pct_params->pattern = tools::QC::read_pct_pattern(file_H);
+				t->pct_pattern = tools::QC::read_pct_pattern(file_H);
 		}
 		else if (H_format == "ALIST")
 		{
-			H = tools::AList::read(file_H);
+			t->H = tools::AList::read(file_H);
 
 			try
 			{
-				info_bits_pos = tools::AList::read_info_bits_pos(file_H, enc_params.K, enc_params.N_cw);
+				t->info_bits_pos = tools::AList::read_info_bits_pos(file_H, enc_params.K, enc_params.N_cw);
 				is_info_bits_pos = true;
 			}
 			catch (std::exception const&) { }
@@ -164,74 +261,28 @@ Codec_LDPC<B,Q>
 	if (dec_params.H_reorder != "NONE")
 	{
 		// reorder the H matrix following the check node degrees
-		H.sort_cols_per_density(dec_params.H_reorder);
+		t->H.sort_cols_per_density(dec_params.H_reorder);
 	}
 
+	if ((dec_params.type == "BP" || dec_params.type == "BP_FLOODING") && dec_params.simd_strategy.empty())
+		t->flooding = std::make_shared<const tools::LDPC_BP_flooding_tables>(t->H);
+
 	if (!is_info_bits_pos)
 	{
 		if (enc_params.type == "LDPC_H")
 		{
-			auto encoder_LDPC = factory::Encoder_LDPC::build<B>(enc_params, G, H);
-			info_bits_pos = encoder_LDPC->get_info_bits_pos();
-			delete encoder_LDPC;
+			// the "LDPC_H" encoders get the same G from the cache (as long as this one is alive)
+			std::vector<unsigned> G_info_bits_pos;
+			t->G_from_H = tools::LDPC_matrix_cache::get_G(t->H, G_info_bits_pos, enc_params.cache_path);
+			t->info_bits_pos.assign(G_info_bits_pos.begin(), G_info_bits_pos.end());
 		}
 		else
 		{
-			std::iota(info_bits_pos.begin(), info_bits_pos.end(), 0);
-		}
-	}
-
-	// ---------------------------------------------------------------------------------------------------- allocations
-	if (!pct_params)
-	{
-		factory::Puncturer::parameters pctno_params;
-		pctno_params.type     = "NO";
-		pctno_params.K        = enc_params.K;
-		pctno_params.N        = enc_params.N_cw;
-		pctno_params.N_cw     = enc_params.N_cw;
-		pctno_params.n_frames = enc_params.n_frames;
-
-		this->set_puncturer(factory::Puncturer::build<B,Q>(pctno_params));
-	}
-	else
-	{
-		try
-		{
-			this->set_puncturer(factory::Puncturer_LDPC::build<B,Q>(*pct_params));
+			std::iota(t->info_bits_pos.begin(), t->info_bits_pos.end(), 0);
 		}
-		catch (tools::cannot_allocate const&)
-		{
-			this->set_puncturer(factory::Puncturer::build<B,Q>(*pct_params));
-		}
-	}
-
-	try
-	{
-		this->set_encoder(factory::Encoder_LDPC::build<B>(enc_params, G, H, dvbs2));
-	}
-	catch (tools::cannot_allocate const&)
-	{
-		this->set_encoder(factory::Encoder::build<B>(enc_params));
 	}
 
-	try
-	{
-		auto decoder_siso_siho = factory::Decoder_LDPC::build_siso<B,Q>(dec_params, H, info_bits_pos, this->get_encoder());
-		this->set_decoder_siso(decoder_siso_siho);
-		this->set_decoder_siho(decoder_siso_siho);
-	}
-	catch (const std::exception&)
-	{
-		this->set_decoder_siho(factory::Decoder_LDPC::build<B,Q>(dec_params, H, info_bits_pos, this->get_encoder()));
-	}
-}
-
-template <typename B, typename Q>
-Codec_LDPC<B,Q>
-::~Codec_LDPC()
-{
-	if (dvbs2 != nullptr)
-		delete dvbs2;
+	return t.release();
 }
 
 template <typename B, typename Q>
@@ -240,6 +291,7 @@ void Codec_LDPC<B,Q>
 {
 	const auto K    = this->K;
 	const auto N_cw = this->N_cw;
+	const auto &info_bits_pos = tabs->info_bits_pos;
 
 	for (auto i = 0; i < K; i++)
 		sys[i] = Y_N[info_bits_pos[i]];
@@ -258,7 +310,7 @@ void Codec_LDPC<B,Q>
 ::_extract_sys_llr(const Q *Y_N, Q *Y_K, const int frame_id)
 {
 	for (auto i = 0; i < this->K; i++)
-		Y_K[i] = Y_N[info_bits_pos[i]];
+		Y_K[i] = Y_N[tabs->info_bits_pos[i]];
 }
 
 template <typename B, typename Q>
@@ -266,7 +318,7 @@ void Codec_LDPC<B,Q>
 ::_extract_sys_bit(const Q *Y_N, B *V_K, const int frame_id)
 {
 	for (auto i = 0; i < this->K; i++)
-		V_K[i] = Y_N[info_bits_pos[i]] >= 0 ? (B)0 : (B)1;
+		V_K[i] = Y_N[tabs->info_bits_pos[i]] >= 0 ? (B)0 : (B)1;
 }
 
 // ==================================================================================== explicit template instantiation
@@ -1,6 +1,8 @@
 #ifndef CODEC_LDPC_HPP_
 #define CODEC_LDPC_HPP_
 
+#include <memory>
+#include <vector>
 #include <cstdint>
 
 #include "Factory/Module/Encoder/LDPC/Encoder_LDPC.hpp"
@@ -8,6 +10,7 @@
 #include "Factory/Module/Decoder/LDPC/Decoder_LDPC.hpp"
 
 #include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
+#include "Tools/Code/LDPC/BP_flooding/LDPC_BP_flooding_tables.hpp"
 #include "Tools/Code/LDPC/Standard/DVBS2/DVBS2_constants.hpp"
 
 #include "../Codec_SISO_SIHO.hpp"
@@ -20,11 +23,19 @@ template <typename B = int, typename Q = float>
 class Codec_LDPC : public Codec_SISO_SIHO<B,Q>
 {
 protected:
-	tools::Sparse_matrix H;
-	tools::Sparse_matrix G;
-	std::vector<uint32_t> info_bits_pos;
-	std::vector<bool> pctPattern;
-	const tools::dvbs2_values* dvbs2;
+	// read-only part of the codec, built once and shared by the codecs of the simulation threads
+	struct tables
+	{
+		tools::Sparse_matrix H;
+		tools::Sparse_matrix G;
+		std::vector<uint32_t> info_bits_pos;
+		std::vector<bool> pct_pattern; // puncturing pattern read from the QC H matrix file
+		std::unique_ptr<const tools::dvbs2_values> dvbs2;
+		std::shared_ptr<const tools::Sparse_matrix> G_from_H; // keeps the G shared by the "LDPC_H" encoders alive
+		std::shared_ptr<const tools::LDPC_BP_flooding_tables> flooding; // graph of H for the flooding BP decoders
+	};
+
+	std::shared_ptr<const tables> tabs;
 
 public:
 	Codec_LDPC(const factory::Encoder_LDPC::parameters   &enc_params,
@@ -39,6 +50,16 @@ protected:
 
 private:
 	static std::string get_matrix_format(const std::string& filename);
+
+	static std::shared_ptr<const tables> get_tables(const factory::Encoder_LDPC  ::parameters &enc_params,
+	                                                const factory::Decoder_LDPC  ::parameters &dec_params,
+	                                                const factory::Puncturer_LDPC::parameters *pct_params,
+	                                                const int N);
+
+	static tables* build_tables(const factory::Encoder_LDPC  ::parameters &enc_params,
+	                            const factory::Decoder_LDPC  ::parameters &dec_params,
+	                            const factory::Puncturer_LDPC::parameters *pct_params,
+	                            const int N);
 };
 }
 }
@@ -20,14 +20,20 @@ Decoder_LDPC_BP<B,R>
                   const bool enable_syndrome,
                   const int syndrome_depth,
                   const int n_frames,
-                  const int simd_inter_frame_level)
+                  const int simd_inter_frame_level,
+                  const int stable_depth)
 : Decoder               (K, N, n_frames, simd_inter_frame_level),
   Decoder_SISO_SIHO<B,R>(K, N, n_frames, simd_inter_frame_level),
   n_ite                 (n_ite                                 ),
   H                     (H                                     ),
   enable_syndrome       (enable_syndrome                       ),
   syndrome_depth        (syndrome_depth                        ),
-  cur_syndrome_depth    (0                                     )
+  stable_depth          (stable_depth                          ),
+  cur_syndrome_depth    (0                                     ),
+  cur_stable_depth      (-1                                    ),
+  decisions             (N, 0                                  ),
+  CN_parities           (H.get_n_cols(), 0                     ),
+  n_unsatisfied_CN      (0                                     )
 {
 	const std::string name = "Decoder_LDPC_BP";
 	this->set_name(name);
@@ -46,6 +52,13 @@ Decoder_LDPC_BP<B,R>
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
 	}
 
+	if (stable_depth < 0)
+	{
+		std::stringstream message;
+		message << "'stable_depth' has to be positive ('stable_depth' = " << stable_depth << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
 	if (N != (int)H.get_n_rows())
 	{
 		std::stringstream message;
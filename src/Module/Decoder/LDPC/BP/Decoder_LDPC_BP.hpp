@@ -1,6 +1,9 @@
 #ifndef DECODER_LDPC_BP_HPP_
 #define DECODER_LDPC_BP_HPP_
 
+#include <vector>
+#include <cmath>
+
 #include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
 
 #include "../../Decoder_SISO_SIHO.hpp"
@@ -17,8 +20,16 @@ protected:
 	const tools::Sparse_matrix &H;
 	const bool                  enable_syndrome;
 	const int                   syndrome_depth;
+	const int                   stable_depth; // number of successive iterations without any hard decision change to
+	                                          // stop the decoding (0 = disabled)
 
 	int cur_syndrome_depth;
+	int cur_stable_depth;
+
+	// incremental syndrome: hard decisions and parity of the check nodes at the previous check
+	std::vector<unsigned char> decisions;
+	std::vector<unsigned char> CN_parities;
+	int n_unsatisfied_CN;
 
 public:
 	Decoder_LDPC_BP(const int K,
@@ -28,9 +39,77 @@ public:
 	                const bool enable_syndrome = true,
 	                const int syndrome_depth = 1,
 	                const int n_frames = 1,
-	                const int simd_inter_frame_level = 1);
+	                const int simd_inter_frame_level = 1,
+	                const int stable_depth = 0);
 	virtual ~Decoder_LDPC_BP();
 
+	/*!
+	 * \brief Resets the state of the incremental stop criterion, has to be called before decoding a new frame.
+	 */
+	void reset_stop_criterion()
+	{
+		std::fill(this->decisions  .begin(), this->decisions  .end(), 0);
+		std::fill(this->CN_parities.begin(), this->CN_parities.end(), 0);
+		this->n_unsatisfied_CN   =  0;
+		this->cur_syndrome_depth =  0;
+		this->cur_stable_depth   = -1; // the first check compares the decisions to the all zero word, it does not count
+	}
+
+	/*!
+	 * \brief Incremental version of check_syndrome_soft() combined with the stable hard decisions criterion.
+	 *
+	 * Only the check nodes connected to a variable node whose hard decision changed since the previous call are
+	 * updated: the cost is O(N) plus the degrees of the flipped variable nodes instead of O(E) for the full syndrome.
+	 * The state starts from the all zero word (which satisfies all the parity checks), see reset_stop_criterion().
+	 *
+	 * \param Y_N: the current a posteriori information.
+	 *
+	 * \return true if the decoding can be stopped (syndrome verified or hard decisions stable).
+	 */
+	template <typename T>
+	bool check_stop_criterion_soft(const T* Y_N)
+	{
+		if (!this->enable_syndrome && !this->stable_depth)
+			return false;
+
+		const auto &VN_to_CN = this->H.get_row_to_cols();
+
+		auto n_changes = 0;
+		for (auto i = 0; i < this->N; i++)
+		{
+			const unsigned char decision = std::signbit((float)Y_N[i]) ? 1 : 0;
+			if (decision != this->decisions[i])
+			{
+				this->decisions[i] = decision;
+				n_changes++;
+
+				for (const auto c : VN_to_CN[i])
+				{
+					this->n_unsatisfied_CN += this->CN_parities[c] ? -1 : 1;
+					this->CN_parities[c] ^= 1;
+				}
+			}
+		}
+
+		if (this->stable_depth)
+		{
+			this->cur_stable_depth = (n_changes == 0 && this->cur_stable_depth >= 0) ? this->cur_stable_depth +1 : 0;
+			if (this->cur_stable_depth >= this->stable_depth)
+				return true;
+		}
+
+		if (this->enable_syndrome)
+		{
+			const auto syndrome = this->n_unsatisfied_CN != 0;
+
+			this->cur_syndrome_depth = !syndrome ? (this->cur_syndrome_depth +1) % this->syndrome_depth : 0;
+
+			return !syndrome && (this->cur_syndrome_depth == 0);
+		}
+
+		return false;
+	}
+
 	template <typename T>
 	bool check_syndrome_soft(const T* Y_N)
 	{
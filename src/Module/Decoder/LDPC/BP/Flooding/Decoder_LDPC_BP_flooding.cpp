@@ -20,61 +20,36 @@ Decoder_LDPC_BP_flooding<B,R>
                            const std::vector<unsigned> &info_bits_pos,
                            const bool enable_syndrome,
                            const int syndrome_depth,
-                           const int n_frames)
-: Decoder               (K, N,                                            n_frames, 1),
-  Decoder_LDPC_BP<B,R>  (K, N, n_ite, H, enable_syndrome, syndrome_depth, n_frames, 1),
-  n_V_nodes             (N                                                           ), // same as N but more explicit
-  n_C_nodes             ((int)H.get_n_cols()                                         ),
-  n_branches            ((int)H.get_n_connections()                                  ),
-  init_flag             (true                                                        ),
-  info_bits_pos         (info_bits_pos                                               ),
-  Lp_N                  (N, -1                                                       ), // -1 in order to fail when AZCW
-  C_to_V                (n_frames, std::vector<R>(this->n_branches)                  ),
-  V_to_C                (n_frames, std::vector<R>(this->n_branches)                  )
+                           const int n_frames,
+                           const int stable_depth,
+                           std::shared_ptr<const tools::LDPC_BP_flooding_tables> tables)
+: Decoder                (K, N,                                            n_frames, 1              ),
+  Decoder_LDPC_BP<B,R>   (K, N, n_ite, H, enable_syndrome, syndrome_depth, n_frames, 1, stable_depth),
+  n_V_nodes              (N                                                                         ), // same as N but more explicit
+  n_C_nodes              ((int)H.get_n_cols()                                                       ),
+  n_branches             ((int)H.get_n_connections()                                                ),
+  init_flag              (true                                                                      ),
+  info_bits_pos          (info_bits_pos                                                             ),
+  tables                 (tables ? tables : std::make_shared<const tools::LDPC_BP_flooding_tables>(H)),
+  n_variables_per_parity (this->tables->n_variables_per_parity                                      ),
+  n_parities_per_variable(this->tables->n_parities_per_variable                                     ),
+  transpose              (this->tables->transpose                                                   ),
+  Lp_N                   (N, -1                                                                     ), // -1 in order to fail when AZCW
+  C_to_V                 (n_frames, std::vector<R>(this->n_branches)                                ),
+  V_to_C                 (n_frames, std::vector<R>(this->n_branches)                                )
 {
 	const std::string name = "Decoder_LDPC_BP_flooding";
 	this->set_name(name);
-	
-	transpose.resize(this->n_branches);
-	mipp::vector<unsigned char> connections(H.get_n_rows(), 0);
 
-	const auto &CN_to_VN = H.get_col_to_rows();
-	const auto &VN_to_CN = H.get_row_to_cols();
-
-	auto k = 0;
-	for (auto i = 0; i < (int)CN_to_VN.size(); i++)
+	if (this->n_parities_per_variable.size() != H.get_n_rows() ||
+	    this->n_variables_per_parity .size() != H.get_n_cols() ||
+	    this->transpose              .size() != H.get_n_connections())
 	{
-		for (auto j = 0; j < (int)CN_to_VN[i].size(); j++)
-		{
-			auto id_V = CN_to_VN[i][j];
-
-			auto branch_id = 0;
-			for (auto ii = 0; ii < (int)id_V; ii++)
-				branch_id += (int)VN_to_CN[ii].size();
-			branch_id += connections[id_V];
-			connections[id_V]++;
-
-			if (connections[id_V] > (int)VN_to_CN[id_V].size())
-			{
-				std::stringstream message;
-				message << "'connections[id_V]' has to be equal or smaller than 'VN_to_CN[id_V].size()' ('id_V' = "
-				        << id_V << ", 'connections[id_V]' = " << connections[id_V] << ", 'VN_to_CN[id_V].size()' = "
-				        << VN_to_CN[id_V].size() << ").";
-				throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
-			}
-
-			transpose[k] = branch_id;
-			k++;
-		}
+		std::stringstream message;
+		message << "'tables' has to be built from 'H' ('tables->transpose.size()' = " << this->transpose.size()
+		        << ", 'H.get_n_connections()' = " << H.get_n_connections() << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
 	}
-
-	n_variables_per_parity.resize(H.get_n_cols());
-	for (auto i = 0; i < (int)H.get_n_cols(); i++)
-		n_variables_per_parity[i] = (unsigned char)CN_to_VN[i].size();
-
-	n_parities_per_variable.resize(H.get_n_rows());
-	for (auto i = 0; i < (int)H.get_n_rows(); i++)
-		n_parities_per_variable[i] = (unsigned char)VN_to_CN[i].size();
 }
 
 template <typename B, typename R>
@@ -181,6 +156,8 @@ template <typename B, typename R>
 void Decoder_LDPC_BP_flooding<B,R>
 ::BP_decode(const R *Y_N, const int frame_id)
 {
+	this->reset_stop_criterion();
+
 	// actual decoding
 	for (auto ite = 0; ite < this->n_ite; ite++)
 	{
@@ -190,12 +167,12 @@ void Decoder_LDPC_BP_flooding<B,R>
 		// make a saturation
 		// saturate<R>(this->C_to_V, (R)-C_to_V_max, (R)C_to_V_max);
 
-		if (this->enable_syndrome && ite != this->n_ite -1)
+		if ((this->enable_syndrome || this->stable_depth) && ite != this->n_ite -1)
 		{
 			R *C_to_V_ptr = this->C_to_V[frame_id].data();
 			for (auto i = 0; i < this->n_V_nodes; i++)
 			{
-				const auto length = this->n_parities_per_variable[i];
+				const auto length = (int)this->n_parities_per_variable[i];
 
 				auto sum_C_to_V = (R)0;
 				for (auto j = 0; j < length; j++)
@@ -207,7 +184,7 @@ void Decoder_LDPC_BP_flooding<B,R>
 				C_to_V_ptr += length;
 			}
 
-			if (this->check_syndrome_soft(this->Lp_N.data()))
+			if (this->check_stop_criterion_soft(this->Lp_N.data()))
 				break;
 		}
 	}
@@ -216,7 +193,7 @@ void Decoder_LDPC_BP_flooding<B,R>
 	R *C_to_V_ptr = this->C_to_V[frame_id].data();
 	for (auto i = 0; i < this->n_V_nodes; i++) 
 	{
-		const auto length = this->n_parities_per_variable[i];
+		const auto length = (int)this->n_parities_per_variable[i];
 
 		auto sum_C_to_V = (R)0;
 		for (auto j = 0; j < length; j++)
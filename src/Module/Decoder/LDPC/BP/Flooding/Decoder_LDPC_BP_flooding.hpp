@@ -1,7 +1,10 @@
 #ifndef DECODER_LDPC_BP_FLOODING_HPP_
 #define DECODER_LDPC_BP_FLOODING_HPP_
 
+#include <memory>
+
 #include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
+#include "Tools/Code/LDPC/BP_flooding/LDPC_BP_flooding_tables.hpp"
 
 #include "../Decoder_LDPC_BP.hpp"
 
@@ -25,9 +28,12 @@ protected:
 
 	const std::vector<unsigned> &info_bits_pos;
 
-	std::vector<unsigned char> n_variables_per_parity;
-	std::vector<unsigned char> n_parities_per_variable;
-	std::vector<unsigned int > transpose;
+	// read-only graph tables, shared with the other decoders built from the same H when given to the constructor
+	const std::shared_ptr<const tools::LDPC_BP_flooding_tables> tables;
+
+	const std::vector<unsigned> &n_variables_per_parity;
+	const std::vector<unsigned> &n_parities_per_variable;
+	const std::vector<unsigned> &transpose;
 
 	// data structures for iterative decoding
 	            std::vector<R>  Lp_N;   // a posteriori information
@@ -39,7 +45,9 @@ protected:
 	                         const std::vector<unsigned> &info_bits_pos,
 	                         const bool enable_syndrome = true,
 	                         const int syndrome_depth = 1,
-	                         const int n_frames = 1);
+	                         const int n_frames = 1,
+	                         const int stable_depth = 0,
+	                         std::shared_ptr<const tools::LDPC_BP_flooding_tables> tables = nullptr);
 	virtual ~Decoder_LDPC_BP_flooding();
 
 	void _decode_siso   (const R *Y_N1, R *Y_N2, const int frame_id);
@@ -27,36 +27,34 @@ Decoder_LDPC_BP_flooding_Gallager_A<B,R>
 	const std::string name = "Decoder_LDPC_BP_flooding_Gallager_A";
 	this->set_name(name);
 	
-	transpose.resize(H.get_n_connections());
-	std::vector<unsigned char> connections(H.get_n_rows(), 0);
-
 	const auto &CN_to_VN = H.get_col_to_rows();
 	const auto &VN_to_CN = H.get_row_to_cols();
 
+	// position of the first branch of each variable node in the VN ordered arrays (prefix sum of the VN degrees)
+	std::vector<unsigned> first_branch(H.get_n_rows(), 0);
+	for (auto i = 1; i < (int)H.get_n_rows(); i++)
+		first_branch[i] = first_branch[i -1] + (unsigned)VN_to_CN[i -1].size();
+
+	transpose.resize(H.get_n_connections());
+	std::vector<unsigned> connections(H.get_n_rows(), 0);
+
 	auto k = 0;
 	for (auto i = 0; i < (int)CN_to_VN.size(); i++)
 	{
 		for (auto j = 0; j < (int)CN_to_VN[i].size(); j++)
 		{
-			auto id_V = CN_to_VN[i][j];
-
-			auto branch_id = 0;
-			for (auto ii = 0; ii < (int)id_V; ii++)
-				branch_id += (int)VN_to_CN[ii].size();
-			branch_id += connections[id_V];
-			connections[id_V]++;
+			const auto id_V = CN_to_VN[i][j];
 
-			if (connections[id_V] > (int)VN_to_CN[id_V].size())
+			if (connections[id_V] >= VN_to_CN[id_V].size())
 			{
 				std::stringstream message;
-				message << "'connections[id_V]' has to be equal or smaller than 'VN_to_CN[id_V].size()' "
+				message << "'connections[id_V]' has to be smaller than 'VN_to_CN[id_V].size()' "
 				        << "('id_V' = " << id_V << ", 'connections[id_V]' = " << connections[id_V]
 				        << ", 'VN_to_CN[id_V].size()' = " << VN_to_CN[id_V].size() << ")'.";
 				throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
 			}
 
-			transpose[k] = branch_id;
-			k++;
+			transpose[k++] = first_branch[id_V] + connections[id_V]++;
 		}
 	}
 }
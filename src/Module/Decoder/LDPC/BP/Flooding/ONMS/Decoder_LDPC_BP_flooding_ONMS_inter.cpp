@@ -0,0 +1,336 @@
+#include <limits>
+#include <cmath>
+#include <sstream>
+#include <typeinfo>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Perf/Reorderer/Reorderer.hpp"
+#include "Tools/Code/LDPC/decoder_LDPC_functions.h"
+
+#include "Decoder_LDPC_BP_flooding_ONMS_inter.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template <typename B, typename R>
+Decoder_LDPC_BP_flooding_ONMS_inter<B,R>
+::Decoder_LDPC_BP_flooding_ONMS_inter(const int K, const int N, const int n_ite,
+                                      const tools::Sparse_matrix &H,
+                                      const std::vector<unsigned> &info_bits_pos,
+                                      const float normalize_factor,
+                                      const R offset,
+                                      const bool enable_syndrome,
+                                      const int syndrome_depth,
+                                      const int n_frames,
+                                      const int stable_depth)
+: Decoder               (K, N, n_frames,                                            mipp::nElReg<R>()              ),
+  Decoder_LDPC_BP<B,R>  (K, N, n_ite, H, enable_syndrome, syndrome_depth, n_frames, mipp::nElReg<R>(), stable_depth),
+  normalize_factor      (normalize_factor                                                             ),
+  offset                (offset                                                                       ),
+  contributions         (H.get_cols_max_degree()                                                      ),
+  saturation            (tools::messages_saturation<R>(H)                                             ),
+  n_C_nodes             ((int)H.get_n_cols()                                                          ),
+  n_branches            ((int)H.get_n_connections()                                                   ),
+  init_flag             (true                                                                         ),
+  info_bits_pos         (info_bits_pos                                                                ),
+  n_VN_per_CN           (H.get_n_cols()                                                               ),
+  branch_VN             (H.get_n_connections()                                                        ),
+  C_to_V                (this->n_dec_waves, mipp::vector<mipp::Reg<R>>(H.get_n_connections())         ),
+  Lp_N                  (N                                                                            ),
+  Lp_N_prev             (stable_depth ? N : 0                                                         ),
+  Y_N_reorderered       (N                                                                            ),
+  V_reorderered         (N                                                                            )
+{
+	const std::string name = "Decoder_LDPC_BP_flooding_ONMS_inter";
+	this->set_name(name);
+
+	if (typeid(R) == typeid(signed char))
+	{
+		std::stringstream message;
+		message << "This decoder does not work in 8-bit fixed-point (try in 16-bit).";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (saturation <= 0)
+	{
+		std::stringstream message;
+		message << "'saturation' has to be greater than 0 ('saturation' = " << saturation << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	auto k = 0;
+	for (auto i = 0; i < this->n_C_nodes; i++)
+	{
+		n_VN_per_CN[i] = (unsigned)this->H[i].size();
+		for (auto j = 0; j < (int)this->H[i].size(); j++)
+			branch_VN[k++] = this->H[i][j];
+	}
+}
+
+template <typename B, typename R>
+Decoder_LDPC_BP_flooding_ONMS_inter<B,R>
+::~Decoder_LDPC_BP_flooding_ONMS_inter()
+{
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_ONMS_inter<B,R>
+::reset()
+{
+	this->init_flag = true;
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_ONMS_inter<B,R>
+::_load(const R *Y_N, const int frame_id)
+{
+	const auto cur_wave = frame_id / this->simd_inter_frame_level;
+
+	// memory zones initialization
+	if (this->init_flag)
+	{
+		std::fill(this->C_to_V[cur_wave].begin(), this->C_to_V[cur_wave].end(), mipp::Reg<R>((R)0));
+
+		if (cur_wave == this->n_dec_waves -1) this->init_flag = false;
+	}
+
+	std::vector<const R*> frames(mipp::nElReg<R>());
+	for (auto f = 0; f < mipp::nElReg<R>(); f++) frames[f] = Y_N + f * this->N;
+	tools::Reorderer_static<R,mipp::nElReg<R>()>::apply(frames, (R*)this->Y_N_reorderered.data(), this->N);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_ONMS_inter<B,R>
+::_decode_siso(const R *Y_N1, R *Y_N2, const int frame_id)
+{
+	this->_load(Y_N1, frame_id);
+
+	// actual decoding
+	this->BP_decode(frame_id);
+
+	// prepare for next round by processing extrinsic information
+	for (auto i = 0; i < this->N; i++)
+		this->Lp_N[i] = tools::simd_sub_sat<R>(this->Lp_N[i], this->Y_N_reorderered[i]);
+
+	std::vector<R*> frames(mipp::nElReg<R>());
+	for (auto f = 0; f < mipp::nElReg<R>(); f++) frames[f] = Y_N2 + f * this->N;
+	tools::Reorderer_static<R,mipp::nElReg<R>()>::apply_rev((R*)this->Lp_N.data(), frames, this->N);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_ONMS_inter<B,R>
+::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+	this->_load(Y_N, frame_id);
+
+	// actual decoding
+	this->BP_decode(frame_id);
+
+	// take the hard decision
+	for (auto i = 0; i < this->K; i++)
+	{
+		const auto k = this->info_bits_pos[i];
+		V_reorderered[i] = mipp::cast<R,B>(this->Lp_N[k]) >> (sizeof(B) * 8 - 1);
+	}
+
+	std::vector<B*> frames(mipp::nElReg<R>());
+	for (auto f = 0; f < mipp::nElReg<R>(); f++) frames[f] = V_K + f * this->K;
+	tools::Reorderer_static<B,mipp::nElReg<R>()>::apply_rev((B*)V_reorderered.data(), frames, this->K);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_ONMS_inter<B,R>
+::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
+{
+	this->_load(Y_N, frame_id);
+
+	// actual decoding
+	this->BP_decode(frame_id);
+
+	// take the hard decision
+	for (auto i = 0; i < this->N; i++)
+		V_reorderered[i] = mipp::cast<R,B>(this->Lp_N[i]) >> (sizeof(B) * 8 - 1);
+
+	std::vector<B*> frames(mipp::nElReg<R>());
+	for (auto f = 0; f < mipp::nElReg<R>(); f++) frames[f] = V_N + f * this->N;
+	tools::Reorderer_static<B,mipp::nElReg<R>()>::apply_rev((B*)V_reorderered.data(), frames, this->N);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_ONMS_inter<B,R>
+::BP_decode(const int frame_id)
+{
+	if (typeid(R) == typeid(short) || typeid(R) == typeid(signed char))
+	{
+		     if (normalize_factor == 0.125f) this->_BP_decode<1>(frame_id);
+		else if (normalize_factor == 0.250f) this->_BP_decode<2>(frame_id);
+		else if (normalize_factor == 0.375f) this->_BP_decode<3>(frame_id);
+		else if (normalize_factor == 0.500f) this->_BP_decode<4>(frame_id);
+		else if (normalize_factor == 0.625f) this->_BP_decode<5>(frame_id);
+		else if (normalize_factor == 0.750f) this->_BP_decode<6>(frame_id);
+		else if (normalize_factor == 0.875f) this->_BP_decode<7>(frame_id);
+		else if (normalize_factor == 1.000f) this->_BP_decode<8>(frame_id);
+		else
+		{
+			std::stringstream message;
+			message << "'normalize_factor' can only be 0.125f, 0.250f, 0.375f, 0.500f, 0.625f, 0.750f, 0.875f or 1.000f"
+			        << " ('normalize_factor' = " << normalize_factor << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+	else // float or double
+	{
+		if (normalize_factor == 1.000f) this->_BP_decode<8>(frame_id);
+		else                            this->_BP_decode<0>(frame_id);
+	}
+}
+
+// BP algorithm
+template <typename B, typename R>
+template <int F>
+void Decoder_LDPC_BP_flooding_ONMS_inter<B,R>
+::_BP_decode(const int frame_id)
+{
+	const auto cur_wave = frame_id / this->simd_inter_frame_level;
+
+	auto cur_syndrome_depth = 0;
+	auto cur_stable_depth   = 0;
+
+	this->compute_APP(this->C_to_V[cur_wave]);
+	if (this->stable_depth)
+		std::copy(this->Lp_N.begin(), this->Lp_N.end(), this->Lp_N_prev.begin());
+
+	for (auto ite = 0; ite < this->n_ite; ite++)
+	{
+		this->BP_process<F>(this->C_to_V[cur_wave]);
+		this->compute_APP(this->C_to_V[cur_wave]);
+
+		// stop criteria
+		if (this->stable_depth)
+		{
+			cur_stable_depth = this->check_stable() ? cur_stable_depth +1 : 0;
+			if (cur_stable_depth == this->stable_depth)
+				break;
+		}
+
+		if (this->enable_syndrome && this->check_syndrome())
+		{
+			cur_syndrome_depth++;
+			if (cur_syndrome_depth == this->syndrome_depth)
+				break;
+		}
+		else
+			cur_syndrome_depth = 0;
+	}
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_ONMS_inter<B,R>
+::compute_APP(const mipp::vector<mipp::Reg<R>> &C_to_V)
+{
+	std::copy(this->Y_N_reorderered.begin(), this->Y_N_reorderered.end(), this->Lp_N.begin());
+
+	// variable nodes sweep: the messages are accumulated in the order of the edge array
+	for (auto k = 0; k < this->n_branches; k++)
+		this->Lp_N[branch_VN[k]] = tools::simd_add_sat<R>(this->Lp_N[branch_VN[k]], C_to_V[k]);
+}
+
+template <typename B, typename R>
+bool Decoder_LDPC_BP_flooding_ONMS_inter<B,R>
+::check_syndrome()
+{
+	const auto zero = mipp::Msk<mipp::N<B>()>(false);
+	auto syndrome = zero;
+
+	auto k = 0;
+	for (auto i = 0; i < this->n_C_nodes; i++)
+	{
+		auto sign = zero;
+
+		const auto n_VN = (int)n_VN_per_CN[i];
+		for (auto j = 0; j < n_VN; j++)
+			sign ^= mipp::sign(this->Lp_N[branch_VN[k++]]);
+
+		syndrome |= sign;
+	}
+
+	return (mipp::testz(syndrome));
+}
+
+template <typename B, typename R>
+bool Decoder_LDPC_BP_flooding_ONMS_inter<B,R>
+::check_stable()
+{
+	auto changes = mipp::Msk<mipp::N<B>()>(false);
+
+	for (auto i = 0; i < this->N; i++)
+	{
+		changes |= mipp::sign(this->Lp_N[i]) ^ mipp::sign(this->Lp_N_prev[i]);
+		this->Lp_N_prev[i] = this->Lp_N[i];
+	}
+
+	return (mipp::testz(changes));
+}
+
+// BP algorithm
+template <typename B, typename R>
+template <int F>
+void Decoder_LDPC_BP_flooding_ONMS_inter<B,R>
+::BP_process(mipp::vector<mipp::Reg<R>> &C_to_V)
+{
+	auto k = 0;
+
+	const auto zero_msk = mipp::Msk<mipp::N<B>()>(false);
+	const auto zero     = mipp::Reg<R>((R)0);
+	for (auto i = 0; i < this->n_C_nodes; i++)
+	{
+		auto sign = zero_msk;
+		auto min1 = mipp::Reg<R>(std::numeric_limits<R>::max());
+		auto min2 = mipp::Reg<R>(std::numeric_limits<R>::max());
+
+		// the variable to check messages are the a posteriori information minus the previous check node message
+		const auto n_VN = (int)n_VN_per_CN[i];
+		for (auto j = 0; j < n_VN; j++)
+		{
+			contributions[j]  = tools::simd_sub_sat<R>(this->Lp_N[branch_VN[k +j]], C_to_V[k +j]);
+			const auto v_abs  = mipp::abs (contributions[j]);
+			const auto c_sign = mipp::sign(contributions[j]);
+			const auto v_temp = min1;
+
+			sign ^= c_sign;
+			min1  = mipp::min(min1,           v_abs         );
+			min2  = mipp::min(min2, mipp::max(v_abs, v_temp));
+		}
+
+		auto cste1 = tools::simd_sat<R>(tools::simd_normalize<R,F>(min2 - offset, normalize_factor), saturation);
+		auto cste2 = tools::simd_sat<R>(tools::simd_normalize<R,F>(min1 - offset, normalize_factor), saturation);
+
+		cste1 = mipp::blend(zero, cste1, zero > cste1);
+		cste2 = mipp::blend(zero, cste2, zero > cste2);
+
+		// check nodes sweep: the new messages are written in place, contiguously
+		for (auto j = 0; j < n_VN; j++)
+		{
+			const auto value = contributions[j];
+			const auto v_abs = mipp::abs(value);
+			      auto v_res = mipp::blend(cste1, cste2, v_abs == min1);
+			const auto v_sig = sign ^ mipp::sign(value);
+
+			C_to_V[k +j] = mipp::copysign(v_res, v_sig);
+		}
+
+		k += n_VN;
+	}
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::module::Decoder_LDPC_BP_flooding_ONMS_inter<B_8,Q_8>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_ONMS_inter<B_16,Q_16>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_ONMS_inter<B_32,Q_32>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_ONMS_inter<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_LDPC_BP_flooding_ONMS_inter<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,89 @@
+#ifndef DECODER_LDPC_BP_FLOODING_ONMS_INTER_HPP_
+#define DECODER_LDPC_BP_FLOODING_ONMS_INTER_HPP_
+
+#include <vector>
+#include <mipp.h>
+
+#include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
+
+#include "../../Decoder_LDPC_BP.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*
+ * Flooding offset normalized min-sum decoder, vectorized over mipp::nElReg<R>() frames (one frame per SIMD lane).
+ * The check to variable messages are stored in a single edge array sorted by check nodes: the check node sweep reads
+ * and writes it contiguously, and the variable node sweep accumulates it into the a posteriori information (APP) in
+ * the same order. The variable to check messages are not stored, they are recomputed from the APP when needed.
+ */
+template <typename B = int, typename R = float>
+class Decoder_LDPC_BP_flooding_ONMS_inter : public Decoder_LDPC_BP<B,R>
+{
+private:
+	const float normalize_factor;
+	const R offset;
+	mipp::vector<mipp::Reg<R>> contributions;
+
+protected:
+	const R saturation;
+	const int n_C_nodes;  // number of check nodes (= N - K)
+	const int n_branches; // number of branches in the bi-partite graph (connexions between the V and C nodes)
+
+	// reset so C_to_V structures can be cleared only at the beginning of the loop in iterative decoding
+	bool init_flag;
+
+	const std::vector<unsigned> &info_bits_pos;
+
+	// edge layout: the branches of the check node 'i' are the 'n_VN_per_CN[i]' next ones in 'branch_VN'
+	std::vector<unsigned> n_VN_per_CN; // degree of each check node
+	std::vector<unsigned> branch_VN;   // variable node connected to each branch (sorted by check nodes)
+
+	// data structures for iterative decoding
+	std::vector<mipp::vector<mipp::Reg<R>>> C_to_V; // check nodes to variable nodes messages
+	            mipp::vector<mipp::Reg<R>>  Lp_N;   // a posteriori information
+	            mipp::vector<mipp::Reg<R>>  Lp_N_prev; // a posteriori information of the previous iteration (used by
+	                                                   // the stable hard decisions criterion)
+
+	mipp::vector<mipp::Reg<R>> Y_N_reorderered;
+	mipp::vector<mipp::Reg<B>> V_reorderered;
+
+public:
+	Decoder_LDPC_BP_flooding_ONMS_inter(const int K, const int N, const int n_ite,
+	                                    const tools::Sparse_matrix &H,
+	                                    const std::vector<unsigned> &info_bits_pos,
+	                                    const float normalize_factor = 1.f,
+	                                    const R offset = (R)0,
+	                                    const bool enable_syndrome = true,
+	                                    const int syndrome_depth = 1,
+	                                    const int n_frames = 1,
+	                                    const int stable_depth = 0);
+	virtual ~Decoder_LDPC_BP_flooding_ONMS_inter();
+
+	void reset();
+
+protected:
+	void _load          (const R *Y_N,           const int frame_id);
+	void _decode_siso   (const R *Y_N1, R *Y_N2, const int frame_id);
+	void _decode_siho   (const R *Y_N,  B *V_K,  const int frame_id);
+	void _decode_siho_cw(const R *Y_N,  B *V_N,  const int frame_id);
+
+	// BP functions for decoding
+	void BP_decode(const int frame_id);
+
+	template <int F = 1>
+	void _BP_decode(const int frame_id);
+
+	void compute_APP(const mipp::vector<mipp::Reg<R>> &C_to_V);
+
+	bool check_syndrome();
+	bool check_stable(); // true if no hard decision changed since the previous call, in all the frames
+
+	template <int F = 1>
+	void BP_process(mipp::vector<mipp::Reg<R>> &C_to_V);
+};
+}
+}
+
+#endif /* DECODER_LDPC_BP_FLOODING_ONMS_INTER_HPP_ */
@@ -16,9 +16,12 @@ Decoder_LDPC_BP_flooding_sum_product<B,R>
                                        const std::vector<unsigned> &info_bits_pos,
                                        const bool enable_syndrome,
                                        const int syndrome_depth,
-                                       const int n_frames)
+                                       const int n_frames,
+                                       const int stable_depth,
+                                       std::shared_ptr<const tools::LDPC_BP_flooding_tables> tables)
 : Decoder(K, N, n_frames, 1),
-  Decoder_LDPC_BP_flooding<B,R>(K, N, n_ite, H, info_bits_pos, enable_syndrome, syndrome_depth, n_frames),
+  Decoder_LDPC_BP_flooding<B,R>(K, N, n_ite, H, info_bits_pos, enable_syndrome, syndrome_depth, n_frames, stable_depth,
+                                tables),
   values(H.get_cols_max_degree())
 {
 	const std::string name = "Decoder_LDPC_BP_flooding_sum_product";
@@ -46,7 +49,7 @@ void Decoder_LDPC_BP_flooding_sum_product<B,R>
 	for (auto i = 0; i < this->n_V_nodes; i++)
 	{
 		// VN node accumulate all the incoming messages
-		const auto length = this->n_parities_per_variable[i];
+		const auto length = (int)this->n_parities_per_variable[i];
 
 		auto sum_C_to_V = (R)0;
 		for (auto j = 0; j < length; j++)
@@ -66,7 +69,7 @@ void Decoder_LDPC_BP_flooding_sum_product<B,R>
 	auto transpose_ptr = this->transpose.data();
 	for (auto i = 0; i < this->n_C_nodes; i++)
 	{
-		const auto length = this->n_variables_per_parity[i];
+		const auto length = (int)this->n_variables_per_parity[i];
 
 		auto sign =    0;
 		auto prod = (R)1;
@@ -19,7 +19,9 @@ public:
 	                                     const std::vector<unsigned> &info_bits_pos,
 	                                     const bool enable_syndrome = true,
 	                                     const int  syndrome_depth = 1,
-	                                     const int n_frames = 1);
+	                                     const int n_frames = 1,
+	                                     const int stable_depth = 0,
+	                                     std::shared_ptr<const tools::LDPC_BP_flooding_tables> tables = nullptr);
 	virtual ~Decoder_LDPC_BP_flooding_sum_product();
 
 protected:
@@ -18,9 +18,11 @@ Decoder_LDPC_BP_layered_approximate_min_star<B,R,MIN>
                                                const std::vector<unsigned> &info_bits_pos,
                                                const bool enable_syndrome,
                                                const int syndrome_depth,
-                                               const int n_frames)
+                                               const int n_frames,
+                                               const bool compress_msg,
+                                               const int stable_depth)
 : Decoder(K, N, n_frames, 1),
-  Decoder_LDPC_BP_layered<B,R>(K, N, n_ite, H, info_bits_pos, enable_syndrome, syndrome_depth, n_frames),
+  Decoder_LDPC_BP_layered<B,R>(K, N, n_ite, H, info_bits_pos, enable_syndrome, syndrome_depth, n_frames, compress_msg, stable_depth),
   contributions(H.get_cols_max_degree()), values(H.get_cols_max_degree())
 {
 	const std::string name = "Decoder_LDPC_BP_layered_approximate_min_star";
@@ -36,6 +38,17 @@ Decoder_LDPC_BP_layered_approximate_min_star<B,R,MIN>
 {
 }
 
+template <typename B, typename R, tools::proto_min<R> MIN>
+void Decoder_LDPC_BP_layered_approximate_min_star<B,R,MIN>
+::BP_process_frame(const int frame_id)
+{
+	if (this->compress_msg)
+		this->BP_process_compressed(this->var_nodes[frame_id], this->CN_mags[frame_id], this->CN_min_pos[frame_id],
+		                            this->CN_signs[frame_id]);
+	else
+		this->BP_process(this->var_nodes[frame_id], this->branches[frame_id]);
+}
+
 // BP algorithm
 template <typename B, typename R, tools::proto_min<R> MIN>
 void Decoder_LDPC_BP_layered_approximate_min_star<B,R,MIN>
@@ -79,5 +92,64 @@ void Decoder_LDPC_BP_layered_approximate_min_star<B,R,MIN>
 		}
 	}
 }
+
+// BP algorithm with compressed check node messages: the message sent by a check node to a variable node is rebuilt
+// from the check node tuple (deltaMin for the 1st min position, delta for the others). If several contributions are
+// equal to the min, only the first one gets deltaMin.
+template <typename B, typename R, tools::proto_min<R> MIN>
+void Decoder_LDPC_BP_layered_approximate_min_star<B,R,MIN>
+::BP_process_compressed(std::vector<R> &var_nodes, std::vector<R> &CN_mags, std::vector<uint16_t> &CN_min_pos,
+                        std::vector<uint32_t> &CN_signs)
+{
+	auto kr = 0;
+	auto kw = 0;
+	for (auto i = 0; i < this->n_C_nodes; i++)
+	{
+		const auto mag_min = CN_mags[2 * i +0];
+		const auto mag_oth = CN_mags[2 * i +1];
+		const auto pos_min = (int)CN_min_pos[i];
+
+		auto sign     = 0;
+		auto pos      = 0;
+		auto min      = std::numeric_limits<R>::max();
+		auto deltaMin = std::numeric_limits<R>::max();
+
+		const auto n_VN = (int)this->H[i].size();
+		for (auto j = 0; j < n_VN; j++, kr++)
+		{
+			const auto b_mag  = (j == pos_min) ? mag_min : mag_oth;
+			const auto b_val  = ((CN_signs[kr >> 5] >> (kr & 31)) & 1) ? -b_mag : b_mag;
+			contributions[j]  = var_nodes[this->H[i][j]] - b_val;
+			const auto v_abs  = (R)std::abs(contributions[j]);
+			const auto c_sign = std::signbit((float)contributions[j]) ? -1 : 0;
+			const auto v_temp = min;
+
+			sign    ^= c_sign;
+			pos      = (v_abs < min) ? j : pos;
+			min      = std::min(min, v_abs);
+			deltaMin = MIN(deltaMin, (v_abs == min) ? v_temp : v_abs);
+		}
+
+		auto delta = MIN     (deltaMin, min );
+		delta      = std::max((R)0, delta   );
+		deltaMin   = std::max((R)0, deltaMin);
+
+		CN_mags[2 * i +0] = deltaMin;
+		CN_mags[2 * i +1] = delta;
+		CN_min_pos[i]     = (uint16_t)pos;
+
+		for (auto j = 0; j < n_VN; j++, kw++)
+		{
+			const auto value = contributions[j];
+			const auto v_res = (j == pos) ? deltaMin : delta;
+			const auto v_sig = sign ^ (std::signbit((float)value) ? -1 : 0);
+
+			const auto bit = (uint32_t)1 << (kw & 31);
+			CN_signs[kw >> 5] = v_sig ? (CN_signs[kw >> 5] | bit) : (CN_signs[kw >> 5] & ~bit);
+
+			var_nodes[this->H[i][j]] = value + (v_sig ? -v_res : v_res);
+		}
+	}
+}
 }
 }
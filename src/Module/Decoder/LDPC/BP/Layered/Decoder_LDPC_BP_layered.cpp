@@ -2,7 +2,9 @@
 #include <limits>
 #include <cmath>
 #include <stdexcept>
+#include <sstream>
 
+#include "Tools/Exception/exception.hpp"
 #include "Tools/Perf/hard_decision.h"
 #include "Tools/Math/utils.h"
 
@@ -18,17 +20,37 @@ Decoder_LDPC_BP_layered<B,R>
                           const std::vector<unsigned> &info_bits_pos,
                           const bool enable_syndrome,
                           const int syndrome_depth,
-                          const int n_frames)
-: Decoder               (K, N,                                            n_frames, 1),
-  Decoder_LDPC_BP<B,R>  (K, N, n_ite, H, enable_syndrome, syndrome_depth, n_frames, 1),
-  n_C_nodes             ((int)H.get_n_cols()                                         ),
-  init_flag             (true                                                        ),
-  info_bits_pos         (info_bits_pos                                               ),
-  var_nodes             (n_frames, std::vector<R>(N                    )             ),
-  branches              (n_frames, std::vector<R>(H.get_n_connections())             )
+                          const int n_frames,
+                          const bool compress_msg,
+                          const int stable_depth)
+: Decoder               (K, N,                                            n_frames, 1              ),
+  Decoder_LDPC_BP<B,R>  (K, N, n_ite, H, enable_syndrome, syndrome_depth, n_frames, 1, stable_depth),
+  n_C_nodes             ((int)H.get_n_cols()                                                       ),
+  compress_msg          (compress_msg                                                              ),
+  init_flag             (true                                                                      ),
+  info_bits_pos         (info_bits_pos                                                             ),
+  var_nodes             (n_frames, std::vector<R>(N)                                               )
 {
 	const std::string name = "Decoder_LDPC_BP_layered";
 	this->set_name(name);
+
+	if (compress_msg)
+	{
+		if (H.get_cols_max_degree() > (unsigned)std::numeric_limits<uint16_t>::max())
+		{
+			std::stringstream message;
+			message << "'H.get_cols_max_degree()' has to be smaller or equal to "
+			        << std::numeric_limits<uint16_t>::max() << " ('H.get_cols_max_degree()' = "
+			        << H.get_cols_max_degree() << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		CN_mags   .resize(n_frames, std::vector<R       >(2 * this->n_C_nodes                ));
+		CN_min_pos.resize(n_frames, std::vector<uint16_t>(    this->n_C_nodes                ));
+		CN_signs  .resize(n_frames, std::vector<uint32_t>((H.get_n_connections() + 31) / 32));
+	}
+	else
+		branches.resize(n_frames, std::vector<R>(H.get_n_connections()));
 }
 
 template <typename B, typename R>
@@ -51,7 +73,14 @@ void Decoder_LDPC_BP_layered<B,R>
 	// memory zones initialization
 	if (this->init_flag)
 	{
-		std::fill(this->branches [frame_id].begin(), this->branches [frame_id].end(), (R)0);
+		if (this->compress_msg)
+		{
+			std::fill(this->CN_mags   [frame_id].begin(), this->CN_mags   [frame_id].end(), (R)0);
+			std::fill(this->CN_min_pos[frame_id].begin(), this->CN_min_pos[frame_id].end(),  0 );
+			std::fill(this->CN_signs  [frame_id].begin(), this->CN_signs  [frame_id].end(),  0 );
+		}
+		else
+			std::fill(this->branches[frame_id].begin(), this->branches[frame_id].end(), (R)0);
 		std::fill(this->var_nodes[frame_id].begin(), this->var_nodes[frame_id].end(), (R)0);
 
 		if (frame_id == Decoder_SIHO<B,R>::n_frames -1)
@@ -134,15 +163,24 @@ template <typename B, typename R>
 void Decoder_LDPC_BP_layered<B,R>
 ::BP_decode(const int frame_id)
 {
+	this->reset_stop_criterion();
+
 	for (auto ite = 0; ite < this->n_ite; ite++)
 	{
-		this->BP_process(this->var_nodes[frame_id], this->branches[frame_id]);
+		this->BP_process_frame(frame_id);
 
-		if (this->check_syndrome_soft(this->var_nodes[frame_id].data()))
+		if (this->check_stop_criterion_soft(this->var_nodes[frame_id].data()))
 			break;
 	}
 }
 
+template <typename B, typename R>
+void Decoder_LDPC_BP_layered<B,R>
+::BP_process_frame(const int frame_id)
+{
+	this->BP_process(this->var_nodes[frame_id], this->branches[frame_id]);
+}
+
 // ==================================================================================== explicit template instantiation 
 #include "Tools/types.h"
 #ifdef MULTI_PREC
@@ -1,6 +1,8 @@
 #ifndef DECODER_LDPC_BP_LAYERED_HPP_
 #define DECODER_LDPC_BP_LAYERED_HPP_
 
+#include <cstdint>
+
 #include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
 
 #include "../Decoder_LDPC_BP.hpp"
@@ -13,7 +15,8 @@ template <typename B = int, typename R = float>
 class Decoder_LDPC_BP_layered : public Decoder_LDPC_BP<B,R>
 {
 protected:
-	const int n_C_nodes; // number of check nodes (= N - K)
+	const int  n_C_nodes;    // number of check nodes (= N - K)
+	const bool compress_msg; // store the check node messages in a compressed form (min-sum like update rules)
 
 	// reset so C_to_V and V_to_C structures can be cleared only at the beginning of the loop in iterative decoding
 	bool init_flag;
@@ -24,13 +27,22 @@ protected:
 	std::vector<std::vector<R>> var_nodes;
 	std::vector<std::vector<R>> branches;
 
+	// compressed check node messages (replace 'branches' when 'compress_msg' is enabled): for each check node, the
+	// magnitude of the message sent to its 1st min and the one of the messages sent to the other variable nodes, the
+	// position of the 1st min, and the sign of the messages (one bit per branch)
+	std::vector<std::vector<R       >> CN_mags;
+	std::vector<std::vector<uint16_t>> CN_min_pos;
+	std::vector<std::vector<uint32_t>> CN_signs;
+
 public:
 	Decoder_LDPC_BP_layered(const int K, const int N, const int n_ite,
 	                        const tools::Sparse_matrix &H,
 	                        const std::vector<unsigned> &info_bits_pos,
 	                        const bool enable_syndrome = true,
 	                        const int syndrome_depth = 1,
-	                        const int n_frames = 1);
+	                        const int n_frames = 1,
+	                        const bool compress_msg = false,
+	                        const int stable_depth = 0);
 	virtual ~Decoder_LDPC_BP_layered();
 
 	void reset();
@@ -44,6 +56,10 @@ protected:
 	// BP functions for decoding
 	void BP_decode(const int frame_id);
 
+	// one iteration on the frame 'frame_id', the implementations enabling 'compress_msg' override it to process the
+	// compressed check node messages
+	virtual void BP_process_frame(const int frame_id);
+
 	virtual void BP_process(std::vector<R> &var_nodes, std::vector<R> &branches) = 0;
 };
 }
@@ -20,7 +20,8 @@ public:
 	                                        const std::vector<unsigned> &info_bits_pos,
 	                                        const bool enable_syndrome = true,
 	                                        const int syndrome_depth = 1,
-	                                        const int n_frames = 1);
+	                                        const int n_frames = 1,
+	                                        const int stable_depth = 0);
 	virtual ~Decoder_LDPC_BP_layered_log_sum_product();
 
 protected:
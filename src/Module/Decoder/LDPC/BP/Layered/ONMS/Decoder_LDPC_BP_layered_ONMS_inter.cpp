@@ -7,6 +7,7 @@
 #include "Tools/Math/utils.h"
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Perf/Reorderer/Reorderer.hpp"
+#include "Tools/Code/LDPC/decoder_LDPC_functions.h"
 
 #include "Decoder_LDPC_BP_layered_ONMS_inter.hpp"
 
@@ -28,7 +29,7 @@ Decoder_LDPC_BP_layered_ONMS_inter<B,R>
   normalize_factor      (normalize_factor                                                             ),
   offset                (offset                                                                       ),
   contributions         (H.get_cols_max_degree()                                                      ),
-  saturation            ((R)((1 << ((sizeof(R) * 8 -2) - (int)std::log2(H.get_rows_max_degree()))) -1)),
+  saturation            (tools::messages_saturation<R>(H)                                             ),
   n_C_nodes             ((int)H.get_n_cols()                                                          ),
   init_flag             (true                                                                         ),
   info_bits_pos         (info_bits_pos                                                                ),
@@ -39,9 +40,6 @@ Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 {
 	const std::string name = "Decoder_LDPC_BP_layered_ONMS_inter";
 	this->set_name(name);
-	
-	if (typeid(R) == typeid(signed char))
-		throw tools::runtime_error(__FILE__, __LINE__, __func__, "This decoder does not work in 8-bit fixed-point.");
 
 	if (saturation <= 0)
 	{
@@ -84,8 +82,9 @@ void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 	for (auto f = 0; f < mipp::nElReg<R>(); f++) frames[f] = Y_N + f * this->N;
 	tools::Reorderer_static<R,mipp::nElReg<R>()>::apply(frames, (R*)this->Y_N_reorderered.data(), this->N);
 
+	// var_nodes contain previous extrinsic information
 	for (auto i = 0; i < (int)var_nodes[cur_wave].size(); i++)
-		this->var_nodes[cur_wave][i] += this->Y_N_reorderered[i]; // var_nodes contain previous extrinsic information
+		this->var_nodes[cur_wave][i] = tools::simd_add_sat<R>(this->var_nodes[cur_wave][i], this->Y_N_reorderered[i]);
 }
 
 template <typename B, typename R>
@@ -123,7 +122,7 @@ void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 	// prepare for next round by processing extrinsic information
 	const auto cur_wave = frame_id / this->simd_inter_frame_level;
 	for (auto i = 0; i < this->N; i++)
-		this->var_nodes[cur_wave][i] -= Y_N_reorderered[i];
+		this->var_nodes[cur_wave][i] = tools::simd_sub_sat<R>(this->var_nodes[cur_wave][i], Y_N_reorderered[i]);
 
 	std::vector<R*> frames(mipp::nElReg<R>());
 	for (auto f = 0; f < mipp::nElReg<R>(); f++) frames[f] = Y_N2 + f * this->N;
@@ -289,40 +288,6 @@ bool Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 	return (mipp::testz(syndrome));
 }
 
-// --------------------------------------------------------------------------------------------------------------------
-// --------------------------------------------------------------------------------------------------------- SIMD TOOLS
-
-//                                                                                                           saturation
-template <typename R>
-inline mipp::Reg<R> simd_sat(const mipp::Reg<R> val, const R saturation)
-{
-	return val;
-}
-template <>
-inline mipp::Reg<short> simd_sat(const mipp::Reg<short> v, const short s)
-{
-	return mipp::sat(v, (short)-s, (short)+s);
-}
-
-//                                                                                                        normalization
-template <typename R, int F = 0> inline mipp::Reg<R> simd_normalize(const mipp::Reg<R> val, const float factor)
-{
-	return val * mipp::Reg<R>((R)factor);
-}
-template <> inline mipp::Reg<short > simd_normalize<short, 1>(const mipp::Reg<short > v, const float f) { return (v >> 3);                       } // v * 0.125
-template <> inline mipp::Reg<short > simd_normalize<short, 2>(const mipp::Reg<short > v, const float f) { return            (v >> 2);            } // v * 0.250
-template <> inline mipp::Reg<short > simd_normalize<short, 3>(const mipp::Reg<short > v, const float f) { return (v >> 3) + (v >> 2);            } // v * 0.375
-template <> inline mipp::Reg<short > simd_normalize<short, 4>(const mipp::Reg<short > v, const float f) { return                       (v >> 1); } // v * 0.500
-template <> inline mipp::Reg<short > simd_normalize<short, 5>(const mipp::Reg<short > v, const float f) { return (v >> 3) +            (v >> 1); } // v * 0.625
-template <> inline mipp::Reg<short > simd_normalize<short, 6>(const mipp::Reg<short > v, const float f) { return            (v >> 2) + (v >> 1); } // v * 0.750
-template <> inline mipp::Reg<short > simd_normalize<short, 7>(const mipp::Reg<short > v, const float f) { return (v >> 3) + (v >> 2) + (v >> 1); } // v * 0.825
-template <> inline mipp::Reg<short > simd_normalize<short, 8>(const mipp::Reg<short > v, const float f) { return v;                              } // v * 1.000
-template <> inline mipp::Reg<float > simd_normalize<float, 8>(const mipp::Reg<float > v, const float f) { return v;                              } // v * 1.000
-template <> inline mipp::Reg<double> simd_normalize<double,8>(const mipp::Reg<double> v, const float f) { return v;                              } // v * 1.000
-
-// --------------------------------------------------------------------------------------------------------- SIMD TOOLS
-// --------------------------------------------------------------------------------------------------------------------
-
 // BP algorithm
 template <typename B, typename R>
 template <int F>
@@ -343,7 +308,7 @@ void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 		const auto n_VN = (int)this->H[i].size();
 		for (auto j = 0; j < n_VN; j++)
 		{
-			contributions[j]  = var_nodes[this->H[i][j]] - branches[kr++];
+			contributions[j]  = tools::simd_contribution<R>(var_nodes[this->H[i][j]], branches[kr++]);
 			const auto v_abs  = mipp::abs (contributions[j]);
 			const auto c_sign = mipp::sign(contributions[j]);
 			const auto v_temp = min1;
@@ -353,8 +318,8 @@ void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 			min2  = mipp::min(min2, mipp::max(v_abs, v_temp));
 		}
 
-		auto cste1 = simd_sat<R>(simd_normalize<R,F>(min2 - offset, normalize_factor), saturation);
-		auto cste2 = simd_sat<R>(simd_normalize<R,F>(min1 - offset, normalize_factor), saturation);
+		auto cste1 = tools::simd_sat<R>(tools::simd_normalize<R,F>(min2 - offset, normalize_factor), saturation);
+		auto cste2 = tools::simd_sat<R>(tools::simd_normalize<R,F>(min1 - offset, normalize_factor), saturation);
 
 		cste1 = mipp::blend(zero, cste1, zero > cste1);
 		cste2 = mipp::blend(zero, cste2, zero > cste2);
@@ -368,7 +333,7 @@ void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 			           v_res = mipp::copysign(v_res, v_sig);
 
 			branches[kw++] = v_res;
-			var_nodes[this->H[i][j]] = contributions[j] + v_res;
+			var_nodes[this->H[i][j]] = tools::simd_add_sat<R>(contributions[j], v_res);
 		}
 	}
 }
@@ -0,0 +1,358 @@
+#include <limits>
+#include <cmath>
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Perf/hard_decision.h"
+#include "Tools/Code/LDPC/QC/QC.hpp"
+#include "Tools/Code/LDPC/decoder_LDPC_functions.h"
+
+#include "Decoder_LDPC_BP_layered_ONMS_intra.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template <typename B, typename R>
+Decoder_LDPC_BP_layered_ONMS_intra<B,R>
+::Decoder_LDPC_BP_layered_ONMS_intra(const int K, const int N, const int n_ite,
+                                     const tools::Sparse_matrix &H,
+                                     const std::vector<unsigned> &info_bits_pos,
+                                     const float normalize_factor,
+                                     const R offset,
+                                     const bool enable_syndrome,
+                                     const int syndrome_depth,
+                                     const int n_frames)
+: Decoder               (K, N, n_frames,                                            1                 ),
+  Decoder_LDPC_BP<B,R>  (K, N, n_ite, H, enable_syndrome, syndrome_depth, n_frames, 1                 ),
+  normalize_factor      (normalize_factor                                                             ),
+  offset                (offset                                                                       ),
+  contributions         (H.get_cols_max_degree()                                                      ),
+  saturation            ((R)((1 << ((sizeof(R) * 8 -2) - (int)std::log2(H.get_rows_max_degree()))) -1)),
+  n_C_nodes             ((int)H.get_n_cols()                                                          ),
+  Z                     ((int)tools::QC::get_lifting_factor(H)                                        ),
+  n_layers              (n_C_nodes / Z                                                                ),
+  n_chunks              ((Z + mipp::nElReg<R>() -1) / mipp::nElReg<R>()                               ),
+  init_flag             (true                                                                         ),
+  info_bits_pos         (info_bits_pos                                                                ),
+  layer_offsets         (1, 0                                                                         ),
+  var_nodes             (n_frames, mipp::vector<R>(N)                                                 )
+{
+	const std::string name = "Decoder_LDPC_BP_layered_ONMS_intra";
+	this->set_name(name);
+
+	if (typeid(R) == typeid(signed char))
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, "This decoder does not work in 8-bit fixed-point.");
+
+	if (saturation <= 0)
+	{
+		std::stringstream message;
+		message << "'saturation' has to be greater than 0 ('saturation' = " << saturation << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (Z == 1)
+	{
+		std::stringstream message;
+		message << "'H' has to be a quasi-cyclic matrix (check that the H matrix is not reordered).";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	const auto base = tools::QC::get_base_matrix(H, (unsigned)Z);
+	for (auto l = 0; l < n_layers; l++)
+	{
+		for (auto j = 0; j < (int)base[l].size(); j++)
+			if (base[l][j] != -1)
+			{
+				blocks_VN   .push_back((unsigned)(j * Z));
+				blocks_shift.push_back((unsigned)base[l][j]);
+			}
+		layer_offsets.push_back((unsigned)blocks_VN.size());
+	}
+
+	branches.resize(n_frames, mipp::vector<mipp::Reg<R>>(blocks_VN.size() * n_chunks));
+}
+
+template <typename B, typename R>
+Decoder_LDPC_BP_layered_ONMS_intra<B,R>
+::~Decoder_LDPC_BP_layered_ONMS_intra()
+{
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_layered_ONMS_intra<B,R>
+::reset()
+{
+	this->init_flag = true;
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_layered_ONMS_intra<B,R>
+::_load(const R *Y_N, const int frame_id)
+{
+	// memory zones initialization
+	if (this->init_flag)
+	{
+		std::fill(this->branches [frame_id].begin(), this->branches [frame_id].end(), mipp::Reg<R>((R)0));
+		std::fill(this->var_nodes[frame_id].begin(), this->var_nodes[frame_id].end(), (R)0);
+
+		if (frame_id == Decoder_SIHO<B,R>::n_frames -1)
+			this->init_flag = false;
+	}
+
+	for (auto i = 0; i < this->N; i++)
+		this->var_nodes[frame_id][i] += Y_N[i]; // var_nodes contain previous extrinsic information
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_layered_ONMS_intra<B,R>
+::_decode_siso(const R *Y_N1, R *Y_N2, const int frame_id)
+{
+	// memory zones initialization
+	this->_load(Y_N1, frame_id);
+
+	// actual decoding
+	this->BP_decode(frame_id);
+
+	// prepare for next round by processing extrinsic information
+	for (auto i = 0; i < this->N; i++)
+		Y_N2[i] = this->var_nodes[frame_id][i] - Y_N1[i];
+
+	// copy extrinsic information into var_nodes for next TURBO iteration
+	std::copy(Y_N2, Y_N2 + this->N, this->var_nodes[frame_id].begin());
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_layered_ONMS_intra<B,R>
+::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+	this->_load(Y_N, frame_id);
+
+	// actual decoding
+	this->BP_decode(frame_id);
+
+	// take the hard decision
+	for (auto i = 0; i < this->K; i++)
+	{
+		const auto k = this->info_bits_pos[i];
+		V_K[i] = !(this->var_nodes[frame_id][k] >= 0);
+	}
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_layered_ONMS_intra<B,R>
+::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
+{
+	this->_load(Y_N, frame_id);
+
+	// actual decoding
+	this->BP_decode(frame_id);
+
+	// take the hard decision
+	tools::hard_decide(this->var_nodes[frame_id].data(), V_N, this->N);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_layered_ONMS_intra<B,R>
+::BP_decode(const int frame_id)
+{
+	if (typeid(R) == typeid(short) || typeid(R) == typeid(signed char))
+	{
+		     if (normalize_factor == 0.125f) this->_BP_decode<1>(frame_id);
+		else if (normalize_factor == 0.250f) this->_BP_decode<2>(frame_id);
+		else if (normalize_factor == 0.375f) this->_BP_decode<3>(frame_id);
+		else if (normalize_factor == 0.500f) this->_BP_decode<4>(frame_id);
+		else if (normalize_factor == 0.625f) this->_BP_decode<5>(frame_id);
+		else if (normalize_factor == 0.750f) this->_BP_decode<6>(frame_id);
+		else if (normalize_factor == 0.875f) this->_BP_decode<7>(frame_id);
+		else if (normalize_factor == 1.000f) this->_BP_decode<8>(frame_id);
+		else
+		{
+			std::stringstream message;
+			message << "'normalize_factor' can only be 0.125f, 0.250f, 0.375f, 0.500f, 0.625f, 0.750f, 0.875f or 1.000f"
+			        << " ('normalize_factor' = " << normalize_factor << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+	else // float or double
+	{
+		if (normalize_factor == 1.000f) this->_BP_decode<8>(frame_id);
+		else                            this->_BP_decode<0>(frame_id);
+	}
+}
+
+// BP algorithm
+template <typename B, typename R>
+template <int F>
+void Decoder_LDPC_BP_layered_ONMS_intra<B,R>
+::_BP_decode(const int frame_id)
+{
+	auto cur_syndrome_depth = 0;
+
+	for (auto ite = 0; ite < this->n_ite; ite++)
+	{
+		this->BP_process<F>(this->var_nodes[frame_id].data(), this->branches[frame_id]);
+
+		// stop criterion
+		if (this->enable_syndrome && this->check_syndrome(frame_id))
+		{
+			cur_syndrome_depth++;
+			if (cur_syndrome_depth == this->syndrome_depth)
+				break;
+		}
+		else
+			cur_syndrome_depth = 0;
+	}
+}
+
+// circular-shift load of the lanes [k, k + mipp::nElReg<R>()) of a circulant block: the lane 'l' gets the variable
+// node connected to the check node 'k + l' of the layer
+template <typename B, typename R>
+mipp::Reg<R> Decoder_LDPC_BP_layered_ONMS_intra<B,R>
+::load_rot(const R *blk, const int k, const int shift) const
+{
+	auto start = k + shift;
+	if (start >= this->Z) start -= this->Z;
+
+	mipp::Reg<R> r;
+	if (start + mipp::nElReg<R>() <= this->Z)
+		r.loadu(blk + start);
+	else // the register wraps around the end of the block
+	{
+		R tmp[mipp::nElReg<R>()];
+		for (auto l = 0; l < mipp::nElReg<R>(); l++)
+			tmp[l] = blk[(start + l) % this->Z];
+		r.loadu(tmp);
+	}
+
+	return r;
+}
+
+// circular-shift store, the lanes after the end of the layer (when Z is not a multiple of mipp::nElReg<R>()) are
+// dropped
+template <typename B, typename R>
+void Decoder_LDPC_BP_layered_ONMS_intra<B,R>
+::store_rot(const mipp::Reg<R> r, R *blk, const int k, const int shift) const
+{
+	auto start = k + shift;
+	if (start >= this->Z) start -= this->Z;
+
+	const auto n_lanes = std::min(mipp::nElReg<R>(), this->Z - k);
+	if (n_lanes == mipp::nElReg<R>() && start + mipp::nElReg<R>() <= this->Z)
+		r.storeu(blk + start);
+	else
+	{
+		R tmp[mipp::nElReg<R>()];
+		r.storeu(tmp);
+		for (auto l = 0; l < n_lanes; l++)
+			blk[(start + l) % this->Z] = tmp[l];
+	}
+}
+
+template <typename B, typename R>
+bool Decoder_LDPC_BP_layered_ONMS_intra<B,R>
+::check_syndrome(const int frame_id)
+{
+	const auto var_nodes = this->var_nodes[frame_id].data();
+
+	for (auto l = 0; l < this->n_layers; l++)
+	{
+		for (auto c = 0; c < this->n_chunks; c++)
+		{
+			const auto k = c * mipp::nElReg<R>();
+
+			// the sign bit of the xor of the values is the parity of the hard decisions
+			auto parity = mipp::Reg<R>((R)0);
+			for (auto b = this->layer_offsets[l]; b < this->layer_offsets[l +1]; b++)
+				parity ^= this->load_rot(var_nodes + this->blocks_VN[b], k, this->blocks_shift[b]);
+
+			const auto n_lanes = std::min(mipp::nElReg<R>(), this->Z - k);
+			if (n_lanes == mipp::nElReg<R>())
+			{
+				if (!mipp::testz(mipp::sign(parity)))
+					return false;
+			}
+			else
+			{
+				R tmp[mipp::nElReg<R>()];
+				parity.storeu(tmp);
+				for (auto i = 0; i < n_lanes; i++)
+					if (std::signbit((float)tmp[i]))
+						return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+// BP algorithm
+template <typename B, typename R>
+template <int F>
+void Decoder_LDPC_BP_layered_ONMS_intra<B,R>
+::BP_process(R *var_nodes, mipp::vector<mipp::Reg<R>> &branches)
+{
+	const auto zero_msk = mipp::Msk<mipp::N<R>()>(false);
+	const auto zero     = mipp::Reg<R>((R)0);
+	for (auto l = 0; l < this->n_layers; l++)
+	{
+		const auto first = this->layer_offsets[l];
+		const auto n_VN  = (int)(this->layer_offsets[l +1] - first);
+
+		// the check nodes of a layer do not share any variable node: they are updated independently, one SIMD
+		// register at a time
+		for (auto c = 0; c < this->n_chunks; c++)
+		{
+			const auto k = c * mipp::nElReg<R>();
+
+			auto sign = zero_msk;
+			auto min1 = mipp::Reg<R>(std::numeric_limits<R>::max());
+			auto min2 = mipp::Reg<R>(std::numeric_limits<R>::max());
+
+			for (auto j = 0; j < n_VN; j++)
+			{
+				const auto b = first + j;
+				contributions[j]  = this->load_rot(var_nodes + this->blocks_VN[b], k, this->blocks_shift[b])
+				                  - branches[b * this->n_chunks + c];
+				const auto v_abs  = mipp::abs (contributions[j]);
+				const auto c_sign = mipp::sign(contributions[j]);
+				const auto v_temp = min1;
+
+				sign ^= c_sign;
+				min1  = mipp::min(min1,           v_abs         );
+				min2  = mipp::min(min2, mipp::max(v_abs, v_temp));
+			}
+
+			auto cste1 = tools::simd_sat<R>(tools::simd_normalize<R,F>(min2 - offset, normalize_factor), saturation);
+			auto cste2 = tools::simd_sat<R>(tools::simd_normalize<R,F>(min1 - offset, normalize_factor), saturation);
+
+			cste1 = mipp::blend(zero, cste1, zero > cste1);
+			cste2 = mipp::blend(zero, cste2, zero > cste2);
+
+			for (auto j = 0; j < n_VN; j++)
+			{
+				const auto b     = first + j;
+				const auto value = contributions[j];
+				const auto v_abs = mipp::abs(value);
+				      auto v_res = mipp::blend(cste1, cste2, v_abs == min1);
+				const auto v_sig = sign ^ mipp::sign(value);
+				           v_res = mipp::copysign(v_res, v_sig);
+
+				branches[b * this->n_chunks + c] = v_res;
+				this->store_rot(contributions[j] + v_res, var_nodes + this->blocks_VN[b], k, this->blocks_shift[b]);
+			}
+		}
+	}
+}
+
+// ==================================================================================== explicit template instantiation 
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::module::Decoder_LDPC_BP_layered_ONMS_intra<B_8,Q_8>;
+template class aff3ct::module::Decoder_LDPC_BP_layered_ONMS_intra<B_16,Q_16>;
+template class aff3ct::module::Decoder_LDPC_BP_layered_ONMS_intra<B_32,Q_32>;
+template class aff3ct::module::Decoder_LDPC_BP_layered_ONMS_intra<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_LDPC_BP_layered_ONMS_intra<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
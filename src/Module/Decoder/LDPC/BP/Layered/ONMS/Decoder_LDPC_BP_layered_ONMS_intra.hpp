@@ -0,0 +1,88 @@
+#ifndef DECODER_LDPC_BP_LAYERED_ONMS_INTRA_HPP_
+#define DECODER_LDPC_BP_LAYERED_ONMS_INTRA_HPP_
+
+#include <vector>
+#include <mipp.h>
+
+#include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
+
+#include "../../Decoder_LDPC_BP.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*
+ * Layered offset normalized min-sum decoder for quasi-cyclic (QC) LDPC codes, vectorized inside a single frame.
+ * The QC structure (base matrix and lifting factor Z) is recovered from H: the Z check nodes of a layer are
+ * independent so they are processed in the lanes of the SIMD registers, the variable nodes of each circulant block
+ * being read and written with the block shift (circular-shift loads and stores). Contrary to the inter-frame decoder
+ * there is no need to batch mipp::nElReg<R>() frames, which gives a much lower latency.
+ */
+template <typename B = int, typename R = float>
+class Decoder_LDPC_BP_layered_ONMS_intra : public Decoder_LDPC_BP<B,R>
+{
+private:
+	const float normalize_factor;
+	const R offset;
+	mipp::vector<mipp::Reg<R>> contributions;
+
+protected:
+	const R saturation;
+	const int n_C_nodes; // number of check nodes (= N - K)
+	const int Z;         // lifting factor (= number of check nodes per layer)
+	const int n_layers;  // number of layers (= n_C_nodes / Z)
+	const int n_chunks;  // number of SIMD registers to process the Z check nodes of a layer
+
+	// reset so C_to_V and V_to_C structures can be cleared only at the beginning of the loop in iterative decoding
+	bool init_flag;
+
+	const std::vector<unsigned> &info_bits_pos;
+
+	// base graph: the circulant blocks of the layer 'l' are in [layer_offsets[l], layer_offsets[l +1])
+	std::vector<unsigned> layer_offsets;
+	std::vector<unsigned> blocks_VN;     // first variable node of each circulant block (= j * Z)
+	std::vector<unsigned> blocks_shift;  // shift of each circulant block
+
+	// data structures for iterative decoding
+	std::vector<mipp::vector<R>>            var_nodes;
+	std::vector<mipp::vector<mipp::Reg<R>>> branches; // 'n_chunks' registers per circulant block
+
+public:
+	Decoder_LDPC_BP_layered_ONMS_intra(const int K, const int N, const int n_ite,
+	                                   const tools::Sparse_matrix &H,
+	                                   const std::vector<unsigned> &info_bits_pos,
+	                                   const float normalize_factor = 1.f,
+	                                   const R offset = (R)0,
+	                                   const bool enable_syndrome = true,
+	                                   const int syndrome_depth = 1,
+	                                   const int n_frames = 1);
+	virtual ~Decoder_LDPC_BP_layered_ONMS_intra();
+
+	void reset();
+
+protected:
+	void _load          (const R *Y_N,           const int frame_id);
+	void _decode_siso   (const R *Y_N1, R *Y_N2, const int frame_id);
+	void _decode_siho   (const R *Y_N,  B *V_K,  const int frame_id);
+	void _decode_siho_cw(const R *Y_N,  B *V_N,  const int frame_id);
+
+	// BP functions for decoding
+	void BP_decode(const int frame_id);
+
+	template <int F = 1>
+	void _BP_decode(const int frame_id);
+
+	bool check_syndrome(const int frame_id);
+
+	template <int F = 1>
+	void BP_process(R *var_nodes, mipp::vector<mipp::Reg<R>> &branches);
+
+private:
+	inline mipp::Reg<R> load_rot (const R *blk, const int k, const int shift) const;
+	inline void         store_rot(const mipp::Reg<R> r, R *blk, const int k, const int shift) const;
+};
+}
+}
+
+#endif /* DECODER_LDPC_BP_LAYERED_ONMS_INTRA_HPP_ */
@@ -23,11 +23,16 @@ public:
 	                                                 const R offset = (R)0,
 	                                                 const bool enable_syndrome = true,
 	                                                 const int syndrome_depth = 1,
-	                                                 const int n_frames = 1);
+	                                                 const int n_frames = 1,
+	                                                 const bool compress_msg = false,
+	                                                 const int stable_depth = 0);
 	virtual ~Decoder_LDPC_BP_layered_offset_normalize_min_sum();
 
 protected:
+	void BP_process_frame(const int frame_id);
 	void BP_process(std::vector<R> &var_nodes, std::vector<R> &branches);
+	void BP_process_compressed(std::vector<R> &var_nodes, std::vector<R> &CN_mags, std::vector<uint16_t> &CN_min_pos,
+	                           std::vector<uint32_t> &CN_signs);
 };
 
 template <typename B = int, typename R = float>
@@ -17,9 +17,10 @@ Decoder_LDPC_BP_layered_sum_product<B,R>
                                       const std::vector<unsigned> &info_bits_pos,
                                       const bool enable_syndrome,
                                       const int syndrome_depth,
-                                      const int n_frames)
+                                      const int n_frames,
+                                      const int stable_depth)
 : Decoder(K, N, n_frames, 1),
-  Decoder_LDPC_BP_layered<B,R>(K, N, n_ite, H, info_bits_pos, enable_syndrome, syndrome_depth, n_frames),
+  Decoder_LDPC_BP_layered<B,R>(K, N, n_ite, H, info_bits_pos, enable_syndrome, syndrome_depth, n_frames, false, stable_depth),
   contributions(H.get_cols_max_degree()), values(H.get_cols_max_degree())
 {
 	const std::string name = "Decoder_LDPC_BP_layered_sum_product";
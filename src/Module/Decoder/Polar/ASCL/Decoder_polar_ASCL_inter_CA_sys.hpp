@@ -0,0 +1,55 @@
+#ifndef DECODER_POLAR_ASCL_INTER_CA_SYS_
+#define DECODER_POLAR_ASCL_INTER_CA_SYS_
+
+#include <memory>
+#include <vector>
+
+#include "Module/CRC/CRC.hpp"
+
+#include "../SCL/CRC/Decoder_polar_SCL_inter_CA_sys.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*
+ * Adaptive version of 'Decoder_polar_SCL_inter_CA_sys': the frames are first decoded with a list of size 1 (SC) and
+ * the list size is increased (doubled in full adaptive mode, set to 'L_max' in partial adaptive mode) as long as the
+ * CRC is not verified in at least one of the lanes. Each lane keeps the result of the first decoding that verifies its
+ * CRC (or the one of the largest list), like the scalar 'Decoder_polar_ASCL_fast_CA_sys' does for each frame.
+ */
+template <typename B = int, typename R = float>
+class Decoder_polar_ASCL_inter_CA_sys : public Decoder_polar_SCL_inter_CA_sys<B,R>
+{
+private:
+	const int  L_max;
+	const bool is_full_adaptive;
+
+	// decoders with the smaller list sizes (1, then 2, 4, ..., L_max/2 in full adaptive mode)
+	std::vector<std::unique_ptr<Decoder_polar_SCL_inter_CA_sys<B,R>>> sub_decoders;
+
+	std::vector<Decoder_polar_SCL_inter_CA_sys<B,R>*> decoders;  // sub_decoders + this, by increasing list size
+	std::vector<Decoder_polar_SCL_inter_CA_sys<B,R>*> lane_dec;  // decoder whose result is kept in each lane
+	std::vector<B>                                    V_tmp;
+
+public:
+	Decoder_polar_ASCL_inter_CA_sys(const int& K, const int& N, const int& L_max, const std::vector<bool>& frozen_bits,
+	                                CRC<B>& crc, const bool is_full_adaptive = true, const int n_frames = 1);
+
+	virtual ~Decoder_polar_ASCL_inter_CA_sys() {}
+
+	virtual void notify_frozenbits_update();
+
+protected:
+	void _decode        (const R *Y_N                              );
+	void _decode_siho   (const R *Y_N, B *V_K, const int frame_id);
+	void _decode_siho_cw(const R *Y_N, B *V_N, const int frame_id);
+
+	void store_lanes(B *V, const int size, const bool cw);
+};
+}
+}
+
+#include "Decoder_polar_ASCL_inter_CA_sys.hxx"
+
+#endif /* DECODER_POLAR_ASCL_INTER_CA_SYS_ */
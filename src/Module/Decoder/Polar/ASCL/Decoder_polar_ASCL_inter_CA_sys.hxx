@@ -0,0 +1,104 @@
+#include <algorithm>
+
+#include "Decoder_polar_ASCL_inter_CA_sys.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R>
+Decoder_polar_ASCL_inter_CA_sys<B,R>
+::Decoder_polar_ASCL_inter_CA_sys(const int& K, const int& N, const int& L_max, const std::vector<bool>& frozen_bits,
+                                  CRC<B>& crc, const bool is_full_adaptive, const int n_frames)
+: Decoder(K, N, n_frames, mipp::nElReg<R>()),
+  Decoder_polar_SCL_inter_CA_sys<B,R>(K, N, L_max, frozen_bits, crc, n_frames),
+  L_max(L_max), is_full_adaptive(is_full_adaptive),
+  lane_dec(mipp::nElReg<R>(), nullptr),
+  V_tmp(mipp::nElReg<R>() * N)
+{
+	const std::string name = "Decoder_polar_ASCL_inter_CA_sys";
+	this->set_name(name);
+
+	for (auto L = 1; L < L_max; L = is_full_adaptive ? L << 1 : L_max)
+		sub_decoders.push_back(std::unique_ptr<Decoder_polar_SCL_inter_CA_sys<B,R>>(
+			new Decoder_polar_SCL_inter_CA_sys<B,R>(K, N, L, frozen_bits, crc, n_frames)));
+
+	for (auto &d : sub_decoders)
+		decoders.push_back(d.get());
+	decoders.push_back(this);
+}
+
+template <typename B, typename R>
+void Decoder_polar_ASCL_inter_CA_sys<B,R>
+::notify_frozenbits_update()
+{
+	Decoder_polar_SCL_inter_CA_sys<B,R>::notify_frozenbits_update();
+	for (auto &d : sub_decoders)
+		d->notify_frozenbits_update();
+}
+
+template <typename B, typename R>
+void Decoder_polar_ASCL_inter_CA_sys<B,R>
+::_decode(const R *Y_N)
+{
+	std::fill(lane_dec.begin(), lane_dec.end(), nullptr);
+
+	auto n_pending = this->n_lanes;
+	for (auto d = 0; d < (int)decoders.size() && n_pending > 0; d++)
+	{
+		auto &dec = *decoders[d];
+
+		dec.init_buffers();
+		dec._load(Y_N);
+		dec.recursive_decode(dec.m, 0, 0);
+		dec.select_best_path();
+
+		// the last decoder (largest list) takes all the remaining lanes
+		for (auto f = 0; f < this->n_lanes; f++)
+			if (lane_dec[f] == nullptr && (&dec == this || dec.crc_check(dec.best_path[f], f)))
+			{
+				lane_dec[f] = &dec;
+				n_pending--;
+			}
+	}
+}
+
+template <typename B, typename R>
+void Decoder_polar_ASCL_inter_CA_sys<B,R>
+::store_lanes(B *V, const int size, const bool cw)
+{
+	for (auto dec : decoders)
+	{
+		const auto n_lanes_dec = (int)std::count(lane_dec.begin(), lane_dec.end(), dec);
+		if (n_lanes_dec == 0)
+			continue;
+
+		// all the lanes come from the same decoder: no need for the temporary buffer
+		auto *V_dec = (n_lanes_dec == this->n_lanes) ? V : V_tmp.data();
+		if (cw) dec->_store_cw(V_dec);
+		else    dec->_store   (V_dec);
+
+		if (V_dec != V)
+			for (auto f = 0; f < this->n_lanes; f++)
+				if (lane_dec[f] == dec)
+					std::copy(V_dec + f * size, V_dec + (f +1) * size, V + f * size);
+	}
+}
+
+template <typename B, typename R>
+void Decoder_polar_ASCL_inter_CA_sys<B,R>
+::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+	this->_decode(Y_N);
+	this->store_lanes(V_K, this->K, false);
+}
+
+template <typename B, typename R>
+void Decoder_polar_ASCL_inter_CA_sys<B,R>
+::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
+{
+	this->_decode(Y_N);
+	this->store_lanes(V_N, this->N, true);
+}
+}
+}
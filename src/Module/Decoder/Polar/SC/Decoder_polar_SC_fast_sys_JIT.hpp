@@ -0,0 +1,93 @@
+#ifndef DECODER_POLAR_SC_FAST_SYS_JIT_
+#define DECODER_POLAR_SC_FAST_SYS_JIT_
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <ostream>
+
+#include "Decoder_polar_SC_fast_sys.hpp"
+
+// flags of AFF3CT, defined by CMake
+#ifndef AFF3CT_JIT_FLAGS
+#define AFF3CT_JIT_FLAGS "-O3 -march=native"
+#endif
+
+namespace aff3ct
+{
+namespace module
+{
+/*
+ * SC decoder specialized at runtime for the current (N, frozen bits): the decoding tree is unrolled into C++ code
+ * calling the static version of the polar API (all the sizes and offsets are constants), compiled into a shared
+ * object in 'jit_dir' by the system compiler and loaded with 'dlopen'. The shared objects are reused between the runs
+ * (the file name is a hash of the generated code, of the compilation command and of the AFF3CT version). When the code
+ * can't be compiled or loaded (no compiler, not a POSIX system, API without static version, SIMD instructions different
+ * from the caller ones, ...) the decoder falls back on the generic 'Decoder_polar_SC_fast_sys' decoding. 'jit_dir' is
+ * created private to the user: the directory and the shared objects that are not owned by the current user or that are
+ * writable by the other users are never loaded.
+ */
+template <typename B = int, typename R = float,
+          class API_polar = tools::API_polar_dynamic_seq<B, R, tools::f_LLR <  R>,
+                                                               tools::g_LLR <B,R>,
+                                                               tools::g0_LLR<  R>,
+                                                               tools::h_LLR <B,R>,
+                                                               tools::xo_STD<B  >>>
+class Decoder_polar_SC_fast_sys_JIT : public Decoder_polar_SC_fast_sys<B,R,API_polar>
+{
+protected:
+	using decode_fn  = void        (*)(void *l, void *s);
+	using n_elmts_fn = int         (*)();
+	using isa_fn     = const char* (*)();
+
+	const std::string jit_dir;      // directory of the generated sources and of the shared objects
+	const std::string jit_cxx;      // compiler command
+	const std::string jit_flags;    // compilation flags (have to generate the same SIMD code than the caller)
+	const std::string jit_includes; // include directories of AFF3CT and MIPP ("-I<dir> -I<dir>")
+
+	std::shared_ptr<void> jit_lib;    // handle of the loaded shared object
+	decode_fn             jit_decode; // nullptr when the generic decoding is used
+
+public:
+	Decoder_polar_SC_fast_sys_JIT(const int& K, const int& N, const std::vector<bool>& frozen_bits,
+	                              const std::string &jit_dir,
+	                              const std::string &jit_cxx   = "c++",
+	                              const std::string &jit_flags = "",
+	                              const int n_frames = 1);
+
+	Decoder_polar_SC_fast_sys_JIT(const int& K, const int& N, const std::vector<bool>& frozen_bits,
+	                              const std::vector<tools::Pattern_polar_i*> &polar_patterns,
+	                              const int idx_r0, const int idx_r1,
+	                              const std::string &jit_dir,
+	                              const std::string &jit_cxx   = "c++",
+	                              const std::string &jit_flags = "",
+	                              const int n_frames = 1);
+
+	virtual ~Decoder_polar_SC_fast_sys_JIT();
+
+	virtual void notify_frozenbits_update();
+
+	bool is_jit() const;
+
+	// default include directories, deduced from the location of the AFF3CT sources at build time
+	static std::string default_includes();
+
+	// default compilation flags (used when 'jit_flags' is empty), the flags of AFF3CT
+	static std::string default_flags();
+
+protected:
+	virtual void _decode();
+
+	void jit_load();
+
+	// write the source of the specialized decoder, return false if the API has no static version
+	bool generate(std::ostream &stream) const;
+	void generate(std::ostream &stream, const int off_l, const int off_s, const int reverse_depth,
+	              int &node_id) const;
+};
+}
+}
+
+#include "Decoder_polar_SC_fast_sys_JIT.hxx"
+
+#endif /* DECODER_POLAR_SC_FAST_SYS_JIT_ */
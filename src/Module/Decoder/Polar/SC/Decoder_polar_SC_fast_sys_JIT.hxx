@@ -0,0 +1,528 @@
+#if defined(__unix__) || defined(__unix) || defined(__APPLE__)
+#define POLAR_JIT_DLOPEN
+#include <dlfcn.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#endif
+
+#include <map>
+#include <mutex>
+#include <atomic>
+#include <cstdio>
+#include <cctype>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <iostream>
+#include <type_traits>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Display/bash_tools.h"
+#include "Tools/system_functions.h"
+#include "Tools/version.h"
+
+#include "Tools/Code/Polar/API/API_polar_dynamic_seq.hpp"
+#include "Tools/Code/Polar/API/API_polar_dynamic_intra.hpp"
+#include "Tools/Code/Polar/API/API_polar_dynamic_inter.hpp"
+#include "Tools/Code/Polar/API/API_polar_dynamic_inter_8bit_bitpacking.hpp"
+#include "Tools/Code/Polar/API/API_polar_static_seq.hpp"
+#include "Tools/Code/Polar/API/API_polar_static_intra_8bit.hpp"
+#include "Tools/Code/Polar/API/API_polar_static_intra_16bit.hpp"
+#include "Tools/Code/Polar/API/API_polar_static_intra_32bit.hpp"
+#include "Tools/Code/Polar/API/API_polar_static_inter.hpp"
+#include "Tools/Code/Polar/API/API_polar_static_inter_8bit_bitpacking.hpp"
+
+#include "Decoder_polar_SC_fast_sys_JIT.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+// name of the static API used in the generated code ("" when the API has no static version, for instance with non
+// default 'f', 'g', ... functions)
+template <class API_polar>
+struct Decoder_polar_SC_fast_sys_JIT_API
+{
+	static std::string name() { return ""; }
+};
+
+template <typename B, typename R>
+struct Decoder_polar_SC_fast_sys_JIT_API<tools::API_polar_dynamic_seq<B,R>>
+{
+	static std::string name() { return "API_polar_static_seq"; }
+};
+
+template <typename B, typename R>
+struct Decoder_polar_SC_fast_sys_JIT_API<tools::API_polar_static_seq<B,R>>
+{
+	static std::string name() { return "API_polar_static_seq"; }
+};
+
+template <typename B, typename R>
+struct Decoder_polar_SC_fast_sys_JIT_API<tools::API_polar_dynamic_intra<B,R>>
+{
+	static std::string name()
+	{
+		switch (sizeof(B))
+		{
+			case 1: return "API_polar_static_intra_8bit";
+			case 2: return "API_polar_static_intra_16bit";
+			case 4: return "API_polar_static_intra_32bit";
+			default:
+				return "";
+		}
+	}
+};
+
+template <typename B, typename R>
+struct Decoder_polar_SC_fast_sys_JIT_API<tools::API_polar_static_intra_8bit<B,R>>
+{
+	static std::string name() { return "API_polar_static_intra_8bit"; }
+};
+
+template <typename B, typename R>
+struct Decoder_polar_SC_fast_sys_JIT_API<tools::API_polar_static_intra_16bit<B,R>>
+{
+	static std::string name() { return "API_polar_static_intra_16bit"; }
+};
+
+template <typename B, typename R>
+struct Decoder_polar_SC_fast_sys_JIT_API<tools::API_polar_static_intra_32bit<B,R>>
+{
+	static std::string name() { return "API_polar_static_intra_32bit"; }
+};
+
+template <typename B, typename R>
+struct Decoder_polar_SC_fast_sys_JIT_API<tools::API_polar_dynamic_inter<B,R>>
+{
+	static std::string name() { return "API_polar_static_inter"; }
+};
+
+template <typename B, typename R>
+struct Decoder_polar_SC_fast_sys_JIT_API<tools::API_polar_static_inter<B,R>>
+{
+	static std::string name() { return "API_polar_static_inter"; }
+};
+
+template <typename B, typename R>
+struct Decoder_polar_SC_fast_sys_JIT_API<tools::API_polar_dynamic_inter_8bit_bitpacking<B,R>>
+{
+	static std::string name() { return "API_polar_static_inter_8bit_bitpacking"; }
+};
+
+template <typename B, typename R>
+struct Decoder_polar_SC_fast_sys_JIT_API<tools::API_polar_static_inter_8bit_bitpacking<B,R>>
+{
+	static std::string name() { return "API_polar_static_inter_8bit_bitpacking"; }
+};
+
+template <typename T>
+std::string polar_jit_type_name()
+{
+	     if (std::is_same<T,int8_t >::value) return "int8_t";
+	else if (std::is_same<T,int16_t>::value) return "int16_t";
+	else if (std::is_same<T,int32_t>::value) return "int32_t";
+	else if (std::is_same<T,int64_t>::value) return "int64_t";
+	else if (std::is_same<T,float  >::value) return "float";
+	else if (std::is_same<T,double >::value) return "double";
+	else                                     return "";
+}
+
+template <typename B, typename R, class API_polar>
+Decoder_polar_SC_fast_sys_JIT<B,R,API_polar>
+::Decoder_polar_SC_fast_sys_JIT(const int& K, const int& N, const std::vector<bool>& frozen_bits,
+                                const std::string &jit_dir, const std::string &jit_cxx, const std::string &jit_flags,
+                                const int n_frames)
+: Decoder(K, N, n_frames, API_polar::get_n_frames()),
+  Decoder_polar_SC_fast_sys<B,R,API_polar>(K, N, frozen_bits, n_frames),
+  jit_dir     (jit_dir),
+  jit_cxx     (jit_cxx),
+  jit_flags   (jit_flags.empty() ? default_flags() : jit_flags),
+  jit_includes(default_includes()),
+  jit_lib     (nullptr),
+  jit_decode  (nullptr)
+{
+	const std::string name = "Decoder_polar_SC_fast_sys_JIT";
+	this->set_name(name);
+}
+
+template <typename B, typename R, class API_polar>
+Decoder_polar_SC_fast_sys_JIT<B,R,API_polar>
+::Decoder_polar_SC_fast_sys_JIT(const int& K, const int& N, const std::vector<bool>& frozen_bits,
+                                const std::vector<tools::Pattern_polar_i*> &polar_patterns,
+                                const int idx_r0, const int idx_r1,
+                                const std::string &jit_dir, const std::string &jit_cxx, const std::string &jit_flags,
+                                const int n_frames)
+: Decoder(K, N, n_frames, API_polar::get_n_frames()),
+  Decoder_polar_SC_fast_sys<B,R,API_polar>(K, N, frozen_bits, polar_patterns, idx_r0, idx_r1, n_frames),
+  jit_dir     (jit_dir),
+  jit_cxx     (jit_cxx),
+  jit_flags   (jit_flags.empty() ? default_flags() : jit_flags),
+  jit_includes(default_includes()),
+  jit_lib     (nullptr),
+  jit_decode  (nullptr)
+{
+	const std::string name = "Decoder_polar_SC_fast_sys_JIT";
+	this->set_name(name);
+}
+
+template <typename B, typename R, class API_polar>
+Decoder_polar_SC_fast_sys_JIT<B,R,API_polar>
+::~Decoder_polar_SC_fast_sys_JIT()
+{
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SC_fast_sys_JIT<B,R,API_polar>
+::notify_frozenbits_update()
+{
+	Decoder_polar_SC_fast_sys<B,R,API_polar>::notify_frozenbits_update();
+	this->jit_load();
+}
+
+template <typename B, typename R, class API_polar>
+bool Decoder_polar_SC_fast_sys_JIT<B,R,API_polar>
+::is_jit() const
+{
+	return this->jit_decode != nullptr;
+}
+
+template <typename B, typename R, class API_polar>
+std::string Decoder_polar_SC_fast_sys_JIT<B,R,API_polar>
+::default_includes()
+{
+	// this file is in '<src>/Module/Decoder/Polar/SC/' and MIPP in '<src>/../lib/MIPP/src/'
+	const std::string file   = __FILE__;
+	const std::string suffix = "Module/Decoder/Polar/SC/Decoder_polar_SC_fast_sys_JIT.hxx";
+
+	const auto pos = file.rfind(suffix);
+	if (pos == std::string::npos)
+		return "";
+
+	const auto src = file.substr(0, pos);
+	return "-I\"" + src + "\" -I\"" + src + "../lib/MIPP/src/\"";
+}
+
+template <typename B, typename R, class API_polar>
+std::string Decoder_polar_SC_fast_sys_JIT<B,R,API_polar>
+::default_flags()
+{
+	return AFF3CT_JIT_FLAGS;
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SC_fast_sys_JIT<B,R,API_polar>
+::_decode()
+{
+	if (this->jit_decode != nullptr)
+		this->jit_decode((void*)&this->l, (void*)&this->s);
+	else
+		Decoder_polar_SC_fast_sys<B,R,API_polar>::_decode();
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SC_fast_sys_JIT<B,R,API_polar>
+::jit_load()
+{
+	this->jit_decode = nullptr;
+	this->jit_lib    = nullptr;
+
+#ifdef POLAR_JIT_DLOPEN
+	// one entry per shared object: the decoders of the different threads wait for the first one compiling the same
+	// code, the other shared objects are compiled in parallel
+	struct Entry
+	{
+		std::mutex          mutex;
+		std::weak_ptr<void> lib;           // shared object loaded in the process
+		bool                warned = false; // the failure of this shared object has already been reported
+	};
+
+	static std::mutex                                    mutex_entries;
+	static std::map<std::string, std::shared_ptr<Entry>> entries;
+	static std::atomic<bool>                             warned_no_static_api(false);
+
+	std::stringstream source;
+	if (!this->generate(source))
+	{
+		if (!warned_no_static_api.exchange(true))
+			std::clog << tools::format_warning("The polar SC decoder can't be compiled at runtime, the generic decoder "
+			                                   "is used (the polar API has no static version).") << std::endl;
+		return;
+	}
+
+	const auto cmd = jit_cxx + " " + jit_flags + " -std=c++11 -shared -fPIC " + jit_includes;
+
+	// FNV-1a hash of the generated code, of the compilation command and of the AFF3CT version (the included headers
+	// change with the version)
+	uint64_t hash = 14695981039346656037ull;
+	for (auto c : source.str() + cmd + version() + sha1())
+	{
+		hash ^= (uint64_t)(unsigned char)c;
+		hash *= 1099511628211ull;
+	}
+
+	std::stringstream key;
+	key << "polar_sc_" << std::hex << std::setw(16) << std::setfill('0') << hash;
+	const auto cpp_filename = jit_dir + "/" + key.str() + ".cpp";
+	const auto lib_filename = jit_dir + "/" + key.str() + ".so";
+
+	std::shared_ptr<Entry> entry;
+	{
+		std::lock_guard<std::mutex> lock(mutex_entries);
+		auto &e = entries[lib_filename];
+		if (e == nullptr)
+			e = std::make_shared<Entry>();
+		entry = e;
+	}
+
+	std::lock_guard<std::mutex> lock(entry->mutex);
+
+	// each failure is reported once per shared object
+	auto warn = [&](const std::string &message)
+	{
+		if (!entry->warned)
+			std::clog << tools::format_warning("The polar SC decoder can't be compiled at runtime, the generic decoder "
+			                                   "is used (" + message + ").") << std::endl;
+		entry->warned = true;
+	};
+
+	// a file writable by an other user could be replaced by any code, it is never loaded
+	auto is_safe = [](const std::string &path, const bool is_dir)
+	{
+		struct stat st;
+		return lstat(path.c_str(), &st) == 0 && (is_dir ? S_ISDIR(st.st_mode) : S_ISREG(st.st_mode)) &&
+		       st.st_uid == geteuid() && !(st.st_mode & (S_IWGRP | S_IWOTH));
+	};
+
+	auto lib = entry->lib.lock();
+	if (lib == nullptr)
+	{
+		mkdir(jit_dir.c_str(), S_IRWXU);
+		if (!is_safe(jit_dir, true))
+		{
+			warn("'" + jit_dir + "' is not a directory owned by the current user and not writable by the other "
+			     "users");
+			return;
+		}
+
+		// a shared object that can't be trusted is compiled again
+		if (std::ifstream(lib_filename) && !is_safe(lib_filename, false))
+			std::remove(lib_filename.c_str());
+
+		if (!std::ifstream(lib_filename))
+		{
+
+			// the '.cpp' file name is unique in the process (per-key lock) but not between the processes
+			const auto pid_suffix = ".tmp" + std::to_string((unsigned long long)getpid());
+			const auto tmp_cpp_filename = cpp_filename + pid_suffix;
+
+			std::ofstream cpp_file(tmp_cpp_filename, std::ios::out | std::ios::trunc);
+			cpp_file << source.str();
+			cpp_file.close();
+			if (!cpp_file || std::rename(tmp_cpp_filename.c_str(), cpp_filename.c_str()) != 0)
+			{
+				std::remove(tmp_cpp_filename.c_str());
+				warn("can't write '" + cpp_filename + "'");
+				return;
+			}
+
+			// the shared object is compiled under a temporary name and renamed when complete: the other processes see
+			// the whole file or nothing
+			const auto tmp_filename = lib_filename + pid_suffix;
+
+			std::string output;
+			try
+			{
+				output = tools::runSystemCommand(cmd + " -o \"" + tmp_filename + "\" \"" + cpp_filename + "\"");
+			}
+			catch (std::exception const&)
+			{
+				warn("can't run '" + jit_cxx + "'");
+				return;
+			}
+
+			if (!std::ifstream(tmp_filename) || std::rename(tmp_filename.c_str(), lib_filename.c_str()) != 0)
+			{
+				std::remove(tmp_filename.c_str());
+				while (!output.empty() && std::isspace((unsigned char)output.back()))
+					output.pop_back();
+				warn("'" + cmd + "' failed: " + output);
+				return;
+			}
+		}
+
+		auto handle = dlopen(lib_filename.c_str(), RTLD_NOW | RTLD_LOCAL);
+		if (handle == nullptr)
+		{
+			const auto error = dlerror();
+			warn(error ? error : "can't load '" + lib_filename + "'");
+			return;
+		}
+
+		lib = std::shared_ptr<void>(handle, [](void *h) { dlclose(h); });
+		entry->lib = lib;
+	}
+
+	auto fn      = (decode_fn )dlsym(lib.get(), "aff3ct_polar_sc_decode" );
+	auto n_elmts = (n_elmts_fn)dlsym(lib.get(), "aff3ct_polar_sc_n_elmts");
+	auto isa     = (isa_fn    )dlsym(lib.get(), "aff3ct_polar_sc_isa"    );
+	if (fn == nullptr || n_elmts == nullptr || isa == nullptr)
+	{
+		warn("missing symbols in '" + lib_filename + "'");
+		return;
+	}
+
+	// the shared object and the caller have to use the same SIMD registers (same layout of 'l' and 's')
+	if (n_elmts() != mipp::nElReg<R>() || std::string(isa()) != mipp::InstructionFullType)
+	{
+		std::stringstream message;
+		message << "'" << lib_filename << "' uses the '" << isa() << "' instructions with " << n_elmts()
+		        << " elements per register instead of '" << mipp::InstructionFullType << "' with "
+		        << mipp::nElReg<R>() << ", check the compilation flags";
+		warn(message.str());
+		return;
+	}
+
+	this->jit_lib    = lib;
+	this->jit_decode = fn;
+#endif
+}
+
+template <typename B, typename R, class API_polar>
+bool Decoder_polar_SC_fast_sys_JIT<B,R,API_polar>
+::generate(std::ostream &stream) const
+{
+	const auto api    = Decoder_polar_SC_fast_sys_JIT_API<API_polar>::name();
+	const auto b_type = polar_jit_type_name<B>();
+	const auto r_type = polar_jit_type_name<R>();
+
+	if (api.empty() || b_type.empty() || r_type.empty())
+		return false;
+
+	stream << "// SC decoder generated by AFF3CT (N = " << this->N << ", K = " << this->K << ")"  << std::endl;
+	stream << "#include <cstdint>"                                                                 << std::endl;
+	stream << "#include <mipp.h>"                                                                  << std::endl;
+	stream << "#include \"Tools/Code/Polar/API/" << api << ".hpp\""                                << std::endl;
+	stream                                                                                         << std::endl;
+	stream << "using B = " << b_type << ";"                                                        << std::endl;
+	stream << "using R = " << r_type << ";"                                                        << std::endl;
+	stream << "using API_polar = aff3ct::tools::" << api << "<B,R>;"                               << std::endl;
+	stream                                                                                         << std::endl;
+	stream << "extern \"C\" int aff3ct_polar_sc_n_elmts() { return mipp::nElReg<R>(); }"           << std::endl;
+	stream << "extern \"C\" const char* aff3ct_polar_sc_isa() { return mipp::InstructionFullType.c_str(); }"
+	                                                                                               << std::endl;
+	stream                                                                                         << std::endl;
+	stream << "extern \"C\" void aff3ct_polar_sc_decode(void *l_ptr, void *s_ptr)"                 << std::endl;
+	stream << "{"                                                                                  << std::endl;
+	stream << "\tauto &l = *static_cast<mipp::vector<R>*>(l_ptr);"                                 << std::endl;
+	stream << "\tauto &s = *static_cast<mipp::vector<B>*>(s_ptr);"                                 << std::endl;
+	stream << "\t(void)l; (void)s;"                                                                << std::endl;
+	stream                                                                                         << std::endl;
+
+	int node_id = 0;
+	this->generate(stream, 0, 0, this->m, node_id);
+
+	stream << "}"                                                                                  << std::endl;
+
+	return true;
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SC_fast_sys_JIT<B,R,API_polar>
+::generate(std::ostream &stream, const int off_l, const int off_s, const int reverse_depth, int &node_id) const
+{
+	// same walk than 'Decoder_polar_SC_fast_sys::recursive_decode' but the calls are written instead of being made
+	const int n_elmts = 1 << reverse_depth;
+	const int n_elm_2 = n_elmts >> 1;
+	const auto node_type = this->polar_patterns.get_node_type(node_id);
+
+	const bool is_terminal_pattern = (node_type == tools::polar_node_t::RATE_0) ||
+	                                 (node_type == tools::polar_node_t::RATE_1) ||
+	                                 (node_type == tools::polar_node_t::REP)    ||
+	                                 (node_type == tools::polar_node_t::SPC);
+
+	const std::string api = "\tAPI_polar::template ";
+	const auto sz2 = "<" + std::to_string(n_elm_2) + ">";
+	const auto sz  = "<" + std::to_string(n_elmts) + ">";
+
+	if (!is_terminal_pattern && reverse_depth)
+	{
+		// f
+		switch (node_type)
+		{
+			case tools::STANDARD:
+			case tools::REP_LEFT:
+				stream << api << "f" << sz2 << "(l, " << off_l << ", " << off_l + n_elm_2 << ", " << off_l + n_elmts
+				       << ", " << n_elm_2 << ");" << std::endl;
+				break;
+			default:
+				break;
+		}
+
+		this->generate(stream, off_l + n_elmts, off_s, reverse_depth -1, ++node_id); // left
+
+		// g
+		switch (node_type)
+		{
+			case tools::STANDARD:
+				stream << api << "g" << sz2 << "(s, l, " << off_l << ", " << off_l + n_elm_2 << ", " << off_s << ", "
+				       << off_l + n_elmts << ", " << n_elm_2 << ");" << std::endl;
+				break;
+			case tools::RATE_0_LEFT:
+				stream << api << "g0" << sz2 << "(l, " << off_l << ", " << off_l + n_elm_2 << ", " << off_l + n_elmts
+				       << ", " << n_elm_2 << ");" << std::endl;
+				break;
+			case tools::REP_LEFT:
+				stream << api << "gr" << sz2 << "(s, l, " << off_l << ", " << off_l + n_elm_2 << ", " << off_s << ", "
+				       << off_l + n_elmts << ", " << n_elm_2 << ");" << std::endl;
+				break;
+			default:
+				break;
+		}
+
+		this->generate(stream, off_l + n_elmts, off_s + n_elm_2, reverse_depth -1, ++node_id); // right
+
+		// xor
+		switch (node_type)
+		{
+			case tools::STANDARD:
+			case tools::REP_LEFT:
+				stream << api << "xo" << sz2 << "(s, " << off_s << ", " << off_s + n_elm_2 << ", " << off_s << ", "
+				       << n_elm_2 << ");" << std::endl;
+				break;
+			case tools::RATE_0_LEFT:
+				stream << api << "xo0" << sz2 << "(s, " << off_s + n_elm_2 << ", " << off_s << ", " << n_elm_2
+				       << ");" << std::endl;
+				break;
+			default:
+				break;
+		}
+	}
+	else
+	{
+		// h
+		switch (node_type)
+		{
+			case tools::RATE_0:
+				stream << api << "h0" << sz << "(s, " << off_s << ", " << n_elmts << ");" << std::endl;
+				break;
+			case tools::RATE_1:
+				stream << api << "h" << sz << "(s, l, " << off_l << ", " << off_s << ", " << n_elmts << ");"
+				       << std::endl;
+				break;
+			case tools::REP:
+				stream << api << "rep" << sz << "(s, l, " << off_l << ", " << off_s << ", " << n_elmts << ");"
+				       << std::endl;
+				break;
+			case tools::SPC:
+				stream << api << "spc" << sz << "(s, l, " << off_l << ", " << off_s << ", " << n_elmts << ");"
+				       << std::endl;
+				break;
+			default:
+				break;
+		}
+	}
+}
+}
+}
@@ -0,0 +1,39 @@
+#ifndef DECODER_POLAR_SCL_INTER_CA_SYS_
+#define DECODER_POLAR_SCL_INTER_CA_SYS_
+
+#include <vector>
+
+#include "Module/CRC/CRC.hpp"
+
+#include "../Decoder_polar_SCL_inter_sys.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B = int, typename R = float>
+class Decoder_polar_SCL_inter_CA_sys : public Decoder_polar_SCL_inter_sys<B,R>
+{
+	friend Decoder_polar_ASCL_inter_CA_sys<B,R>;
+
+protected:
+	CRC<B>&          crc;
+	std::vector<B>   U_test;
+	std::vector<int> paths; // active paths of a lane sorted by metric
+
+public:
+	Decoder_polar_SCL_inter_CA_sys(const int& K, const int& N, const int& L, const std::vector<bool>& frozen_bits,
+	                               CRC<B>& crc, const int n_frames = 1);
+
+	virtual ~Decoder_polar_SCL_inter_CA_sys() {}
+
+protected:
+	        bool crc_check       (const int path, const int lane);
+	virtual void select_best_path(                               );
+};
+}
+}
+
+#include "Decoder_polar_SCL_inter_CA_sys.hxx"
+
+#endif /* DECODER_POLAR_SCL_INTER_CA_SYS_ */
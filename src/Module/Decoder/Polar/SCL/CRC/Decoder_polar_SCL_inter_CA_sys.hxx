@@ -0,0 +1,67 @@
+#include <algorithm>
+#include <numeric>
+#include <sstream>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Decoder_polar_SCL_inter_CA_sys.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R>
+Decoder_polar_SCL_inter_CA_sys<B,R>
+::Decoder_polar_SCL_inter_CA_sys(const int& K, const int& N, const int& L, const std::vector<bool>& frozen_bits,
+                                 CRC<B>& crc, const int n_frames)
+: Decoder(K, N, n_frames, mipp::nElReg<R>()),
+  Decoder_polar_SCL_inter_sys<B,R>(K, N, L, frozen_bits, n_frames),
+  crc(crc), U_test(K), paths(L)
+{
+	const std::string name = "Decoder_polar_SCL_inter_CA_sys";
+	this->set_name(name);
+
+	if (crc.get_size() > K)
+	{
+		std::stringstream message;
+		message << "'crc.get_size()' has to be equal or smaller than 'K' ('crc.get_size()' = " << crc.get_size()
+		        << ", 'K' = " << K << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+template <typename B, typename R>
+bool Decoder_polar_SCL_inter_CA_sys<B,R>
+::crc_check(const int path, const int lane)
+{
+	const auto *s_root = this->s[path].data() + this->off_s(this->m, 0);
+
+	auto k = 0;
+	for (auto i = 0; i < this->N; i++)
+		if (!this->frozen_bits[i])
+			U_test[k++] = s_root[i][lane] ? (B)1 : (B)0;
+
+	return crc.check(U_test.data(), 1);
+}
+
+template <typename B, typename R>
+void Decoder_polar_SCL_inter_CA_sys<B,R>
+::select_best_path()
+{
+	// in each lane, the best path is the most likely path that verifies the CRC (or the most likely path otherwise)
+	for (auto f = 0; f < this->n_lanes; f++)
+	{
+		std::iota(paths.begin(), paths.begin() + this->n_active_paths, 0);
+		std::stable_sort(paths.begin(), paths.begin() + this->n_active_paths,
+			[this, f](int x, int y){
+				return this->metrics[x][f] < this->metrics[y][f];
+			});
+
+		auto i = 0;
+		while (i < this->n_active_paths && !crc_check(paths[i], f)) i++;
+
+		this->best_path[f] = (i == this->n_active_paths) ? paths[0] : paths[i];
+	}
+}
+}
+}
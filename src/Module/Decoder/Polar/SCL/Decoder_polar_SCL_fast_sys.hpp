@@ -35,6 +35,7 @@ protected:
 	            std ::vector<R   >    metrics;        // path metrics
 	std::vector<mipp::vector<R   >>   l;              // llrs
 	std::vector<mipp::vector<B   >>   s;              // partial sums
+	std::vector<mipp::vector<B   >>   s2;             // saved left partial sums (read by the paths sharing them)
 	std::vector<std ::vector<R   >>   metrics_vec;    // list of candidate metrics to be sorted
 	            std ::vector<int >    dup_count;      // number of duplications of a path, at updating time
 	            std ::vector<int >    bit_flips;      // index of the bits to be flipped
@@ -46,6 +47,9 @@ protected:
 	// each following 2D vector is of size L * m
 	std::vector<std::vector<int>>     n_array_ref;    // number of times an array is used
 	std::vector<std::vector<int>>     path_2_array;   // give array used by a path
+	std::vector<std::vector<int>>     n_array_ref_s;  // number of times the left partial sums of an array are used
+	std::vector<std::vector<int>>     path_2_array_s; // give array containing the left partial sums of a path
+	            std ::vector<bool>    is_saved_s;     // true if the left partial sums of an array are saved in 's2'
 
 	tools::LC_sorter<R>               sorter;
 //	tools::LC_sorter_simd<R>          sorter_simd;
@@ -93,8 +97,11 @@ private:
 	inline void flip_bits_r1 (const int old_path, const int new_path, const int dup, const int off_s, const int n_elmts);
 	inline void flip_bits_spc(const int old_path, const int new_path, const int dup, const int off_s, const int n_elmts);
 
-	inline void erase_bad_paths (                                                                        );
-	inline int  duplicate_tree  (const int old_path, const int off_l, const int off_s, const int n_elmts ); // return the new_path
+	inline void erase_bad_paths  (                                                                        );
+	inline int  duplicate_tree   (const int old_path, const int off_l, const int off_s, const int n_elmts ); // return the new_path
+	inline void up_ref_left_array(const int r_d                                                           );
+	inline void copy_left        (const int r_d, const int off_s                                          );
+	inline void xo_paths         (const int r_d, const int off_s                                          );
 };
 }
 }
@@ -84,6 +84,7 @@ Decoder_polar_SCL_fast_sys<B,R,API_polar>
   metrics          (L),
   l                (L, mipp::vector<R>(N + mipp::nElReg<R>())),
   s                (L, mipp::vector<B>(N + mipp::nElReg<B>())),
+  s2               (L, mipp::vector<B>(N + mipp::nElReg<B>())),
   metrics_vec      (3, std::vector<R>()),
   dup_count        (L, 0),
   bit_flips        (4 * L),
@@ -92,6 +93,9 @@ Decoder_polar_SCL_fast_sys<B,R,API_polar>
   n_active_paths   (1),
   n_array_ref      (L, std::vector<int>(m)),
   path_2_array     (L, std::vector<int>(m)),
+  n_array_ref_s    (L, std::vector<int>(m)),
+  path_2_array_s   (L, std::vector<int>(m)),
+  is_saved_s       (L, false),
   sorter           (N),
 //sorter_simd      (N),
   best_idx         (L),
@@ -165,6 +169,7 @@ Decoder_polar_SCL_fast_sys<B,R,API_polar>
   metrics          (L),
   l                (L, mipp::vector<R>(N + mipp::nElReg<R>())),
   s                (L, mipp::vector<B>(N + mipp::nElReg<B>())),
+  s2               (L, mipp::vector<B>(N + mipp::nElReg<B>())),
   metrics_vec      (3, std::vector<R>()),
   dup_count        (L, 0),
   bit_flips        (4 * L),
@@ -173,6 +178,9 @@ Decoder_polar_SCL_fast_sys<B,R,API_polar>
   n_active_paths   (1),
   n_array_ref      (L, std::vector<int>(m)),
   path_2_array     (L, std::vector<int>(m)),
+  n_array_ref_s    (L, std::vector<int>(m)),
+  path_2_array_s   (L, std::vector<int>(m)),
+  is_saved_s       (L, false),
   sorter           (N),
 //sorter_simd      (N),
   best_idx         (L),
@@ -260,6 +268,13 @@ void Decoder_polar_SCL_fast_sys<B,R,API_polar>
 
 	for (auto i = 1; i < L; i++)
 		std::fill(n_array_ref[i].begin(), n_array_ref[i].end(), 0);
+
+	// the references to the left partial sums are set when the left children are decoded
+	for (auto i = 0; i < L; i++)
+	{
+		std::fill(n_array_ref_s [i].begin(), n_array_ref_s [i].end(), 0);
+		std::fill(path_2_array_s[i].begin(), path_2_array_s[i].end(), i);
+	}
 }
 
 template <typename B, typename R, class API_polar>
@@ -394,16 +409,14 @@ void Decoder_polar_SCL_fast_sys<B,R,API_polar>
 		switch (node_type)
 		{
 			case tools::STANDARD:
-				for (auto i = 0; i < n_active_paths; i++)
-					API_polar::xo (s[paths[i]], off_s, off_s + n_elm_2, off_s, n_elm_2);
+				xo_paths(rev_depth, off_s);
 				break;
 			case tools::RATE_0_LEFT:
 				for (auto i = 0; i < n_active_paths; i++)
-					API_polar::xo0(s[paths[i]],        off_s + n_elm_2, off_s, n_elm_2);
+					API_polar::xo0(s[paths[i]], off_s + n_elm_2, off_s, n_elm_2);
 				break;
 			case tools::REP_LEFT:
-				for (auto i = 0; i < n_active_paths; i++)
-					API_polar::xo (s[paths[i]], off_s, off_s + n_elm_2, off_s, n_elm_2);
+				xo_paths(rev_depth, off_s);
 				break;
 			default:
 				break;
@@ -487,16 +500,14 @@ void Decoder_polar_SCL_fast_sys<B,R,API_polar>
 		switch (node_type)
 		{
 			case tools::STANDARD:
-				for (auto i = 0; i < n_active_paths; i++)
-					API_polar::xo (s[paths[i]], off_s, off_s + n_elm_2, off_s, n_elm_2);
+				xo_paths(rev_depth, off_s);
 				break;
 			case tools::RATE_0_LEFT:
 				for (auto i = 0; i < n_active_paths; i++)
-					API_polar::xo0(s[paths[i]],        off_s + n_elm_2, off_s, n_elm_2);
+					API_polar::xo0(s[paths[i]], off_s + n_elm_2, off_s, n_elm_2);
 				break;
 			case tools::REP_LEFT:
-				for (auto i = 0; i < n_active_paths; i++)
-					API_polar::xo (s[paths[i]], off_s, off_s + n_elm_2, off_s, n_elm_2);
+				xo_paths(rev_depth, off_s);
 				break;
 			default:
 				break;
@@ -517,6 +528,11 @@ void Decoder_polar_SCL_fast_sys<B,R,API_polar>
 
 		normalize_scl_metrics<R>(this->metrics, this->L);
 	}
+
+	// the partial sums of a left child are owned by the paths alive at the end of the child, the paths created later
+	// only point to them (see 'duplicate_tree')
+	if (rev_depth < m && ((off_s >> rev_depth) & 1) == 0)
+		up_ref_left_array(rev_depth);
 }
 
 template <typename B, typename R, class API_polar>
@@ -1208,7 +1224,10 @@ void Decoder_polar_SCL_fast_sys<B,R,API_polar>
 {
 	const auto old_path = paths[path_id];
 	for (auto i = 0; i < m; i++)
-		n_array_ref[path_2_array[old_path][i]][i]--;
+	{
+		n_array_ref  [path_2_array  [old_path][i]][i]--;
+		n_array_ref_s[path_2_array_s[old_path][i]][i]--;
+	}
 
 	paths[path_id] = paths[--n_active_paths];
 	paths[n_active_paths] = old_path;
@@ -1278,9 +1297,81 @@ int Decoder_polar_SCL_fast_sys<B,R,API_polar>
 	for (auto i = 0; i < m; i++)
 		n_array_ref[path_2_array[new_path][i]][i]++;
 
-	std::copy(s[old_path].begin(), s[old_path].begin() + off_s + n_elmts, s[new_path].begin());
+	// the left partial sums which are still to be combined (the ones of the stages where the current node is in a right
+	// child) are shared with the old path, only the partial sums of the current node are copied
+	for (auto i = 0; i < m; i++)
+		if ((off_s >> i) & 1)
+		{
+			path_2_array_s[new_path][i] = path_2_array_s[old_path][i];
+			n_array_ref_s[path_2_array_s[new_path][i]][i]++;
+		}
+
+	std::copy(s[old_path].begin() + off_s, s[old_path].begin() + off_s + n_elmts, s[new_path].begin() + off_s);
 
 	return new_path;
 }
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_sys<B,R,API_polar>
+::up_ref_left_array(const int r_d)
+{
+	for (auto i = 0; i < L; i++)
+		n_array_ref_s[i][r_d] = 0;
+
+	for (auto i = 0; i < n_active_paths; i++)
+	{
+		const auto path = paths[i];
+		path_2_array_s[path][r_d] = path;
+		n_array_ref_s [path][r_d] = 1;
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_sys<B,R,API_polar>
+::copy_left(const int r_d, const int off_s)
+{
+	const auto n_elmts = 1 << r_d;
+
+	// save the left partial sums which are read by other paths before their array is overwritten by its own path
+	std::fill(is_saved_s.begin(), is_saved_s.end(), false);
+	for (auto i = 0; i < n_active_paths; i++)
+	{
+		const auto path = paths[i];
+		if (path_2_array_s[path][r_d] != path && n_array_ref_s[path][r_d] > 0)
+		{
+			std::copy(s[path].begin() + off_s, s[path].begin() + off_s + n_elmts, s2[path].begin() + off_s);
+			is_saved_s[path] = true;
+		}
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_sys<B,R,API_polar>
+::xo_paths(const int r_d, const int off_s)
+{
+	const auto n_elm_2 = 1 << (r_d -1);
+
+	copy_left(r_d -1, off_s);
+
+	// first the paths which share the left partial sums of another array
+	for (auto i = 0; i < n_active_paths; i++)
+	{
+		const auto path  = paths[i];
+		const auto array = path_2_array_s[path][r_d -1];
+		if (array != path)
+		{
+			const auto left = is_saved_s[array] ? s2[array].data() : s[array].data();
+			API_polar::xo(left + off_s, s[path].data() + off_s + n_elm_2, s[path].data() + off_s, n_elm_2);
+		}
+	}
+
+	// then the paths which own their left partial sums
+	for (auto i = 0; i < n_active_paths; i++)
+	{
+		const auto path = paths[i];
+		if (path_2_array_s[path][r_d -1] == path)
+			API_polar::xo(s[path], off_s, off_s + n_elm_2, off_s, n_elm_2);
+	}
+}
 }
 }
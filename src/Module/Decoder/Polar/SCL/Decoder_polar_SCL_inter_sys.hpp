@@ -0,0 +1,104 @@
+#ifndef DECODER_POLAR_SCL_INTER_SYS_
+#define DECODER_POLAR_SCL_INTER_SYS_
+
+#include <vector>
+#include <utility>
+#include <mipp.h>
+
+#include "Tools/Code/Polar/Frozenbits_notifier.hpp"
+
+#include "../../Decoder_SIHO.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R>
+class Decoder_polar_ASCL_inter_CA_sys;
+
+/*
+ * Systematic SCL decoder working on 'mipp::nElReg<R>()' frames at the same time (one frame per SIMD lane).
+ * All the lanes follow the same schedule: the paths are duplicated at the same time in every frame and, once the list
+ * is full, the 'L' best of the '2L' candidates are selected in each lane by a sorting network made of SIMD
+ * compare-exchanges. The paths of the different lanes do not necessarily have the same ancestors: each path keeps, for
+ * each stage, the per-lane index of the path that owns its data ('l_idx' for the LLRs, 's_idx' for the partial sums of
+ * the left children) and the data are gathered with masked blends when a path reads a memory zone it does not own.
+ */
+template <typename B = int, typename R = float>
+class Decoder_polar_SCL_inter_sys : public Decoder_SIHO<B,R>, public tools::Frozenbits_notifier
+{
+	friend Decoder_polar_ASCL_inter_CA_sys<B,R>;
+
+protected:
+	const int                m;           // graph depth
+	const int                L;           // maximum paths number
+	const int                n_lanes;     // number of frames decoded in parallel
+	const std::vector<bool>& frozen_bits;
+	      std::vector<int>   n_frozen;    // n_frozen[i] = number of frozen bits in [0;i[ (for the rate 0 nodes)
+
+	mipp::vector<mipp::Reg<R>>              Y;     // interleaved channel LLRs (shared by all the paths)
+	std::vector<mipp::vector<mipp::Reg<R>>> l;     // LLRs of each path, from stage m-1 (size N/2) to stage 0 (size 1)
+	std::vector<mipp::vector<mipp::Reg<B>>> s;     // partial sums of each path, left and right children of each stage
+	std::vector<mipp::vector<mipp::Reg<R>>> l_idx; // per-lane owner of the LLRs of each path at each stage
+	std::vector<mipp::vector<mipp::Reg<R>>> s_idx; // per-lane owner of the left partial sums of each path at each stage
+	std::vector<mipp::vector<mipp::Reg<R>>> l_idx_tmp;
+	std::vector<mipp::vector<mipp::Reg<R>>> s_idx_tmp;
+	mipp::vector<mipp::Reg<R>>              path_ids; // path_ids[p] = p in all the lanes
+
+	mipp::vector<mipp::Reg<R>>          metrics;
+	mipp::vector<mipp::Reg<R>>          cand_metrics;  // metrics of the 2L candidates (2p: bit 0, 2p+1: bit 1)
+	mipp::vector<mipp::Reg<R>>          cand_ids;
+	std::vector<std::pair<int,int>>     sorting_net;   // compare-exchanges sorting L elements (Batcher odd-even merge)
+	int                                 n_active_paths;
+	std::vector<int>                    best_path;     // best path of each lane
+
+	// temporary buffers
+	mipp::vector<mipp::Reg<R>> l_tmp;
+	mipp::vector<mipp::Reg<B>> s_tmp;
+	mipp::vector<R>            lane_parents;
+	mipp::vector<R>            lane_metrics;
+	mipp::vector<B>            lane_bits;
+	std::vector<int>           lane_sources;
+	std::vector<bool>          taken;
+
+public:
+	Decoder_polar_SCL_inter_sys(const int& K, const int& N, const int& L, const std::vector<bool>& frozen_bits,
+	                            const int n_frames = 1);
+
+	virtual ~Decoder_polar_SCL_inter_sys();
+
+	virtual void notify_frozenbits_update();
+
+protected:
+	        void _load          (const R *Y_N                              );
+	        void _decode_siho   (const R *Y_N, B *V_K, const int frame_id);
+	        void _decode_siho_cw(const R *Y_N, B *V_N, const int frame_id);
+	virtual void select_best_path(                                         );
+	virtual void _store         (              B *V_K                      ) const;
+	virtual void _store_cw      (              B *V_N                      ) const;
+
+	void init_buffers    (                                                    );
+	void recursive_decode(const int rev_depth, const int off, const int side);
+	void update_paths_r0 (const int rev_depth,                const int side);
+	void duplicate_paths (                                    const int side);
+	void select_paths    (                                    const int side);
+	void normalize_metrics(                                                   );
+
+	inline const mipp::Reg<R>* get_llr(const int path, const int rev_depth) const;
+
+	int                 collect_sources(const mipp::Reg<R> &idx);
+	const mipp::Reg<R>* gather_l(const mipp::Reg<R> &idx, const int off, const int n_elmts);
+	const mipp::Reg<B>* gather_s(const mipp::Reg<R> &idx, const int off, const int n_elmts);
+	void                gather_idx(const std::vector<mipp::vector<mipp::Reg<R>>> &src,
+	                                     mipp::vector<mipp::Reg<R>>               &dst,
+	                               const mipp::Reg<R> &parents);
+
+	inline int off_l(const int rev_depth                ) const;
+	inline int off_s(const int rev_depth, const int side) const;
+};
+}
+}
+
+#include "Decoder_polar_SCL_inter_sys.hxx"
+
+#endif /* DECODER_POLAR_SCL_INTER_SYS_ */
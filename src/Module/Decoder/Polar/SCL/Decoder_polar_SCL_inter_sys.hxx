@@ -0,0 +1,583 @@
+#include <algorithm>
+#include <sstream>
+#include <limits>
+#include <cmath>
+#include <mipp.h>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Math/utils.h"
+#include "Tools/Perf/Reorderer/Reorderer.hpp"
+#include "Tools/Code/Polar/decoder_polar_functions.h"
+#include "Tools/Code/Polar/API/functions_polar_inter_intra.h"
+
+#include "Decoder_polar_SCL_inter_sys.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+// the metrics are saturated in fixed-point (the 8-bit and 16-bit penalties of a rate 0 node can overflow)
+template <typename R> inline mipp::Reg<R> scl_inter_adds(const mipp::Reg<R> a, const mipp::Reg<R> b) { return a + b; }
+template <typename R> inline mipp::Reg<R> scl_inter_subs(const mipp::Reg<R> a, const mipp::Reg<R> b) { return a - b; }
+
+template <> inline mipp::Reg<short> scl_inter_adds(const mipp::Reg<short> a, const mipp::Reg<short> b)
+{
+	return mipp::adds(a, b);
+}
+template <> inline mipp::Reg<short> scl_inter_subs(const mipp::Reg<short> a, const mipp::Reg<short> b)
+{
+	return mipp::subs(a, b);
+}
+template <> inline mipp::Reg<signed char> scl_inter_adds(const mipp::Reg<signed char> a, const mipp::Reg<signed char> b)
+{
+	return mipp::adds(a, b);
+}
+template <> inline mipp::Reg<signed char> scl_inter_subs(const mipp::Reg<signed char> a, const mipp::Reg<signed char> b)
+{
+	return mipp::subs(a, b);
+}
+
+// penalty of the path when the bit is decided against the sign of the LLR
+template <typename R>
+inline mipp::Reg<R> scl_inter_penalty0(const mipp::Reg<R> lambda)
+{
+	const auto zero = mipp::Reg<R>((R)0);
+	return mipp::max(scl_inter_subs<R>(zero, lambda), zero);
+}
+
+template <typename R>
+inline mipp::Reg<R> scl_inter_penalty1(const mipp::Reg<R> lambda)
+{
+	return mipp::max(lambda, mipp::Reg<R>((R)0));
+}
+
+// in fixed-point the smallest metric of each lane is brought back to 0 after each update
+template <typename R>
+inline void normalize_scl_inter_metrics(mipp::vector<mipp::Reg<R>> &metrics, const int n_paths)
+{
+}
+
+template <typename R>
+inline void normalize_scl_inter_metrics_fixed(mipp::vector<mipp::Reg<R>> &metrics, const int n_paths)
+{
+	auto min = metrics[0];
+	for (auto p = 1; p < n_paths; p++)
+		min = mipp::min(min, metrics[p]);
+
+	for (auto p = 0; p < n_paths; p++)
+		metrics[p] = metrics[p] - min;
+}
+
+template <>
+inline void normalize_scl_inter_metrics(mipp::vector<mipp::Reg<short>> &metrics, const int n_paths)
+{
+	normalize_scl_inter_metrics_fixed<short>(metrics, n_paths);
+}
+
+template <>
+inline void normalize_scl_inter_metrics(mipp::vector<mipp::Reg<signed char>> &metrics, const int n_paths)
+{
+	normalize_scl_inter_metrics_fixed<signed char>(metrics, n_paths);
+}
+
+template <typename B, typename R>
+Decoder_polar_SCL_inter_sys<B,R>
+::Decoder_polar_SCL_inter_sys(const int& K, const int& N, const int& L, const std::vector<bool>& frozen_bits,
+                              const int n_frames)
+: Decoder          (K, N, n_frames, mipp::nElReg<R>()),
+  Decoder_SIHO<B,R>(K, N, n_frames, mipp::nElReg<R>()),
+  m                ((int)std::log2(N)),
+  L                (L),
+  n_lanes          (mipp::nElReg<R>()),
+  frozen_bits      (frozen_bits),
+  n_frozen         (N +1, 0),
+  Y                (N),
+  l                (L, mipp::vector<mipp::Reg<R>>(N)),
+  s                (L, mipp::vector<mipp::Reg<B>>(3 * N)),
+  l_idx            (L, mipp::vector<mipp::Reg<R>>(m    )),
+  s_idx            (L, mipp::vector<mipp::Reg<R>>(m +1)),
+  l_idx_tmp        (L, mipp::vector<mipp::Reg<R>>(m    )),
+  s_idx_tmp        (L, mipp::vector<mipp::Reg<R>>(m +1)),
+  path_ids         (L),
+  metrics          (L),
+  cand_metrics     (2 * L),
+  cand_ids         (2 * L),
+  n_active_paths   (1),
+  best_path        (mipp::nElReg<R>(), 0),
+  l_tmp            (N),
+  s_tmp            (N),
+  lane_parents     (L * mipp::nElReg<R>()),
+  lane_metrics     (L * mipp::nElReg<R>()),
+  lane_bits        (L * mipp::nElReg<R>()),
+  lane_sources     (L),
+  taken            (L)
+{
+	const std::string name = "Decoder_polar_SCL_inter_sys";
+	this->set_name(name);
+
+	static_assert(sizeof(B) == sizeof(R), "Sizes of the bits and reals have to be identical.");
+
+	if (!tools::is_power_of_2(this->N))
+	{
+		std::stringstream message;
+		message << "'N' has to be a power of 2 ('N' = " << N << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (this->N != (int)frozen_bits.size())
+	{
+		std::stringstream message;
+		message << "'frozen_bits.size()' has to be equal to 'N' ('frozen_bits.size()' = " << frozen_bits.size()
+		        << ", 'N' = " << N << ").";
+		throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (this->L <= 0 || !tools::is_power_of_2(this->L))
+	{
+		std::stringstream message;
+		message << "'L' has to be a positive power of 2 ('L' = " << L << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	// the indexes of the candidates are stored in the 'R' type
+	if (2 * this->L -1 > (int)std::numeric_limits<R>::max())
+	{
+		std::stringstream message;
+		message << "'2 * L - 1' has to be smaller or equal to 'std::numeric_limits<R>::max()' ('L' = " << L
+		        << ", 'std::numeric_limits<R>::max()' = " << (int)std::numeric_limits<R>::max() << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	auto k = 0; for (auto i = 0; i < this->N; i++) if (frozen_bits[i] == 0) k++;
+	if (this->K != k)
+	{
+		std::stringstream message;
+		message << "The number of information bits in the frozen_bits is invalid ('K' = " << K << ", 'k' = "
+		        << k << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	for (auto p = 0; p < this->L; p++)
+		path_ids[p] = mipp::Reg<R>((R)p);
+
+	// Batcher's odd-even merge sort network of L elements
+	for (auto p = 1; p < this->L; p <<= 1)
+		for (auto k = p; k >= 1; k >>= 1)
+			for (auto j = k % p; j <= this->L -1 -k; j += 2 * k)
+				for (auto i = 0; i <= std::min(k -1, this->L -j -k -1); i++)
+					if ((i + j) / (2 * p) == (i + j + k) / (2 * p))
+						sorting_net.push_back(std::make_pair(i + j, i + j + k));
+
+	this->notify_frozenbits_update();
+}
+
+template <typename B, typename R>
+Decoder_polar_SCL_inter_sys<B,R>
+::~Decoder_polar_SCL_inter_sys()
+{
+}
+
+template <typename B, typename R>
+void Decoder_polar_SCL_inter_sys<B,R>
+::notify_frozenbits_update()
+{
+	for (auto i = 0; i < this->N; i++)
+		n_frozen[i +1] = n_frozen[i] + (frozen_bits[i] ? 1 : 0);
+}
+
+template <typename B, typename R>
+inline int Decoder_polar_SCL_inter_sys<B,R>
+::off_l(const int rev_depth) const
+{
+	return this->N - (2 << rev_depth);
+}
+
+template <typename B, typename R>
+inline int Decoder_polar_SCL_inter_sys<B,R>
+::off_s(const int rev_depth, const int side) const
+{
+	return 2 * ((1 << rev_depth) -1) + side * (1 << rev_depth);
+}
+
+template <typename B, typename R>
+inline const mipp::Reg<R>* Decoder_polar_SCL_inter_sys<B,R>
+::get_llr(const int path, const int rev_depth) const
+{
+	return (rev_depth == m) ? Y.data() : l[path].data() + off_l(rev_depth);
+}
+
+template <typename B, typename R>
+void Decoder_polar_SCL_inter_sys<B,R>
+::init_buffers()
+{
+	metrics[0] = mipp::Reg<R>((R)0);
+	n_active_paths = 1;
+
+	std::fill(l_idx[0].begin(), l_idx[0].end(), path_ids[0]);
+	std::fill(s_idx[0].begin(), s_idx[0].end(), path_ids[0]);
+}
+
+template <typename B, typename R>
+void Decoder_polar_SCL_inter_sys<B,R>
+::_load(const R *Y_N)
+{
+	std::vector<const R*> frames(mipp::nElReg<R>());
+	for (auto f = 0; f < mipp::nElReg<R>(); f++) frames[f] = Y_N + f * this->N;
+	tools::Reorderer_static<R,mipp::nElReg<R>()>::apply(frames, (R*)this->Y.data(), this->N);
+}
+
+template <typename B, typename R>
+void Decoder_polar_SCL_inter_sys<B,R>
+::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+	this->init_buffers();
+	this->_load(Y_N);
+	this->recursive_decode(m, 0, 0);
+	this->select_best_path();
+	this->_store(V_K);
+}
+
+template <typename B, typename R>
+void Decoder_polar_SCL_inter_sys<B,R>
+::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
+{
+	this->init_buffers();
+	this->_load(Y_N);
+	this->recursive_decode(m, 0, 0);
+	this->select_best_path();
+	this->_store_cw(V_N);
+}
+
+template <typename B, typename R>
+void Decoder_polar_SCL_inter_sys<B,R>
+::recursive_decode(const int rev_depth, const int off, const int side)
+{
+	const int n_elmts = 1 << rev_depth;
+	const int n_elm_2 = n_elmts >> 1;
+
+	if (n_frozen[off + n_elmts] - n_frozen[off] == n_elmts)
+		this->update_paths_r0(rev_depth, side);
+	else if (rev_depth == 0)
+	{
+		if (n_active_paths < L) this->duplicate_paths(side);
+		else                    this->select_paths   (side);
+	}
+	else
+	{
+		// f: the LLRs of the node have been written by each path in its own memory zone since no leaf has been
+		// decoded since then
+		for (auto p = 0; p < n_active_paths; p++)
+		{
+			const auto *l_a = this->get_llr(p, rev_depth);
+			      auto *l_c = l[p].data() + off_l(rev_depth -1);
+			for (auto i = 0; i < n_elm_2; i++)
+				l_c[i] = tools::f_LLR_i<R>(l_a[i].r, l_a[n_elm_2 + i].r);
+			l_idx[p][rev_depth -1] = path_ids[p];
+		}
+
+		this->recursive_decode(rev_depth -1, off, 0);
+
+		// g
+		const auto r_sat = tools::API_polar_inter_intra_saturate<R>::init();
+		for (auto p = 0; p < n_active_paths; p++)
+		{
+			const auto *l_a = (rev_depth == m) ? Y.data() : this->gather_l(l_idx[p][rev_depth], off_l(rev_depth), n_elmts);
+			const auto *s_a = this->gather_s(s_idx[p][rev_depth -1], off_s(rev_depth -1, 0), n_elm_2);
+			      auto *l_c = l[p].data() + off_l(rev_depth -1);
+			for (auto i = 0; i < n_elm_2; i++)
+				l_c[i] = tools::API_polar_inter_intra_saturate<R>::perform(
+				             tools::g_LLR_i<B,R>(l_a[i].r, l_a[n_elm_2 + i].r, s_a[i].r), r_sat);
+			l_idx[p][rev_depth -1] = path_ids[p];
+		}
+
+		this->recursive_decode(rev_depth -1, off + n_elm_2, 1);
+
+		// xor
+		for (auto p = 0; p < n_active_paths; p++)
+		{
+			const auto *s_a = this->gather_s(s_idx[p][rev_depth -1], off_s(rev_depth -1, 0), n_elm_2);
+			const auto *s_b = s[p].data() + off_s(rev_depth -1, 1);
+			      auto *s_c = s[p].data() + off_s(rev_depth, side);
+			for (auto i = 0; i < n_elm_2; i++)
+			{
+				s_c[          i] = tools::xo_STD_i<B>(s_a[i].r, s_b[i].r);
+				s_c[n_elm_2 + i] = s_b[i];
+			}
+			if (side == 0)
+				s_idx[p][rev_depth] = path_ids[p];
+		}
+	}
+}
+
+template <typename B, typename R>
+void Decoder_polar_SCL_inter_sys<B,R>
+::update_paths_r0(const int rev_depth, const int side)
+{
+	const int n_elmts = 1 << rev_depth;
+
+	if (n_active_paths > 1)
+	{
+		for (auto p = 0; p < n_active_paths; p++)
+		{
+			const auto *l_a = this->get_llr(p, rev_depth);
+			auto penalty = mipp::Reg<R>((R)0);
+			for (auto i = 0; i < n_elmts; i++)
+				penalty = scl_inter_adds<R>(penalty, scl_inter_penalty0<R>(l_a[i]));
+			metrics[p] = scl_inter_adds<R>(metrics[p], penalty);
+		}
+
+		this->normalize_metrics();
+	}
+
+	const auto zero = mipp::Reg<B>((B)0);
+	for (auto p = 0; p < n_active_paths; p++)
+	{
+		std::fill(s[p].begin() + off_s(rev_depth, side), s[p].begin() + off_s(rev_depth, side) + n_elmts, zero);
+		if (side == 0)
+			s_idx[p][rev_depth] = path_ids[p];
+	}
+}
+
+template <typename B, typename R>
+void Decoder_polar_SCL_inter_sys<B,R>
+::duplicate_paths(const int side)
+{
+	const auto zero = mipp::Reg<B>((B)0);
+	const auto one  = mipp::Reg<B>(tools::bit_init<B>());
+
+	// the same paths are duplicated in all the lanes: the path 'p' takes the bit 0 and the path 'p + n' the bit 1
+	const auto n = n_active_paths;
+	for (auto p = 0; p < n; p++)
+	{
+		const auto lambda = this->get_llr(p, 0)[0];
+		const auto q = p + n;
+
+		metrics[q] = scl_inter_adds<R>(metrics[p], scl_inter_penalty1<R>(lambda));
+		metrics[p] = scl_inter_adds<R>(metrics[p], scl_inter_penalty0<R>(lambda));
+
+		std::copy(l_idx[p].begin(), l_idx[p].end(), l_idx[q].begin());
+		std::copy(s_idx[p].begin(), s_idx[p].end(), s_idx[q].begin());
+
+		s[p][off_s(0, side)] = zero;
+		s[q][off_s(0, side)] = one;
+		if (side == 0)
+		{
+			s_idx[p][0] = path_ids[p];
+			s_idx[q][0] = path_ids[q];
+		}
+	}
+
+	n_active_paths *= 2;
+	this->normalize_metrics();
+}
+
+template <typename B, typename R>
+void Decoder_polar_SCL_inter_sys<B,R>
+::select_paths(const int side)
+{
+	for (auto p = 0; p < L; p++)
+	{
+		const auto lambda = this->get_llr(p, 0)[0];
+		cand_metrics[2 * p +0] = scl_inter_adds<R>(metrics[p], scl_inter_penalty0<R>(lambda));
+		cand_metrics[2 * p +1] = scl_inter_adds<R>(metrics[p], scl_inter_penalty1<R>(lambda));
+		cand_ids    [2 * p +0] = mipp::Reg<R>((R)(2 * p +0));
+		cand_ids    [2 * p +1] = mipp::Reg<R>((R)(2 * p +1));
+	}
+
+	// sort the two halves of the candidates in the ascending order (in all the lanes at the same time)
+	for (auto h = 0; h < 2 * L; h += L)
+		for (auto &cmp : sorting_net)
+		{
+			const auto i = h + cmp.first;
+			const auto j = h + cmp.second;
+			const auto swap = cand_metrics[j] < cand_metrics[i];
+
+			const auto m_i = cand_metrics[i], id_i = cand_ids[i];
+			cand_metrics[i] = mipp::blend(cand_metrics[j], m_i,             swap);
+			cand_metrics[j] = mipp::blend(m_i,             cand_metrics[j], swap);
+			cand_ids    [i] = mipp::blend(cand_ids    [j], id_i,            swap);
+			cand_ids    [j] = mipp::blend(id_i,            cand_ids    [j], swap);
+		}
+
+	// the L smallest candidates are the minimums of the first half and of the reversed second half (bitonic split)
+	for (auto i = 0; i < L; i++)
+	{
+		const auto j = 2 * L -1 -i;
+		const auto swap = cand_metrics[j] < cand_metrics[i];
+		cand_metrics[i] = mipp::blend(cand_metrics[j], cand_metrics[i], swap);
+		cand_ids    [i] = mipp::blend(cand_ids    [j], cand_ids    [i], swap);
+	}
+
+	// assign the survivors to the paths: in each lane a survivor stays in the memory of its parent when it can, the
+	// other survivors take the memory of the discarded paths
+	for (auto f = 0; f < n_lanes; f++)
+	{
+		std::fill(taken.begin(), taken.end(), false);
+
+		auto n_extra = 0;
+		for (auto i = 0; i < L; i++)
+		{
+			const auto parent = (int)cand_ids[i][f] >> 1;
+			if (!taken[parent])
+			{
+				taken[parent] = true;
+				lane_parents[parent * n_lanes + f] = (R)parent;
+				lane_metrics[parent * n_lanes + f] = cand_metrics[i][f];
+				lane_bits   [parent * n_lanes + f] = ((int)cand_ids[i][f] & 1) ? tools::bit_init<B>() : (B)0;
+			}
+			else
+				lane_sources[n_extra++] = i;
+		}
+
+		auto q = 0;
+		for (auto e = 0; e < n_extra; e++)
+		{
+			const auto i = lane_sources[e];
+			while (taken[q]) q++;
+			taken[q] = true;
+			lane_parents[q * n_lanes + f] = (R)((int)cand_ids[i][f] >> 1);
+			lane_metrics[q * n_lanes + f] = cand_metrics[i][f];
+			lane_bits   [q * n_lanes + f] = ((int)cand_ids[i][f] & 1) ? tools::bit_init<B>() : (B)0;
+		}
+	}
+
+	for (auto q = 0; q < L; q++)
+	{
+		const auto parents = mipp::Reg<R>(&lane_parents[q * n_lanes]);
+		metrics[q] = mipp::Reg<R>(&lane_metrics[q * n_lanes]);
+		this->gather_idx(l_idx, l_idx_tmp[q], parents);
+		this->gather_idx(s_idx, s_idx_tmp[q], parents);
+		s[q][off_s(0, side)] = mipp::Reg<B>(&lane_bits[q * n_lanes]);
+	}
+
+	std::swap(l_idx, l_idx_tmp);
+	std::swap(s_idx, s_idx_tmp);
+
+	if (side == 0)
+		for (auto q = 0; q < L; q++)
+			s_idx[q][0] = path_ids[q];
+
+	this->normalize_metrics();
+}
+
+template <typename B, typename R>
+void Decoder_polar_SCL_inter_sys<B,R>
+::normalize_metrics()
+{
+	normalize_scl_inter_metrics<R>(metrics, n_active_paths);
+}
+
+template <typename B, typename R>
+int Decoder_polar_SCL_inter_sys<B,R>
+::collect_sources(const mipp::Reg<R> &idx)
+{
+	auto n_sources = 0;
+	for (auto f = 0; f < n_lanes; f++)
+	{
+		const auto src = (int)idx[f];
+		auto i = 0;
+		while (i < n_sources && lane_sources[i] != src) i++;
+		if (i == n_sources)
+			lane_sources[n_sources++] = src;
+	}
+	return n_sources;
+}
+
+template <typename B, typename R>
+const mipp::Reg<R>* Decoder_polar_SCL_inter_sys<B,R>
+::gather_l(const mipp::Reg<R> &idx, const int off, const int n_elmts)
+{
+	const auto n_sources = this->collect_sources(idx);
+	if (n_sources == 1)
+		return l[lane_sources[0]].data() + off;
+
+	std::copy(l[lane_sources[0]].begin() + off, l[lane_sources[0]].begin() + off + n_elmts, l_tmp.begin());
+	for (auto k = 1; k < n_sources; k++)
+	{
+		const auto  src  = lane_sources[k];
+		const auto  mask = idx == mipp::Reg<R>((R)src);
+		const auto *l_a  = l[src].data() + off;
+		for (auto i = 0; i < n_elmts; i++)
+			l_tmp[i] = mipp::blend(l_a[i], l_tmp[i], mask);
+	}
+	return l_tmp.data();
+}
+
+template <typename B, typename R>
+const mipp::Reg<B>* Decoder_polar_SCL_inter_sys<B,R>
+::gather_s(const mipp::Reg<R> &idx, const int off, const int n_elmts)
+{
+	const auto n_sources = this->collect_sources(idx);
+	if (n_sources == 1)
+		return s[lane_sources[0]].data() + off;
+
+	std::copy(s[lane_sources[0]].begin() + off, s[lane_sources[0]].begin() + off + n_elmts, s_tmp.begin());
+	for (auto k = 1; k < n_sources; k++)
+	{
+		const auto  src  = lane_sources[k];
+		const auto  mask = idx == mipp::Reg<R>((R)src);
+		const auto *s_a  = s[src].data() + off;
+		for (auto i = 0; i < n_elmts; i++)
+			s_tmp[i] = mipp::blend(s_a[i], s_tmp[i], mask);
+	}
+	return s_tmp.data();
+}
+
+template <typename B, typename R>
+void Decoder_polar_SCL_inter_sys<B,R>
+::gather_idx(const std::vector<mipp::vector<mipp::Reg<R>>> &src, mipp::vector<mipp::Reg<R>> &dst,
+             const mipp::Reg<R> &parents)
+{
+	const auto n_sources = this->collect_sources(parents);
+
+	std::copy(src[lane_sources[0]].begin(), src[lane_sources[0]].end(), dst.begin());
+	for (auto k = 1; k < n_sources; k++)
+	{
+		const auto parent = lane_sources[k];
+		const auto mask   = parents == mipp::Reg<R>((R)parent);
+		for (auto d = 0; d < (int)dst.size(); d++)
+			dst[d] = mipp::blend(src[parent][d], dst[d], mask);
+	}
+}
+
+template <typename B, typename R>
+void Decoder_polar_SCL_inter_sys<B,R>
+::select_best_path()
+{
+	for (auto f = 0; f < n_lanes; f++)
+	{
+		auto best = 0;
+		for (auto p = 1; p < n_active_paths; p++)
+			if (metrics[p][f] < metrics[best][f])
+				best = p;
+		best_path[f] = best;
+	}
+}
+
+template <typename B, typename R>
+void Decoder_polar_SCL_inter_sys<B,R>
+::_store(B *V_K) const
+{
+	for (auto f = 0; f < n_lanes; f++)
+	{
+		const auto *s_root = s[best_path[f]].data() + off_s(m, 0);
+		auto k = 0;
+		for (auto i = 0; i < this->N; i++)
+			if (!frozen_bits[i])
+				V_K[f * this->K + k++] = s_root[i][f] ? (B)1 : (B)0;
+	}
+}
+
+template <typename B, typename R>
+void Decoder_polar_SCL_inter_sys<B,R>
+::_store_cw(B *V_N) const
+{
+	for (auto f = 0; f < n_lanes; f++)
+	{
+		const auto *s_root = s[best_path[f]].data() + off_s(m, 0);
+		for (auto i = 0; i < this->N; i++)
+			V_N[f * this->N + i] = s_root[i][f] ? (B)1 : (B)0;
+	}
+}
+}
+}
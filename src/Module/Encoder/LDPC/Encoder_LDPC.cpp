@@ -44,7 +44,7 @@ Encoder_LDPC<B>
 		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
 	}
 
-	auto CN_to_VN = G.get_col_to_rows();
+	const auto CN_to_VN = G.get_col_to_rows();
 
 	std::vector<B> full_G(K * N,0);
 	for (auto i = 0; i < K; i++)
@@ -15,26 +15,29 @@ using namespace aff3ct::module;
 
 template <typename B>
 Encoder_LDPC_from_H<B>
-::Encoder_LDPC_from_H(const int K, const int N, const tools::Sparse_matrix &H, const int n_frames)
-: Encoder_LDPC<B>(K, N, n_frames), G(tools::LDPC_matrix_handler::transform_H_to_G(H, this->info_bits_pos)), H(H)
+::Encoder_LDPC_from_H(const int K, const int N, const tools::Sparse_matrix &H, const int n_frames,
+                     const std::string &cache_path)
+: Encoder_LDPC<B>(K, N, n_frames),
+  G(tools::LDPC_matrix_cache::get_G(H, this->info_bits_pos, cache_path)),
+  H(tools::LDPC_matrix_cache::share(H))
 {
 	const std::string name = "Encoder_LDPC_from_H";
 	this->set_name(name);
 	
 	// warning G is transposed !
-	if (K != (int)G.get_n_cols())
+	if (K != (int)G->get_n_cols())
 	{
 		std::stringstream message;
 		message << "The built G matrix has a dimension 'K' different than the given one ('K' = " << K
-		        << ", 'G.get_n_cols()' = " << G.get_n_cols() << ").";
+		        << ", 'G.get_n_cols()' = " << G->get_n_cols() << ").";
 		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
 	}
 
-	if (N != (int)G.get_n_rows())
+	if (N != (int)G->get_n_rows())
 	{
 		std::stringstream message;
 		message << "The built G matrix has a dimension 'N' different than the given one ('N' = " << N
-		        << ", 'G.get_n_rows()' = " << G.get_n_rows() << ").";
+		        << ", 'G.get_n_rows()' = " << G->get_n_rows() << ").";
 		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
 	}
 }
@@ -49,11 +52,11 @@ template <typename B>
 void Encoder_LDPC_from_H<B>
 ::_encode(const B *U_K, B *X_N, const int frame_id)
 {
-	for (unsigned i = 0; i < G.get_n_rows(); i++)
+	for (unsigned i = 0; i < G->get_n_rows(); i++)
 	{
 		X_N[i] = 0;
-		for (unsigned j = 0; j < G.get_cols_from_row(i).size(); j++)
-			X_N[i] += U_K[ G.get_cols_from_row(i)[j] ];
+		for (unsigned j = 0; j < G->get_cols_from_row(i).size(); j++)
+			X_N[i] += U_K[ G->get_cols_from_row(i)[j] ];
 		X_N[i] %= 2;
 	}
 }
@@ -64,16 +67,16 @@ bool Encoder_LDPC_from_H<B>
 {
 	auto syndrome = false;
 
-	const auto n_CN = (int)this->H.get_n_cols();
+	const auto n_CN = (int)this->H->get_n_cols();
 	auto i = 0;
 	while (i < n_CN && !syndrome)
 	{
 		auto sign = 0;
 
-		const auto n_VN = (int)this->H[i].size();
+		const auto n_VN = (int)(*this->H)[i].size();
 		for (auto j = 0; j < n_VN; j++)
 		{
-			const auto bit = X_N[this->H[i][j]];
+			const auto bit = X_N[(*this->H)[i][j]];
 			const auto tmp_sign = bit ? -1 : 0;
 
 			sign ^= tmp_sign;
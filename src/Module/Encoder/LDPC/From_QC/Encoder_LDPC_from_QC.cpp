@@ -15,27 +15,29 @@ using namespace aff3ct::module;
 
 template <typename B>
 Encoder_LDPC_from_QC<B>
-::Encoder_LDPC_from_QC(const int K, const int N, const tools::Sparse_matrix &_H, const int n_frames)
+::Encoder_LDPC_from_QC(const int K, const int N, const tools::Sparse_matrix &_H, const int n_frames,
+                      const std::string &cache_path)
 : Encoder_LDPC<B>(K, N, n_frames),
-  H((_H.get_n_rows() > _H.get_n_cols())?_H.transpose():_H),
-  invH2(tools::LDPC_matrix_handler::invert_H2(_H))
+  H(tools::LDPC_matrix_cache::share((_H.get_n_rows() > _H.get_n_cols())?_H.transpose():_H)),
+  invH2(tools::LDPC_matrix_cache::get_invH2(_H, cache_path)),
+  tableauCalcul((N - K + 63) / 64)
 {
 	const std::string name = "Encoder_LDPC_from_QC";
 	this->set_name(name);
 	
-	if ((N-K) != (int)H.get_n_rows())
+	if ((N-K) != (int)H->get_n_rows())
 	{
 		std::stringstream message;
 		message << "The built H matrix has a dimension '(N-K)' different than the given one ('(N-K)' = " << (N-K)
-		        << ", 'H.get_n_rows()' = " << H.get_n_rows() << ").";
+		        << ", 'H.get_n_rows()' = " << H->get_n_rows() << ").";
 		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
 	}
 
-	if (N != (int)H.get_n_cols())
+	if (N != (int)H->get_n_cols())
 	{
 		std::stringstream message;
 		message << "The built H matrix has a dimension 'N' different than the given one ('N' = " << N
-		        << ", 'H.get_n_cols()' = " << H.get_n_cols() << ").";
+		        << ", 'H.get_n_cols()' = " << H->get_n_cols() << ").";
 		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
 	}
 }
@@ -56,22 +58,28 @@ void Encoder_LDPC_from_QC<B>
 	std::copy_n(U_K, this->K, X_N);
 
 	//Calculate parity part
-	mipp::vector<int8_t> tableauCalcul(M, 0);
+	std::fill(tableauCalcul.begin(), tableauCalcul.end(), 0);
 	for (unsigned i = 0; i < M; i++)
 	{
-		for (unsigned j = 0; j < H.get_cols_from_row(i).size(); j++)
-			if (H.get_cols_from_row(i)[j] < (unsigned)this->K)
-				tableauCalcul[i] ^= U_K[ H.get_cols_from_row(i)[j] ];
+		B bit = 0;
+		for (unsigned j = 0; j < H->get_cols_from_row(i).size(); j++)
+			if (H->get_cols_from_row(i)[j] < (unsigned)this->K)
+				bit ^= U_K[ H->get_cols_from_row(i)[j] ];
 			else
 				break;
+		tableauCalcul[i / 64] |= (uint64_t)(bit & 1) << (i % 64);
 	}
 
+	// the parity bit i is the parity of the bitwise AND between the row i of inv(H2) and H1 x u
 	for (unsigned i = 0; i < M; i++)
 	{
-		X_N[this->K + i] = 0;
-		for (unsigned j = 0; j < M; j++)
-			X_N[this->K + i] += tableauCalcul[j] & invH2[i][j];
-		X_N[this->K + i] %= 2;
+		uint64_t acc = 0;
+		for (unsigned w = 0; w < tableauCalcul.size(); w++)
+			acc ^= tableauCalcul[w] & (*invH2)[i][w];
+
+		for (auto s = 32; s > 0; s >>= 1)
+			acc ^= acc >> s;
+		X_N[this->K + i] = (B)(acc & 1);
 	}
 }
 
@@ -81,16 +89,16 @@ bool Encoder_LDPC_from_QC<B>
 {
 	auto syndrome = false;
 
-	const auto n_CN = (int)this->H.get_n_cols();
+	const auto n_CN = (int)this->H->get_n_cols();
 	auto i = 0;
 	while (i < n_CN && !syndrome)
 	{
 		auto sign = 0;
 
-		const auto n_VN = (int)this->H[i].size();
+		const auto n_VN = (int)(*this->H)[i].size();
 		for (auto j = 0; j < n_VN; j++)
 		{
-			const auto bit = X_N[this->H[i][j]];
+			const auto bit = X_N[(*this->H)[i][j]];
 			const auto tmp_sign = bit ? -1 : 0;
 
 			sign ^= tmp_sign;
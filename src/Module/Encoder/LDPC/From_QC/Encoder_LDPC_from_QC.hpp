@@ -2,11 +2,15 @@
 #define ENCODER_LDPC_FROM_QC_HPP_
 
 #include <vector>
+#include <string>
+#include <memory>
+#include <cstdint>
 
 #include "../Encoder_LDPC.hpp"
 
 #include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
 #include "Tools/Code/LDPC/Matrix_handler/LDPC_matrix_handler.hpp"
+#include "Tools/Code/LDPC/Matrix_handler/LDPC_matrix_cache.hpp"
 
 namespace aff3ct
 {
@@ -17,11 +21,15 @@ template <typename B = int>
 class Encoder_LDPC_from_QC : public Encoder_LDPC<B>
 {
 protected:
-	tools::Sparse_matrix H;
-	tools::LDPC_matrix_handler::QCFull_matrix invH2;
+	// shared with the other encoders built from the same H
+	std::shared_ptr<const tools::Sparse_matrix>                      H;
+	std::shared_ptr<const tools::LDPC_matrix_handler::Packed_matrix> invH2;
+
+	std::vector<uint64_t> tableauCalcul; // H1 x u, bit-packed
 
 public:
-	Encoder_LDPC_from_QC(const int K, const int N, const tools::Sparse_matrix &H, const int n_frames = 1);
+	Encoder_LDPC_from_QC(const int K, const int N, const tools::Sparse_matrix &H, const int n_frames = 1,
+	                     const std::string &cache_path = "");
 	virtual ~Encoder_LDPC_from_QC();
 
 	bool is_codeword(const B *X_N);
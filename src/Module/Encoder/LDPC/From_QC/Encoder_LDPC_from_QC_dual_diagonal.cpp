@@ -0,0 +1,355 @@
+#include <vector>
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Code/LDPC/QC/QC.hpp"
+#include "Tools/Code/LDPC/Matrix_handler/LDPC_matrix_cache.hpp"
+
+#include "Encoder_LDPC_from_QC_dual_diagonal.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template <typename B>
+Encoder_LDPC_from_QC_dual_diagonal<B>
+::Encoder_LDPC_from_QC_dual_diagonal(const int K, const int N, const tools::Sparse_matrix &_H, const int n_frames)
+: Encoder_LDPC<B>(K, N, n_frames),
+  H(tools::LDPC_matrix_cache::share((_H.get_n_rows() < _H.get_n_cols()) ? _H.transpose() : _H)),
+  Z(1), n_words(0), n_dwords(0), n_blocks(0), n_layers(0), first_block(0), first_shift(0)
+{
+	const std::string name = "Encoder_LDPC_from_QC_dual_diagonal";
+	this->set_name(name);
+
+	if (N != (int)H->get_n_rows())
+	{
+		std::stringstream message;
+		message << "The built H matrix has a dimension 'N' different than the given one ('N' = " << N
+		        << ", 'H.get_n_rows()' = " << H->get_n_rows() << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if ((N-K) != (int)H->get_n_cols())
+	{
+		std::stringstream message;
+		message << "The built H matrix has a dimension '(N-K)' different than the given one ('(N-K)' = " << (N-K)
+		        << ", 'H.get_n_cols()' = " << H->get_n_cols() << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	this->Z = tools::QC::get_lifting_factor(*H);
+	if (this->Z == 1)
+	{
+		std::stringstream message;
+		message << "The H matrix has no quasi-cyclic structure.";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	this->n_words  = (Z + 63) / 64;
+	this->n_dwords = (2 * Z + 63) / 64 + 2;
+	this->n_blocks = N / Z;
+	this->n_layers = (N - K) / Z;
+
+	this->build_schedule(tools::QC::get_base_matrix(*H, Z));
+
+	this->doubled.resize(n_blocks * n_dwords);
+	this->lambdas.resize(n_layers * n_words );
+	this->acc    .resize(           n_words );
+}
+
+template <typename B>
+Encoder_LDPC_from_QC_dual_diagonal<B>
+::~Encoder_LDPC_from_QC_dual_diagonal()
+{
+}
+
+template <typename B>
+void Encoder_LDPC_from_QC_dual_diagonal<B>
+::build_schedule(const std::vector<std::vector<int>> &base)
+{
+	const auto n_info = n_blocks - n_layers;
+
+	row_offsets.push_back(0);
+	for (unsigned i = 0; i < n_layers; i++)
+	{
+		for (unsigned j = 0; j < n_blocks; j++)
+			if (base[i][j] >= 0)
+			{
+				row_blocks.push_back(j);
+				row_shifts.push_back((unsigned)base[i][j]);
+			}
+		row_offsets.push_back((unsigned)row_blocks.size());
+	}
+
+	// the core rows: a row which is the only one (of the core) to contain a parity block is an extension row
+	std::vector<bool> in_core(n_layers, true);
+	auto removed = true;
+	while (removed)
+	{
+		removed = false;
+		for (auto c = n_info; c < n_blocks; c++)
+		{
+			auto n_rows = 0; auto last = 0u;
+			for (unsigned i = 0; i < n_layers; i++)
+				if (in_core[i] && base[i][c] >= 0) { n_rows++; last = i; }
+
+			if (n_rows == 1)
+			{
+				in_core[last] = false;
+				removed = true;
+			}
+		}
+	}
+
+	// when summing the core rows, all the parity blocks but one have to cancel out
+	first_block = n_blocks;
+	for (auto c = n_info; c < n_blocks; c++)
+	{
+		std::vector<int> shifts;
+		for (unsigned i = 0; i < n_layers; i++)
+			if (in_core[i] && base[i][c] >= 0)
+				shifts.push_back(base[i][c]);
+		std::sort(shifts.begin(), shifts.end());
+
+		std::vector<int> odd_shifts; // the shifts which do not cancel out
+		for (unsigned k = 0; k < shifts.size(); )
+		{
+			auto l = k;
+			while (l < shifts.size() && shifts[l] == shifts[k]) l++;
+			if ((l - k) % 2) odd_shifts.push_back(shifts[k]);
+			k = l;
+		}
+
+		if (odd_shifts.empty())
+			continue;
+
+		if (odd_shifts.size() != 1 || first_block != n_blocks)
+		{
+			std::stringstream message;
+			message << "The parity part of the H matrix has no dual-diagonal structure (the parity block " << c
+			        << " does not cancel out in the sum of the core rows).";
+			throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		first_block = c;
+		first_shift = (unsigned)odd_shifts[0];
+	}
+
+	if (first_block == n_blocks)
+	{
+		std::stringstream message;
+		message << "The parity part of the H matrix has no dual-diagonal structure (the sum of the core rows does not "
+		        << "give any parity block).";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	for (unsigned i = 0; i < n_layers; i++)
+		if (in_core[i])
+			core_rows.push_back(i);
+
+	// back-substitution: a row with only one unknown parity block gives this block
+	std::vector<bool> known(n_blocks, false);
+	std::vector<bool> done (n_layers, false);
+	std::fill(known.begin(), known.begin() + n_info, true);
+	known[first_block] = true;
+
+	auto n_known = 1u;
+	auto progress = true;
+	while (progress)
+	{
+		progress = false;
+		for (unsigned i = 0; i < n_layers; i++)
+		{
+			if (done[i])
+				continue;
+
+			auto n_unknowns = 0; auto unknown = 0u; auto shift = 0u;
+			for (auto e = row_offsets[i]; e < row_offsets[i +1]; e++)
+				if (!known[row_blocks[e]]) { n_unknowns++; unknown = row_blocks[e]; shift = row_shifts[e]; }
+
+			if (n_unknowns == 0)
+			{
+				// a fully known row is verified for free only if it was part of the sum that gave the first block
+				if (!in_core[i])
+				{
+					std::stringstream message;
+					message << "The parity part of the H matrix has no dual-diagonal structure (the row " << i
+					        << " is redundant).";
+					throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+				}
+				done[i] = true;
+			}
+			else if (n_unknowns == 1)
+			{
+				solve_rows  .push_back(i);
+				solve_blocks.push_back(unknown);
+				solve_shifts.push_back(shift);
+				known[unknown] = true;
+				done[i] = true;
+				n_known++;
+				progress = true;
+			}
+		}
+	}
+
+	if (n_known != n_layers)
+	{
+		std::stringstream message;
+		message << "The parity part of the H matrix has no dual-diagonal (or lower triangular) structure ('n_known' = "
+		        << n_known << ", 'n_layers' = " << n_layers << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+// out ^= P^shift * in, 'dbl' being the block 'in' written twice in a row
+template <typename B>
+void Encoder_LDPC_from_QC_dual_diagonal<B>
+::xor_rotated(const uint64_t *dbl, const unsigned shift, uint64_t *out) const
+{
+	for (unsigned w = 0; w < n_words; w++)
+	{
+		const auto pos = shift + (w << 6);
+		const auto idx = pos >> 6;
+		const auto off = pos & 63;
+
+		out[w] ^= off ? (dbl[idx] >> off) | (dbl[idx +1] << (64 - off)) : dbl[idx];
+	}
+}
+
+// the bits of the last word above Z are ignored
+template <typename B>
+void Encoder_LDPC_from_QC_dual_diagonal<B>
+::write_doubled(const uint64_t *in, uint64_t *dbl) const
+{
+	const auto off       = Z & 63;
+	const auto base      = Z >> 6;
+	const auto last_mask = off ? ((uint64_t)1 << off) -1 : ~(uint64_t)0;
+
+	std::fill(dbl, dbl + n_dwords, (uint64_t)0);
+	for (unsigned w = 0; w < n_words; w++)
+	{
+		const auto word = (w == n_words -1) ? in[w] & last_mask : in[w];
+
+		dbl[w       ] |= word;
+		dbl[base + w] |= word << off;
+		if (off)
+			dbl[base + w +1] |= word >> (64 - off);
+	}
+}
+
+// block = P^-shift * acc
+template <typename B>
+void Encoder_LDPC_from_QC_dual_diagonal<B>
+::solve(const unsigned block, const unsigned shift)
+{
+	auto dst = doubled.data() + block * n_dwords;
+
+	write_doubled(acc.data(), dst);
+	if (shift)
+	{
+		std::fill(acc.begin(), acc.end(), (uint64_t)0);
+		xor_rotated(dst, Z - shift, acc.data());
+		write_doubled(acc.data(), dst);
+	}
+}
+
+template <typename B>
+void Encoder_LDPC_from_QC_dual_diagonal<B>
+::_encode(const B *U_K, B *X_N, const int frame_id)
+{
+	const auto n_info = n_blocks - n_layers;
+
+	// pack the information blocks
+	std::fill(doubled.begin(), doubled.begin() + n_info * n_dwords, (uint64_t)0);
+	for (unsigned j = 0; j < n_info; j++)
+	{
+		auto dbl = doubled.data() + j * n_dwords;
+		for (unsigned k = 0; k < Z; k++)
+		{
+			const auto bit = (uint64_t)(U_K[j * Z + k] ? 1 : 0);
+			dbl[ k      >> 6] |= bit << ( k      & 63);
+			dbl[(k + Z) >> 6] |= bit << ((k + Z) & 63);
+		}
+	}
+
+	// contribution of the information blocks to each row
+	std::fill(lambdas.begin(), lambdas.end(), (uint64_t)0);
+	for (unsigned i = 0; i < n_layers; i++)
+		for (auto e = row_offsets[i]; e < row_offsets[i +1]; e++)
+			if (row_blocks[e] < n_info)
+				xor_rotated(doubled.data() + row_blocks[e] * n_dwords, row_shifts[e], lambdas.data() + i * n_words);
+
+	// first parity block: the sum of the core rows
+	std::fill(acc.begin(), acc.end(), (uint64_t)0);
+	for (auto i : core_rows)
+		for (unsigned w = 0; w < n_words; w++)
+			acc[w] ^= lambdas[i * n_words + w];
+	this->solve(first_block, first_shift);
+
+	// other parity blocks: back-substitution
+	for (unsigned r = 0; r < solve_rows.size(); r++)
+	{
+		const auto i = solve_rows[r];
+		std::copy(lambdas.begin() + i * n_words, lambdas.begin() + (i +1) * n_words, acc.begin());
+		for (auto e = row_offsets[i]; e < row_offsets[i +1]; e++)
+			if (row_blocks[e] >= n_info && row_blocks[e] != solve_blocks[r])
+				xor_rotated(doubled.data() + row_blocks[e] * n_dwords, row_shifts[e], acc.data());
+
+		this->solve(solve_blocks[r], solve_shifts[r]);
+	}
+
+	// unpack the codeword
+	std::copy(U_K, U_K + this->K, X_N);
+	for (auto j = n_info; j < n_blocks; j++)
+	{
+		const auto dbl = doubled.data() + j * n_dwords;
+		for (unsigned k = 0; k < Z; k++)
+			X_N[j * Z + k] = (B)((dbl[k >> 6] >> (k & 63)) & 1);
+	}
+}
+
+template <typename B>
+bool Encoder_LDPC_from_QC_dual_diagonal<B>
+::is_codeword(const B *X_N)
+{
+	const auto n_CN = (int)this->H->get_n_cols();
+	for (auto i = 0; i < n_CN; i++)
+	{
+		auto sign = 0;
+
+		const auto n_VN = (int)(*this->H)[i].size();
+		for (auto j = 0; j < n_VN; j++)
+			sign ^= X_N[(*this->H)[i][j]] ? 1 : 0;
+
+		if (sign)
+			return false;
+	}
+
+	return true;
+}
+
+template <typename B>
+const std::vector<uint32_t>& Encoder_LDPC_from_QC_dual_diagonal<B>
+::get_info_bits_pos()
+{
+	return Encoder<B>::get_info_bits_pos();
+}
+
+template <typename B>
+bool Encoder_LDPC_from_QC_dual_diagonal<B>
+::is_sys() const
+{
+	return Encoder<B>::is_sys();
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::module::Encoder_LDPC_from_QC_dual_diagonal<B_8>;
+template class aff3ct::module::Encoder_LDPC_from_QC_dual_diagonal<B_16>;
+template class aff3ct::module::Encoder_LDPC_from_QC_dual_diagonal<B_32>;
+template class aff3ct::module::Encoder_LDPC_from_QC_dual_diagonal<B_64>;
+#else
+template class aff3ct::module::Encoder_LDPC_from_QC_dual_diagonal<B>;
+#endif
+// ==================================================================================== explicit template instantiation
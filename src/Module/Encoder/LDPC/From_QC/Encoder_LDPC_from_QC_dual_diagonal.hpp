@@ -0,0 +1,78 @@
+#ifndef ENCODER_LDPC_FROM_QC_DUAL_DIAGONAL_HPP_
+#define ENCODER_LDPC_FROM_QC_DUAL_DIAGONAL_HPP_
+
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+#include "../Encoder_LDPC.hpp"
+
+#include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*
+ * Linear time encoder for the quasi-cyclic (QC) LDPC codes whose parity part has a dual-diagonal structure (IEEE
+ * 802.11n/ac, IEEE 802.16e and 5G NR like base matrices). The first parity block is obtained by summing the rows of
+ * the dual-diagonal core (the other parity blocks cancel out), then the remaining parity blocks are computed one by one
+ * by back-substitution. The blocks of Z bits are packed in 64-bit words and each circulant is applied with a rotation
+ * and a XOR: the encoding is O(E) instead of the O(M^2) dense multiplication by the inverse of H2.
+ */
+template <typename B = int>
+class Encoder_LDPC_from_QC_dual_diagonal : public Encoder_LDPC<B>
+{
+protected:
+	std::shared_ptr<const tools::Sparse_matrix> H; // shared with the other encoders built from the same H
+
+	unsigned Z;        // lifting factor (size of the circulant blocks)
+	unsigned n_words;  // number of 64-bit words to store a block of Z bits
+	unsigned n_dwords; // number of 64-bit words to store a block twice (2 * Z bits and a padding for the rotations)
+	unsigned n_blocks; // number of block columns of the base matrix (N / Z)
+	unsigned n_layers; // number of block rows    of the base matrix ((N - K) / Z)
+
+	// base matrix rows in a sparse form: the circulant blocks of the row 'i' are in [row_offsets[i], row_offsets[i +1])
+	std::vector<unsigned> row_offsets;
+	std::vector<unsigned> row_blocks;
+	std::vector<unsigned> row_shifts;
+
+	// the first parity block is the sum of the 'core_rows' lambdas shifted by the inverse of 'first_shift'
+	std::vector<unsigned> core_rows;
+	unsigned              first_block;
+	unsigned              first_shift;
+
+	// back-substitution schedule: the row 'solve_rows[i]' gives the block 'solve_blocks[i]' (shifted by 'solve_shifts')
+	std::vector<unsigned> solve_rows;
+	std::vector<unsigned> solve_blocks;
+	std::vector<unsigned> solve_shifts;
+
+	std::vector<uint64_t> doubled; // each block of the codeword written twice in a row (makes the rotations easy)
+	std::vector<uint64_t> lambdas; // contribution of the information blocks to each block row
+	std::vector<uint64_t> acc;     // accumulator
+
+public:
+	Encoder_LDPC_from_QC_dual_diagonal(const int K, const int N, const tools::Sparse_matrix &H, const int n_frames = 1);
+	virtual ~Encoder_LDPC_from_QC_dual_diagonal();
+
+	bool is_codeword(const B *X_N);
+
+	const std::vector<uint32_t>& get_info_bits_pos();
+
+	bool is_sys() const;
+
+protected:
+	void _encode(const B *U_K, B *X_N, const int frame_id);
+
+private:
+	void build_schedule(const std::vector<std::vector<int>> &base);
+
+	void solve(const unsigned block, const unsigned shift);
+
+	inline void xor_rotated  (const uint64_t *dbl, const unsigned shift, uint64_t *out) const;
+	inline void write_doubled(const uint64_t *in,                        uint64_t *dbl) const;
+};
+}
+}
+
+#endif /* ENCODER_LDPC_FROM_QC_DUAL_DIAGONAL_HPP_ */
@@ -10,12 +10,21 @@ using namespace aff3ct::module;
 
 template <typename B>
 Encoder_user<B>
-::Encoder_user(const int K, const int N, const std::string &filename, const int n_frames)
-: Encoder<B>(K, N, n_frames), codewords(), cw_counter(0)
+::Encoder_user(const int K, const int N, const std::string &filename, const int n_frames, const int stream_id,
+               const int n_streams)
+: Encoder<B>(K, N, n_frames), codewords(), cw_counter(0), n_streams(n_streams)
 {
 	const std::string name = "Encoder_user";
 	this->set_name(name);
 
+	if (n_streams <= 0 || stream_id < 0 || stream_id >= n_streams)
+	{
+		std::stringstream message;
+		message << "'stream_id' has to be positive and smaller than 'n_streams' ('stream_id' = " << stream_id
+		        << ", 'n_streams' = " << n_streams << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
 	if (filename.empty())
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "'filename' should not be empty.");
 
@@ -71,6 +80,8 @@ Encoder_user<B>
 		}
 
 		file.close();
+
+		this->cw_counter = stream_id % (int)this->codewords.size();
 	}
 	else
 	{
@@ -94,7 +105,7 @@ void Encoder_user<B>
 	          this->codewords[this->cw_counter].end  (),
 	          X_N);
 
-	this->cw_counter = (this->cw_counter +1) % (int)this->codewords.size();
+	this->cw_counter = (this->cw_counter + this->n_streams) % (int)this->codewords.size();
 }
 
 template <typename B>
@@ -15,9 +15,11 @@ class Encoder_user : public Encoder<B>
 private:
 	std::vector<std::vector<B>> codewords;
 	int cw_counter;
+	const int n_streams;
 
 public:
-	Encoder_user(const int K, const int N, const std::string &filename, const int n_frames = 1);
+	Encoder_user(const int K, const int N, const std::string &filename, const int n_frames = 1, const int stream_id = 0,
+	             const int n_streams = 1);
 	virtual ~Encoder_user();
 
 	const std::vector<uint32_t>& get_info_bits_pos();
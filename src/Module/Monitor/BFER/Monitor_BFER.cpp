@@ -2,6 +2,8 @@
 #include <vector>
 #include <stdexcept>
 
+#include "Tools/Perf/hamming_distance.h"
+
 #include "Monitor_BFER.hpp"
 
 using namespace aff3ct::module;
@@ -35,43 +37,39 @@ int Monitor_BFER<B>
 	const auto f_start = (frame_id < 0) ? 0 : frame_id % this->n_frames;
 	const auto f_stop  = (frame_id < 0) ? this->n_frames : f_start +1;
 
-	int n_be = 0;
+	// the counters are only written by the thread owning this monitor: a relaxed load + store is enough
+	auto n_be = 0;
+	auto last_fra_err = false;
 	for (auto f = f_start; f < f_stop; f++)
-		n_be += this->_check_errors(U + f * this->size,
-		                            V + f * this->size,
-		                            f);
-
-	return n_be;
-}
-
-template <typename B>
-int Monitor_BFER<B>
-::_check_errors(const B *U, const B *V, const int frame_id)
-{
-	auto bit_errors_count = 0;
-	for (auto b = 0; b < this->size; b++)
-		bit_errors_count += !U[b] != !V[b];
-
-	if (bit_errors_count)
 	{
-		n_bit_errors += bit_errors_count;
-		n_frame_errors++;
+		const auto n_be_fra = tools::hamming_distance(U + f * this->size, V + f * this->size, this->size);
 
-		for (auto c : this->callbacks_fe)
-			c(bit_errors_count, frame_id);
+		// the bookkeeping and the callbacks are only done for the frames with errors
+		if (n_be_fra)
+		{
+			n_be += n_be_fra;
+			n_bit_errors  .store(n_bit_errors  .load(std::memory_order_relaxed) + n_be_fra, std::memory_order_relaxed);
+			n_frame_errors.store(n_frame_errors.load(std::memory_order_relaxed) +1,        std::memory_order_relaxed);
 
-		if (this->fe_limit_achieved() && frame_id == this->n_frames -1)
-			for (auto c : this->callbacks_fe_limit_achieved)
-				c();
+			for (auto c : this->callbacks_fe)
+				c(n_be_fra, f);
+		}
+
+		last_fra_err = n_be_fra != 0;
 	}
 
-	n_analyzed_frames++;
+	if (f_stop == this->n_frames && last_fra_err && this->fe_limit_achieved())
+		for (auto c : this->callbacks_fe_limit_achieved)
+			c();
+
+	n_analyzed_frames.store(n_analyzed_frames.load(std::memory_order_relaxed) + (f_stop - f_start),
+	                        std::memory_order_relaxed);
 
-	if (frame_id == this->n_frames -1)
+	if (f_stop == this->n_frames)
 		for (auto c : this->callbacks_check)
 			c();
 
-	return bit_errors_count;
+	return n_be;
 }
 
 template <typename B>
@@ -92,21 +90,28 @@ template <typename B>
 unsigned long long Monitor_BFER<B>
 ::get_n_analyzed_fra() const
 {
-	return n_analyzed_frames;
+	return n_analyzed_frames.load(std::memory_order_relaxed);
 }
 
 template <typename B>
 unsigned long long Monitor_BFER<B>
 ::get_n_fe() const
 {
-	return n_frame_errors;
+	return n_frame_errors.load(std::memory_order_relaxed);
+}
+
+template <typename B>
+unsigned long long Monitor_BFER<B>
+::get_n_fe_estimate() const
+{
+	return this->get_n_fe();
 }
 
 template <typename B>
 unsigned long long Monitor_BFER<B>
 ::get_n_be() const
 {
-	return n_bit_errors;
+	return n_bit_errors.load(std::memory_order_relaxed);
 }
 
 template <typename B>
@@ -176,6 +181,22 @@ void Monitor_BFER<B>
 	this->callbacks_fe_limit_achieved.clear();
 }
 
+template <typename B>
+void Monitor_BFER<B>
+::collect(Monitor_BFER<B> &m)
+{
+	this->n_bit_errors     .store(this->n_bit_errors     .load(std::memory_order_relaxed) +
+	                              m.n_bit_errors         .load(std::memory_order_relaxed), std::memory_order_relaxed);
+	this->n_frame_errors   .store(this->n_frame_errors   .load(std::memory_order_relaxed) +
+	                              m.n_frame_errors       .load(std::memory_order_relaxed), std::memory_order_relaxed);
+	this->n_analyzed_frames.store(this->n_analyzed_frames.load(std::memory_order_relaxed) +
+	                              m.n_analyzed_frames    .load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+	m.n_bit_errors     .store(0, std::memory_order_relaxed);
+	m.n_frame_errors   .store(0, std::memory_order_relaxed);
+	m.n_analyzed_frames.store(0, std::memory_order_relaxed);
+}
+
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #ifdef MULTI_PREC
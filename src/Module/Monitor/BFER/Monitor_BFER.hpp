@@ -1,6 +1,7 @@
 #ifndef MONITOR_STD_HPP_
 #define MONITOR_STD_HPP_
 
+#include <atomic>
 #include <chrono>
 #include <vector>
 #include <functional>
@@ -17,11 +18,13 @@ class Monitor_BFER : public Monitor
 protected:
 	const unsigned max_fe;
 
-	unsigned long long n_bit_errors;
-	unsigned long long n_frame_errors;
-	unsigned long long n_analyzed_frames;
+	// the counters are written by one thread and read by the others: they are aligned on a cache line (and the next
+	// member too) to avoid false sharing
+	alignas(64) std::atomic<unsigned long long> n_bit_errors;
+	            std::atomic<unsigned long long> n_frame_errors;
+	            std::atomic<unsigned long long> n_analyzed_frames;
 
-	std::vector<std::function<void(unsigned, int )>> callbacks_fe;
+	alignas(64) std::vector<std::function<void(unsigned, int )>> callbacks_fe;
 	std::vector<std::function<void(          void)>> callbacks_check;
 	std::vector<std::function<void(          void)>> callbacks_fe_limit_achieved;
 
@@ -75,6 +78,7 @@ public:
 	virtual unsigned long long get_n_analyzed_fra() const;
 	virtual unsigned long long get_n_fe          () const;
 	virtual unsigned long long get_n_be          () const;
+	virtual unsigned long long get_n_fe_estimate () const; // cheaper than 'get_n_fe' but may lag behind it
 
 	float get_fer() const;
 	float get_ber() const;
@@ -86,8 +90,14 @@ public:
 	virtual void reset();
 	virtual void clear_callbacks();
 
-protected:
-	virtual int _check_errors(const B *U, const B *V, const int frame_id);
+	/*!
+	 * \brief Moves the counters of an other monitor into this one (the counters of 'm' are set to zero).
+	 *
+	 * Both monitors have to be written by the calling thread only, the callbacks are not triggered.
+	 *
+	 * \param m: the monitor to empty.
+	 */
+	void collect(Monitor_BFER<B> &m);
 };
 }
 }
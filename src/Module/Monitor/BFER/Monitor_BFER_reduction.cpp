@@ -4,6 +4,8 @@
 #include <fstream>
 #include <sstream>
 
+#include <algorithm>
+
 #include "Tools/Exception/exception.hpp"
 
 #include "Monitor_BFER_reduction.hpp"
@@ -18,7 +20,11 @@ Monitor_BFER_reduction<B>
                   (monitors.size() && monitors[0]) ? monitors[0]->get_fe_limit() : 1,
                   (monitors.size() && monitors[0]) ? monitors[0]->get_n_frames() : 1),
   n_analyzed_frames_historic(0),
-  monitors(monitors)
+  monitors(monitors),
+  n_fe_local((monitors.size() +1) * fe_local_stride, 0),
+  n_fe_shared(0),
+  fe_limit_flag(false),
+  n_monitors(monitors.size())
 {
 	const std::string name = "Monitor_BFER_reduction";
 	this->set_name(name);
@@ -66,6 +72,8 @@ Monitor_BFER_reduction<B>
 			throw tools::logic_error(__FILE__, __LINE__, __func__, message.str());
 		}
 	}
+
+	this->add_handlers_fe_shared();
 }
 
 template <typename B>
@@ -78,7 +86,7 @@ template <typename B>
 unsigned long long Monitor_BFER_reduction<B>
 ::get_n_analyzed_fra() const
 {
-	unsigned long long cur_fra = this->n_analyzed_frames;
+	auto cur_fra = this->n_analyzed_frames.load(std::memory_order_relaxed);
 	for (unsigned i = 0; i < monitors.size(); i++)
 		cur_fra += monitors[i]->get_n_analyzed_fra();
 
@@ -96,24 +104,43 @@ template <typename B>
 unsigned long long Monitor_BFER_reduction<B>
 ::get_n_fe() const
 {
-	auto cur_fe = this->n_frame_errors;
+	auto cur_fe = this->n_frame_errors.load(std::memory_order_relaxed);
 	for (unsigned i = 0; i < monitors.size(); i++)
 		cur_fe += monitors[i]->get_n_fe();
 
 	return cur_fe;
 }
 
+template <typename B>
+unsigned long long Monitor_BFER_reduction<B>
+::get_n_fe_estimate() const
+{
+	// O(1): the frame errors published by the monitors (see 'add_handlers_fe_shared'), they miss at most the last batch
+	// of each monitor. Nothing is published when the errors are moved by 'collect' instead of being checked by the
+	// monitors: walk the monitors in this case
+	const auto n_fe_pub = this->n_fe_shared.load(std::memory_order_relaxed);
+	return n_fe_pub ? n_fe_pub + this->n_frame_errors.load(std::memory_order_relaxed) : this->get_n_fe();
+}
+
 template <typename B>
 unsigned long long Monitor_BFER_reduction<B>
 ::get_n_be() const
 {
-	auto cur_be = this->n_bit_errors;
+	auto cur_be = this->n_bit_errors.load(std::memory_order_relaxed);
 	for (unsigned i = 0; i < monitors.size(); i++)
 		cur_be += monitors[i]->get_n_be();
 
 	return cur_be;
 }
 
+template <typename B>
+bool Monitor_BFER_reduction<B>
+::fe_limit_achieved()
+{
+	// O(1) polling: the flag is raised by the monitor which crosses the limit (see 'add_handlers_fe_shared')
+	return this->fe_limit_flag.load(std::memory_order_relaxed) || Monitor::interrupt;
+}
+
 template <typename B>
 void Monitor_BFER_reduction<B>
 ::reset()
@@ -122,6 +149,10 @@ void Monitor_BFER_reduction<B>
 	Monitor_BFER<B>::reset();
 	for (auto m : monitors)
 		m->reset();
+
+	std::fill(this->n_fe_local.begin(), this->n_fe_local.end(), 0);
+	this->n_fe_shared  .store(0,     std::memory_order_relaxed);
+	this->fe_limit_flag.store(false, std::memory_order_relaxed);
 }
 
 template <typename B>
@@ -131,6 +162,37 @@ void Monitor_BFER_reduction<B>
 	Monitor_BFER<B>::clear_callbacks();
 	for (auto m : monitors)
 		m->clear_callbacks();
+
+	this->add_handlers_fe_shared();
+}
+
+template <typename B>
+void Monitor_BFER_reduction<B>
+::add_handlers_fe_shared()
+{
+	// the frame errors are counted locally and published in batches: a monitor publishes its errors when they reach
+	// 1/n_monitors of the errors remaining before the limit, the batches shrink when the limit approaches and the limit
+	// is detected at most a few frames after being crossed
+	for (size_t m = 0; m < monitors.size(); m++)
+		monitors[m]->add_handler_fe([this, m](unsigned, int)
+		{
+			auto &n_fe_loc = this->n_fe_local[(m +1) * fe_local_stride];
+			n_fe_loc++;
+
+			const unsigned long long fe_limit = this->get_fe_limit();
+			const auto n_fe = this->n_fe_shared   .load(std::memory_order_relaxed) +
+			                  this->n_frame_errors.load(std::memory_order_relaxed);
+			const auto remaining = n_fe < fe_limit ? fe_limit - n_fe : 0;
+
+			if (n_fe_loc * this->n_monitors >= remaining)
+			{
+				const auto n_fe_pub = this->n_fe_shared.fetch_add(n_fe_loc, std::memory_order_relaxed) + n_fe_loc;
+				n_fe_loc = 0;
+
+				if (n_fe_pub + this->n_frame_errors.load(std::memory_order_relaxed) >= fe_limit)
+					this->fe_limit_flag.store(true, std::memory_order_relaxed);
+			}
+		});
 }
 
 // ==================================================================================== explicit template instantiation 
@@ -1,6 +1,7 @@
 #ifndef MONITOR_REDUCTION_HPP_
 #define MONITOR_REDUCTION_HPP_
 
+#include <atomic>
 #include <string>
 #include <vector>
 
@@ -17,6 +18,18 @@ private:
 	unsigned long long n_analyzed_frames_historic;
 	std::vector<Monitor_BFER<B>*> monitors;
 
+	// frame errors not yet published in 'n_fe_shared', one counter per monitor (written by the thread of the monitor
+	// only), the counters are 'fe_local_stride' apart to avoid false sharing
+	static constexpr size_t fe_local_stride = 64 / sizeof(unsigned long long);
+	std::vector<unsigned long long> n_fe_local;
+
+	// shared by all the threads: aligned on a cache line (and the next member too) to avoid false sharing
+	alignas(64) std::atomic<unsigned long long> n_fe_shared;   // frame errors published by the monitors since the last
+	                                                           // reset
+	            std::atomic<bool>               fe_limit_flag; // raised once by the thread which crosses the frame
+	                                                           // errors limit
+	alignas(64) const size_t                    n_monitors;
+
 public:
 	Monitor_BFER_reduction(const std::vector<Monitor_BFER<B>*> &monitors);
 	virtual ~Monitor_BFER_reduction();
@@ -25,9 +38,15 @@ public:
 	unsigned long long get_n_analyzed_fra         () const;
 	unsigned long long get_n_fe                   () const;
 	unsigned long long get_n_be                   () const;
+	unsigned long long get_n_fe_estimate          () const;
+
+	virtual bool fe_limit_achieved();
 
 	virtual void reset();
 	virtual void clear_callbacks();
+
+private:
+	void add_handlers_fe_shared();
 };
 }
 }
@@ -10,13 +10,6 @@
 using namespace aff3ct;
 using namespace aff3ct::module;
 
-struct monitor_vals
-{
-	unsigned long long n_be;
-	unsigned long long n_fe;
-	unsigned long long n_fra;
-};
-
 void MPI_SUM_monitor_vals_func(void *in, void *inout, int *len, MPI_Datatype *datatype)
 {
 	auto    in_cvt = static_cast<monitor_vals*>(in   );
@@ -24,9 +17,10 @@ void MPI_SUM_monitor_vals_func(void *in, void *inout, int *len, MPI_Datatype *da
 
 	for (auto i = 0; i < *len; i++)
 	{
-		inout_cvt[i].n_be  += in_cvt[i].n_be;
-		inout_cvt[i].n_fe  += in_cvt[i].n_fe;
-		inout_cvt[i].n_fra += in_cvt[i].n_fra;
+		inout_cvt[i].n_be   += in_cvt[i].n_be;
+		inout_cvt[i].n_fe   += in_cvt[i].n_fe;
+		inout_cvt[i].n_fra  += in_cvt[i].n_fra;
+		inout_cvt[i].n_stop += in_cvt[i].n_stop;
 	}
 }
 
@@ -37,22 +31,26 @@ Monitor_BFER_reduction_mpi<B>
                              const std::chrono::nanoseconds d_mpi_comm_frequency)
 : Monitor_BFER_reduction<B>(monitors),
   master_thread_id(master_thread_id),
-  is_fe_limit_achieved(false),
+  stop_agreed(false),
+  stop_requested(false),
   t_last_mpi_comm(std::chrono::steady_clock::now()),
-  d_mpi_comm_frequency(d_mpi_comm_frequency)
+  d_mpi_comm_frequency(d_mpi_comm_frequency),
+  request(MPI_REQUEST_NULL),
+  comm_pending(false)
 {
 	const std::string name = "Monitor_BFER_reduction_mpi";
 	this->set_name(name);
 
-	int blen[3];
-	MPI_Aint displacements[3];
-	MPI_Datatype oldtypes[3];
+	int blen[4];
+	MPI_Aint displacements[4];
+	MPI_Datatype oldtypes[4];
 
-	blen[0] = 1; displacements[0] = offsetof(monitor_vals, n_be);  oldtypes[0] = MPI_UNSIGNED_LONG_LONG;
-	blen[1] = 1; displacements[1] = offsetof(monitor_vals, n_fe);  oldtypes[1] = MPI_UNSIGNED_LONG_LONG;
-	blen[2] = 1; displacements[2] = offsetof(monitor_vals, n_fra); oldtypes[2] = MPI_UNSIGNED_LONG_LONG;
+	blen[0] = 1; displacements[0] = offsetof(monitor_vals, n_be);   oldtypes[0] = MPI_UNSIGNED_LONG_LONG;
+	blen[1] = 1; displacements[1] = offsetof(monitor_vals, n_fe);   oldtypes[1] = MPI_UNSIGNED_LONG_LONG;
+	blen[2] = 1; displacements[2] = offsetof(monitor_vals, n_fra);  oldtypes[2] = MPI_UNSIGNED_LONG_LONG;
+	blen[3] = 1; displacements[3] = offsetof(monitor_vals, n_stop); oldtypes[3] = MPI_UNSIGNED_LONG_LONG;
 
-	if (auto ret = MPI_Type_create_struct(3, blen, displacements, oldtypes, &MPI_monitor_vals))
+	if (auto ret = MPI_Type_create_struct(4, blen, displacements, oldtypes, &MPI_monitor_vals))
 	{
 		std::stringstream message;
 		message << "'MPI_Type_create_struct' returned '" << ret << "' error code.";
@@ -85,34 +83,106 @@ bool Monitor_BFER_reduction_mpi<B>
 ::fe_limit_achieved()
 {
 	// only the master thread can do this
-	if (std::this_thread::get_id() == this->master_thread_id &&
-	    ((std::chrono::steady_clock::now() - t_last_mpi_comm) >= d_mpi_comm_frequency))
+	if (std::this_thread::get_id() == this->master_thread_id)
 	{
-		monitor_vals mvals_recv;
-		monitor_vals mvals_send = { this->get_n_be()           - this->n_bit_errors,
-		                            this->get_n_fe()           - this->n_frame_errors,
-		                            this->get_n_analyzed_fra() - this->n_analyzed_frames };
+		if (comm_pending)
+		{
+			int completed = 0;
+			if (auto ret = MPI_Test(&request, &completed, MPI_STATUS_IGNORE))
+			{
+				std::stringstream message;
+				message << "'MPI_Test' returned '" << ret << "' error code.";
+				throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+			}
+
+			if (completed)
+				this->end_reduction();
+		}
+		else if (!stop_agreed && (std::chrono::steady_clock::now() - t_last_mpi_comm) >= d_mpi_comm_frequency)
+			this->start_reduction();
+	}
 
-		MPI_Allreduce(&mvals_send, &mvals_recv, 1, MPI_monitor_vals, MPI_SUM_monitor_vals, MPI_COMM_WORLD);
+	return stop_agreed;
+}
 
-		this->n_bit_errors      = mvals_recv.n_be  - mvals_send.n_be;
-		this->n_frame_errors    = mvals_recv.n_fe  - mvals_send.n_fe;
-		this->n_analyzed_frames = mvals_recv.n_fra - mvals_send.n_fra;
+template <typename B>
+void Monitor_BFER_reduction_mpi<B>
+::wait_termination()
+{
+	stop_requested = true;
 
-		t_last_mpi_comm = std::chrono::steady_clock::now();
+	while (!stop_agreed)
+	{
+		if (!comm_pending)
+			this->start_reduction();
 
-		is_fe_limit_achieved = mvals_recv.n_fe >= this->get_fe_limit();
+		if (auto ret = MPI_Wait(&request, MPI_STATUS_IGNORE))
+		{
+			std::stringstream message;
+			message << "'MPI_Wait' returned '" << ret << "' error code.";
+			throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		this->end_reduction();
 	}
+}
 
-	return is_fe_limit_achieved;
+template <typename B>
+void Monitor_BFER_reduction_mpi<B>
+::start_reduction()
+{
+	// the counters of the reduction hold the values of the other nodes, send only the local values
+	mvals_send = { this->get_n_be()           - this->n_bit_errors     .load(std::memory_order_relaxed),
+	               this->get_n_fe()           - this->n_frame_errors   .load(std::memory_order_relaxed),
+	               this->get_n_analyzed_fra() - this->n_analyzed_frames.load(std::memory_order_relaxed),
+	               stop_requested ? 1ull : 0ull };
+
+	if (auto ret = MPI_Iallreduce(&mvals_send, &mvals_recv, 1, MPI_monitor_vals, MPI_SUM_monitor_vals,
+	                              MPI_COMM_WORLD, &request))
+	{
+		std::stringstream message;
+		message << "'MPI_Iallreduce' returned '" << ret << "' error code.";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	comm_pending = true;
+}
+
+template <typename B>
+void Monitor_BFER_reduction_mpi<B>
+::end_reduction()
+{
+	comm_pending = false;
+
+	this->n_bit_errors     .store(mvals_recv.n_be  - mvals_send.n_be,  std::memory_order_relaxed);
+	this->n_frame_errors   .store(mvals_recv.n_fe  - mvals_send.n_fe,  std::memory_order_relaxed);
+	this->n_analyzed_frames.store(mvals_recv.n_fra - mvals_send.n_fra, std::memory_order_relaxed);
+
+	t_last_mpi_comm = std::chrono::steady_clock::now();
+
+	// all the nodes receive the same values so they all take the same decision after the same reduction
+	stop_agreed = mvals_recv.n_fe >= this->get_fe_limit() || mvals_recv.n_stop > 0;
 }
 
 template <typename B>
 void Monitor_BFER_reduction_mpi<B>
 ::reset()
 {
+	if (comm_pending)
+	{
+		comm_pending = false;
+		if (auto ret = MPI_Wait(&request, MPI_STATUS_IGNORE))
+		{
+			std::stringstream message;
+			message << "'MPI_Wait' returned '" << ret << "' error code.";
+			throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+
 	Monitor_BFER_reduction<B>::reset();
-	is_fe_limit_achieved = false;
+	stop_agreed     = false;
+	stop_requested  = false;
+	t_last_mpi_comm = std::chrono::steady_clock::now();
 }
 
 // ==================================================================================== explicit template instantiation 
@@ -3,6 +3,7 @@
 #ifndef MONITOR_REDUCTION_MPI_HPP_
 #define MONITOR_REDUCTION_MPI_HPP_
 
+#include <atomic>
 #include <thread>
 #include <chrono>
 #include <vector>
@@ -15,12 +16,22 @@ namespace aff3ct
 {
 namespace module
 {
+// the values reduced between the MPI nodes
+struct monitor_vals
+{
+	unsigned long long n_be;
+	unsigned long long n_fe;
+	unsigned long long n_fra;
+	unsigned long long n_stop; // number of nodes which stopped on their own (time limit, frame limit...)
+};
+
 template <typename B = int>
 class Monitor_BFER_reduction_mpi : public Monitor_BFER_reduction<B>
 {
 private:
 	const std::thread::id master_thread_id;
-	bool is_fe_limit_achieved;
+	std::atomic<bool> stop_agreed;    // all the nodes know that the simulation point is over
+	bool              stop_requested; // the current node stopped on its own
 
 	std::chrono::time_point<std::chrono::steady_clock, std::chrono::nanoseconds> t_last_mpi_comm;
 	std::chrono::nanoseconds                                                     d_mpi_comm_frequency;
@@ -28,15 +39,39 @@ private:
 	MPI_Datatype MPI_monitor_vals;
 	MPI_Op       MPI_SUM_monitor_vals;
 
+	// the non-blocking reduction in progress
+	MPI_Request  request;
+	bool         comm_pending;
+	monitor_vals mvals_send;
+	monitor_vals mvals_recv;
+
 public:
 	Monitor_BFER_reduction_mpi(const std::vector<Monitor_BFER<B>*> &monitors,
 	                           const std::thread::id master_thread_id,
 	                           const std::chrono::nanoseconds d_mpi_comm_frequency = std::chrono::milliseconds(1000));
 	virtual ~Monitor_BFER_reduction_mpi();
 
+	/*!
+	 * \brief Returns true when all the nodes agreed that the global frame error limit is achieved.
+	 *
+	 * The master thread starts a non-blocking reduction every 'd_mpi_comm_frequency' and checks its progress at each
+	 * call: the nodes never wait for each other here.
+	 */
 	bool fe_limit_achieved();
 
+	/*!
+	 * \brief Blocks until all the nodes agreed to stop the current simulation point.
+	 *
+	 * Has to be called by the master thread when the node stops simulating: the node keeps taking part to the
+	 * reductions (and asks the other nodes to stop) so all the nodes run the same number of reductions.
+	 */
+	void wait_termination();
+
 	void reset();
+
+private:
+	void start_reduction();
+	void end_reduction  ();
 };
 }
 }
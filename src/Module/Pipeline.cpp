@@ -0,0 +1,291 @@
+#include <thread>
+#include <sstream>
+#include <numeric>
+#include <algorithm>
+#include <stdexcept>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Module.hpp"
+#include "Socket.hpp"
+#include "Pipeline.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+// search the last task before 'k' which writes in 'dataptr', returns false if the data are not produced by the chain
+static bool find_producer(const std::vector<Task*> &tasks, const size_t k, const void *dataptr, size_t &pk, size_t &ps)
+{
+	for (pk = k; pk-- > 0;)
+		for (ps = 0; ps < tasks[pk]->sockets.size(); ps++)
+			if (tasks[pk]->get_socket_type(*tasks[pk]->sockets[ps]) != Socket_type::IN &&
+			    tasks[pk]->sockets[ps]->get_dataptr() == dataptr)
+				return true;
+	return false;
+}
+
+Pipeline::Pipeline(const std::vector<Sequence*> &chains,
+                   const std::vector<size_t   > &splits,
+                   const std::vector<size_t   > &n_replicas,
+                   const size_t                  buffer_size)
+: n_stages(n_replicas.size()),
+  buffer_size(buffer_size),
+  stages(n_stages),
+  ptrs_in(n_stages),
+  ptrs_out(n_stages),
+  bytes_in(n_stages),
+  rings(n_stages),
+  n_alive(n_stages),
+  abort(false)
+{
+	if (n_stages == 0)
+	{
+		std::stringstream message;
+		message << "'n_replicas.size()' has to be greater than 0.";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (splits.size() != n_stages -1)
+	{
+		std::stringstream message;
+		message << "'splits.size()' has to be equal to 'n_replicas.size()' - 1 ('splits.size()' = " << splits.size()
+		        << ", 'n_replicas.size()' = " << n_stages << ").";
+		throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (buffer_size == 0)
+	{
+		std::stringstream message;
+		message << "'buffer_size' has to be greater than 0.";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	for (auto n : n_replicas)
+		if (n == 0)
+		{
+			std::stringstream message;
+			message << "All the stages have to be replicated at least once.";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+	const auto n_chains = std::accumulate(n_replicas.begin(), n_replicas.end(), (size_t)0);
+	if (chains.size() < n_chains)
+	{
+		std::stringstream message;
+		message << "'chains.size()' has to be equal or greater than the total number of replicas ('chains.size()' = "
+		        << chains.size() << ", 'n_chains' = " << n_chains << ").";
+		throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	const auto &ref = chains[0]->get_tasks();
+	const auto n_tasks = ref.size();
+
+	for (size_t c = 1; c < n_chains; c++)
+		if (chains[c]->size() != n_tasks)
+		{
+			std::stringstream message;
+			message << "All the chains have to be made of the same tasks ('chains[0]->size()' = " << n_tasks
+			        << ", 'c' = " << c << ", 'chains[c]->size()' = " << chains[c]->size() << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+	// the first task of each stage
+	std::vector<size_t> first(n_stages +1, 0);
+	for (size_t s = 1; s < n_stages; s++)
+	{
+		first[s] = splits[s -1];
+		if (first[s] <= first[s -1] || first[s] >= n_tasks)
+		{
+			std::stringstream message;
+			message << "'splits' has to be strictly increasing, without empty stage ('s' = " << s
+			        << ", 'splits[s -1]' = " << splits[s -1] << ", 'n_tasks' = " << n_tasks << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+	first[n_stages] = n_tasks;
+
+	// the buffers which cross each cut, identified by their producer (task id, socket id) in the chains
+	std::vector<std::vector<std::pair<size_t,size_t>>> transfers(n_stages);
+	for (size_t k = 0; k < n_tasks; k++)
+		for (auto *sck : ref[k]->sockets)
+		{
+			size_t pk, ps;
+			if (ref[k]->get_socket_type(*sck) == Socket_type::OUT ||
+			    !find_producer(ref, k, sck->get_dataptr(), pk, ps))
+				continue;
+
+			for (size_t s = 1; s < n_stages; s++)
+				if (pk < first[s] && k >= first[s])
+				{
+					const auto p = std::make_pair(pk, ps);
+					if (std::find(transfers[s].begin(), transfers[s].end(), p) == transfers[s].end())
+						transfers[s].push_back(p);
+				}
+		}
+
+	// each replica runs on its own chain
+	auto c = 0;
+	for (size_t s = 0; s < n_stages; s++)
+	{
+		for (auto &p : transfers[s])
+			bytes_in[s].push_back(ref[p.first]->sockets[p.second]->get_databytes());
+
+		stages  [s].resize(n_replicas[s]);
+		ptrs_in [s].resize(n_replicas[s]);
+		ptrs_out[s].resize(n_replicas[s]);
+		for (size_t r = 0; r < n_replicas[s]; r++, c++)
+		{
+			const auto &tasks = chains[c]->get_tasks();
+
+			for (auto k = first[s]; k < first[s +1]; k++)
+				stages[s][r].push_back(*tasks[k]);
+
+			for (auto &p : transfers[s])
+				ptrs_in[s][r].push_back(tasks[p.first]->sockets[p.second]->get_dataptr());
+
+			if (s +1 < n_stages)
+				for (auto &p : transfers[s +1])
+					ptrs_out[s][r].push_back(tasks[p.first]->sockets[p.second]->get_dataptr());
+		}
+	}
+
+	for (size_t s = 1; s < n_stages; s++)
+	{
+		rings[s].resize(n_replicas[s -1]);
+		for (auto &r : rings[s])
+			for (size_t n = 0; n < n_replicas[s]; n++)
+				r.push_back(new tools::SPSC_ring_buffer(buffer_size, bytes_in[s]));
+	}
+}
+
+Pipeline::~Pipeline()
+{
+	for (auto &s : rings)
+		for (auto &p : s)
+			for (auto r : p)
+				delete r;
+}
+
+void Pipeline::exec(std::function<bool(void)> stop_condition)
+{
+	this->abort = false;
+	this->prev_err_messages.clear();
+	for (size_t s = 0; s < this->n_stages; s++)
+		this->n_alive[s] = this->stages[s].size();
+
+	std::vector<std::thread> threads;
+	for (size_t s = 0; s < this->n_stages; s++)
+		for (size_t r = 0; r < this->stages[s].size(); r++)
+			if (s || r)
+				threads.push_back(std::thread(Pipeline::start_thread, this, s, r, &stop_condition));
+
+	// the first replica of the first stage runs on the calling thread
+	Pipeline::start_thread(this, 0, 0, &stop_condition);
+
+	for (auto &t : threads)
+		t.join();
+
+	if (!this->prev_err_messages.empty())
+		throw std::runtime_error(this->prev_err_messages.back());
+}
+
+void Pipeline::start_thread(Pipeline *pipeline, const size_t s, const size_t r,
+                            std::function<bool(void)> *stop_condition)
+{
+	try
+	{
+		pipeline->_exec_stage(s, r, *stop_condition);
+	}
+	catch (std::exception const& e)
+	{
+		pipeline->abort = true;
+
+		pipeline->mutex_exception.lock();
+		if (std::find(pipeline->prev_err_messages.begin(), pipeline->prev_err_messages.end(), e.what()) ==
+		    pipeline->prev_err_messages.end())
+			pipeline->prev_err_messages.push_back(e.what());
+		pipeline->mutex_exception.unlock();
+	}
+
+	pipeline->n_alive[s]--;
+}
+
+void Pipeline::_exec_stage(const size_t s, const size_t r, std::function<bool(void)> &stop_condition)
+{
+	auto &sequence = this->stages  [s][r];
+	auto &in       = this->ptrs_in [s][r];
+	auto &out      = this->ptrs_out[s][r];
+
+	// the rings are visited in round-robin to balance the load between the replicas
+	size_t rr_in = 0, rr_out = 0;
+
+	while (!this->abort)
+	{
+		if (s == 0)
+		{
+			if (stop_condition())
+				break;
+		}
+		else
+		{
+			auto &rings_in = this->rings[s];
+			const std::vector<std::vector<uint8_t>>* slot = nullptr;
+			tools::SPSC_ring_buffer* ring = nullptr;
+			while (slot == nullptr && !this->abort)
+			{
+				// the previous stage is checked before the rings to not miss its last frames
+				const auto prev_over = this->n_alive[s -1] == 0;
+				for (size_t i = 0; i < rings_in.size() && slot == nullptr; i++)
+				{
+					ring = rings_in[(rr_in + i) % rings_in.size()][r];
+					slot = ring->get_slot_read();
+					if (slot != nullptr)
+						rr_in = (rr_in + i + 1) % rings_in.size();
+				}
+
+				if (slot == nullptr)
+				{
+					if (prev_over)
+						return;
+					std::this_thread::yield();
+				}
+			}
+
+			if (slot == nullptr)
+				return;
+
+			for (size_t b = 0; b < in.size(); b++)
+				std::copy((*slot)[b].begin(), (*slot)[b].end(), (uint8_t*)in[b]);
+			ring->pop();
+		}
+
+		sequence.exec();
+
+		if (s +1 < this->n_stages)
+		{
+			auto &rings_out = this->rings[s +1][r];
+			std::vector<std::vector<uint8_t>>* slot = nullptr;
+			tools::SPSC_ring_buffer* ring = nullptr;
+			while (slot == nullptr && !this->abort)
+			{
+				for (size_t i = 0; i < rings_out.size() && slot == nullptr; i++)
+				{
+					ring = rings_out[(rr_out + i) % rings_out.size()];
+					slot = ring->get_slot_write();
+					if (slot != nullptr)
+						rr_out = (rr_out + i + 1) % rings_out.size();
+				}
+
+				if (slot == nullptr)
+					std::this_thread::yield();
+			}
+
+			if (slot == nullptr)
+				return;
+
+			for (size_t b = 0; b < out.size(); b++)
+				std::copy((uint8_t*)out[b], (uint8_t*)out[b] + (*slot)[b].size(), (*slot)[b].begin());
+			ring->push();
+		}
+	}
+}
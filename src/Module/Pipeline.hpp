@@ -0,0 +1,99 @@
+/*!
+ * \file
+ * \brief A Pipeline executes the stages of a communication chain on several threads at the same time.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef PIPELINE_HPP_
+#define PIPELINE_HPP_
+
+#include <mutex>
+#include <atomic>
+#include <string>
+#include <vector>
+#include <utility>
+#include <functional>
+
+#include "Tools/Threads/SPSC_ring_buffer.hpp"
+
+#include "Sequence.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Pipeline
+ *
+ * \brief A Pipeline executes the stages of a communication chain on several threads at the same time.
+ *
+ * The chain is cut into consecutive stages and each stage runs on its own thread(s). A stage can be replicated: each
+ * replica runs on its own copy of the chain (the copies have to be built and bound the same way). The frames go from
+ * a stage to the next one through lock-free SPSC ring buffers (one ring per couple of producer/consumer replicas).
+ * The data transferred between two stages are deduced from the sockets binding: every buffer produced before the cut
+ * and read after the cut is copied into the ring.
+ *
+ * Because of the replicated stages, the frames can be processed out of order by the last stages.
+ */
+class Pipeline
+{
+protected:
+	const size_t n_stages;
+	const size_t buffer_size;
+
+	// [stage][replica]
+	std::vector<std::vector<Sequence          >> stages;
+	std::vector<std::vector<std::vector<void*>>> ptrs_in;  // where the data from the previous stage are copied
+	std::vector<std::vector<std::vector<void*>>> ptrs_out; // where the data for the next stage are read
+
+	// [stage] the size of the buffers received from the previous stage
+	std::vector<std::vector<size_t>> bytes_in;
+
+	// [stage][producer replica][consumer replica] the rings between the previous stage and the current one
+	std::vector<std::vector<std::vector<tools::SPSC_ring_buffer*>>> rings;
+
+	std::vector<std::atomic<size_t>> n_alive; // number of replicas still running in each stage
+	std::atomic<bool>                abort;
+
+	std::mutex               mutex_exception;
+	std::vector<std::string> prev_err_messages;
+
+public:
+	/*!
+	 * \brief Constructor.
+	 *
+	 * \param chains:      the copies of the communication chain (all bound), one per replica of all the stages.
+	 * \param splits:      the index (in the chains) of the first task of each stage, except the first stage.
+	 * \param n_replicas:  the number of replicas of each stage.
+	 * \param buffer_size: the number of frames (batches of 'n_frames') which can be stored between two replicas.
+	 */
+	Pipeline(const std::vector<Sequence*> &chains,
+	         const std::vector<size_t   > &splits,
+	         const std::vector<size_t   > &n_replicas,
+	         const size_t                  buffer_size = 16);
+
+	/*!
+	 * \brief Destructor.
+	 */
+	virtual ~Pipeline();
+
+	/*!
+	 * \brief Runs all the stages until the stop condition is true, then waits until the last frames are processed.
+	 *
+	 * \param stop_condition: called by the first stage before each new frame (has to be thread safe).
+	 */
+	void exec(std::function<bool(void)> stop_condition);
+
+	inline size_t get_n_stages() const { return this->n_stages; }
+
+private:
+	void _exec_stage(const size_t s, const size_t r, std::function<bool(void)> &stop_condition);
+
+	static void start_thread(Pipeline *pipeline, const size_t s, const size_t r,
+	                         std::function<bool(void)> *stop_condition);
+};
+}
+}
+
+#endif /* PIPELINE_HPP_ */
@@ -0,0 +1,42 @@
+#include <sstream>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Module.hpp"
+#include "Sequence.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+Sequence::Sequence()
+: fast(true)
+{
+}
+
+Sequence::~Sequence()
+{
+}
+
+void Sequence::push_back(Task &task)
+{
+	if (!task.can_exec())
+	{
+		std::stringstream message;
+		message << "The task cannot be added to the sequence because some of the inputs/outputs are not fed "
+		        << "('task.name' = " << task.get_name() << ", 'module.name' = " << task.get_module().get_name()
+		        << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	this->tasks   .push_back(&task       );
+	this->codelets.push_back(task.codelet);
+
+	this->fast = this->fast && task.is_fast();
+}
+
+void Sequence::clear()
+{
+	this->tasks   .clear();
+	this->codelets.clear();
+	this->fast = true;
+}
@@ -0,0 +1,84 @@
+/*!
+ * \file
+ * \brief A Sequence is a flat, pre-resolved list of Tasks executed one after the other.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef SEQUENCE_HPP_
+#define SEQUENCE_HPP_
+
+#include <vector>
+#include <functional>
+
+#include "Task.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Sequence
+ *
+ * \brief A Sequence is a flat, pre-resolved list of Tasks executed one after the other.
+ *
+ * The Sequence is built once after the sockets binding (the disabled stages are simply not pushed into it). When all
+ * the pushed Tasks are in the "fast" mode (no debug and no stats), the codelets are called directly, skipping the
+ * checks and the branches of Task::exec().
+ */
+class Sequence
+{
+protected:
+	std::vector<Task*                   > tasks;
+	std::vector<std::function<int(void)>> codelets;
+	bool                                  fast;
+
+public:
+	/*!
+	 * \brief Constructor.
+	 */
+	Sequence();
+
+	/*!
+	 * \brief Destructor.
+	 */
+	virtual ~Sequence();
+
+	/*!
+	 * \brief Appends a Task at the end of the Sequence.
+	 *
+	 * \param task: a Task with all its sockets already bound.
+	 */
+	void push_back(Task &task);
+
+	/*!
+	 * \brief Removes all the Tasks from the Sequence.
+	 */
+	void clear();
+
+	inline size_t size   () const { return this->tasks.size(); }
+	inline bool   is_fast() const { return this->fast;         }
+
+	inline const std::vector<Task*>& get_tasks() const { return this->tasks; }
+
+	/*!
+	 * \brief Executes all the Tasks of the Sequence in order.
+	 *
+	 * \return the status of the last executed Task.
+	 */
+	inline int exec()
+	{
+		int status = 0;
+		if (this->fast)
+			for (auto &c : this->codelets)
+				status = c();
+		else
+			for (auto *t : this->tasks)
+				status = t->exec();
+		return status;
+	}
+};
+}
+}
+
+#endif /* SEQUENCE_HPP_ */
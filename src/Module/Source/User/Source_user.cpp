@@ -10,12 +10,20 @@ using namespace aff3ct::module;
 
 template <typename B>
 Source_user<B>
-::Source_user(const int K, const std::string filename, const int n_frames)
-: Source<B>(K, n_frames), source(), src_counter(0)
+::Source_user(const int K, const std::string filename, const int n_frames, const int stream_id, const int n_streams)
+: Source<B>(K, n_frames), source(), src_counter(0), n_streams(n_streams)
 {
 	const std::string name = "Source_user";
 	this->set_name(name);
 
+	if (n_streams <= 0 || stream_id < 0 || stream_id >= n_streams)
+	{
+		std::stringstream message;
+		message << "'stream_id' has to be positive and smaller than 'n_streams' ('stream_id' = " << stream_id
+		        << ", 'n_streams' = " << n_streams << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
 	if (filename.empty())
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "'filename' should not be empty.");
 
@@ -61,6 +69,8 @@ Source_user<B>
 		}
 
 		file.close();
+
+		this->src_counter = stream_id % n_src;
 	}
 	else
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "Can't open '" + filename + "' file.");
@@ -80,7 +90,7 @@ void Source_user<B>
 	          this->source[this->src_counter].end  (),
 	          U_K);
 
-	this->src_counter = (this->src_counter +1) % (int)this->source.size();
+	this->src_counter = (this->src_counter + this->n_streams) % (int)this->source.size();
 }
 
 // ==================================================================================== explicit template instantiation 
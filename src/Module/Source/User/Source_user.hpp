@@ -17,9 +17,11 @@ class Source_user : public Source<B>
 private:
 	std::vector<std::vector<B>> source;
 	int src_counter;
+	const int n_streams;
 
 public:
-	Source_user(const int K, std::string filename, const int n_frames = 1);
+	Source_user(const int K, std::string filename, const int n_frames = 1, const int stream_id = 0,
+	            const int n_streams = 1);
 	virtual ~Source_user();
 
 protected:
@@ -23,6 +23,7 @@ namespace module
 {
 class Module;
 class Socket;
+class Sequence;
 
 enum Socket_type
 {
@@ -35,6 +36,7 @@ class Task
 {
 	friend Socket;
 	friend Module;
+	friend Sequence;
 
 protected:
 	const Module &module;
@@ -96,7 +98,7 @@ public:
 	inline bool is_debug            (                  ) const { return this->debug;                }
 	inline bool is_debug_hex        (                  ) const { return this->debug_hex;            }
 	inline bool is_last_input_socket(const Socket &s_in) const { return last_input_socket == &s_in; }
-	inline bool can_exec            (                  ) const;
+	       bool can_exec            (                  ) const;
 
 	inline const Module& get_module     (               ) const { return this->module;  }
 	inline std::string   get_name       (               ) const { return this->name;    }
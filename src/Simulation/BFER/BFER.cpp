@@ -45,7 +45,9 @@ BFER<B,R,Q>
   monitor_red(                       nullptr),
   dumper     (params_BFER.n_threads, nullptr),
   dumper_red (                       nullptr),
-  terminal   (                       nullptr)
+  terminal   (                       nullptr),
+
+  scheduler(params_BFER.n_threads)
 {
 	if (params_BFER.n_threads < 1)
 	{
@@ -54,6 +56,22 @@ BFER<B,R,Q>
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
 	}
 
+	if (params_BFER.snr_concurrent && (params_BFER.err_track_enable || params_BFER.err_track_revert))
+	{
+		std::stringstream message;
+		message << "The concurrent simulation of the SNR points is not compatible with the bad frames tracking.";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+#ifdef ENABLE_MPI
+	if (params_BFER.snr_concurrent)
+	{
+		std::stringstream message;
+		message << "The concurrent simulation of the SNR points is not compatible with MPI.";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+#endif
+
 	if (params_BFER.err_track_enable)
 	{
 		for (auto tid = 0; tid < params_BFER.n_threads; tid++)
@@ -100,6 +118,15 @@ BFER<B,R,Q>
 	}
 
 	if (terminal != nullptr) { delete terminal; terminal = nullptr; }
+
+	for (auto p : snr_points)
+	{
+		if (p->terminal    != nullptr) delete p->terminal;
+		if (p->monitor_red != nullptr) delete p->monitor_red;
+		for (auto m : p->monitor)
+			if (m != nullptr) delete m;
+		delete p;
+	}
 }
 
 template <typename B, typename R, typename Q>
@@ -124,6 +151,12 @@ void BFER<B,R,Q>
 {
 	this->terminal = this->build_terminal();
 
+	if (this->params_BFER.snr_concurrent)
+	{
+		this->launch_concurrent();
+		return;
+	}
+
 	if (!this->params_BFER.err_track_revert)
 	{
 		this->build_communication_chain();
@@ -138,17 +171,7 @@ void BFER<B,R,Q>
 	// for each SNR to be simulated
 	for (snr = params_BFER.snr_min; snr <= params_BFER.snr_max; snr += params_BFER.snr_step)
 	{
-		if (params_BFER.snr_type == "EB")
-		{
-			snr_b = snr;
-			snr_s = tools::ebn0_to_esn0(snr_b, bit_rate, params_BFER.mdm->bps);
-		}
-		else // if (params_BFER.sim->snr_type == "ES")
-		{
-			snr_s = snr;
-			snr_b = tools::esn0_to_ebn0(snr_s, bit_rate, params_BFER.mdm->bps);
-		}
-		sigma = tools::esn0_to_sigma(snr_s, params_BFER.mdm->upf);
+		this->set_snr(snr);
 
 		this->terminal->set_esn0(snr_s);
 		this->terminal->set_ebn0(snr_b);
@@ -211,10 +234,29 @@ void BFER<B,R,Q>
 		try
 		{
 			this->_launch();
+
+#ifdef ENABLE_MPI
+			// the node keeps taking part to the reductions until all the nodes agree to stop this SNR point
+			static_cast<module::Monitor_BFER_reduction_mpi<B>*>(this->monitor_red)->wait_termination();
+#endif
 		}
 		catch (std::exception const& e)
 		{
 			module::Monitor::stop();
+
+#ifdef ENABLE_MPI
+			// the other nodes wait for the vote of this node to stop the simulation point
+			try
+			{
+				static_cast<module::Monitor_BFER_reduction_mpi<B>*>(this->monitor_red)->wait_termination();
+			}
+			catch (std::exception const& e_mpi)
+			{
+				std::cerr << tools::apply_on_each_line(tools::addr2line(e_mpi.what()), &tools::format_error)
+				          << std::endl;
+			}
+#endif
+
 			terminal->final_report(std::cout); // display final report to not lost last line overwritten by the error messages
 
 			std::cerr << tools::apply_on_each_line(tools::addr2line(e.what()), &tools::format_error) << std::endl;
@@ -258,9 +300,9 @@ void BFER<B,R,Q>
 			this->dumper_red->clear();
 		}
 
+		const auto n_fe = this->monitor_red->get_n_fe();
 		if (!params_BFER.err_track_revert && !module::Monitor::is_interrupt() &&
-		    this->monitor_red->get_n_fe() < this->monitor_red->get_fe_limit() &&
-		    (max_fra == 0 || this->monitor_red->get_n_fe() < max_fra))
+		    n_fe < this->monitor_red->get_fe_limit() && (max_fra == 0 || n_fe < max_fra))
 			module::Monitor::stop();
 
 		this->monitor_red->reset();
@@ -277,12 +319,208 @@ void BFER<B,R,Q>
 	this->release_objects();
 }
 
+template <typename B, typename R, typename Q>
+constexpr int BFER<B,R,Q>::snr_batch_size;
+
+template <typename B, typename R, typename Q>
+void BFER<B,R,Q>
+::set_snr(const float snr)
+{
+	this->snr = snr;
+
+	if (params_BFER.snr_type == "EB")
+	{
+		snr_b = snr;
+		snr_s = tools::ebn0_to_esn0(snr_b, bit_rate, params_BFER.mdm->bps);
+	}
+	else // if (params_BFER.sim->snr_type == "ES")
+	{
+		snr_s = snr;
+		snr_b = tools::esn0_to_ebn0(snr_s, bit_rate, params_BFER.mdm->bps);
+	}
+	sigma = tools::esn0_to_sigma(snr_s, params_BFER.mdm->upf);
+}
+
+template <typename B, typename R, typename Q>
+void BFER<B,R,Q>
+::launch_concurrent()
+{
+	this->build_communication_chain();
+
+	if (module::Monitor::is_over())
+	{
+		this->release_objects();
+		return;
+	}
+
+	for (auto cur_snr = params_BFER.snr_min; cur_snr <= params_BFER.snr_max; cur_snr += params_BFER.snr_step)
+	{
+		this->set_snr(cur_snr);
+
+		auto point = new SNR_point();
+		point->snr_s = this->snr_s;
+		point->snr_b = this->snr_b;
+		point->sigma = this->sigma;
+		for (auto tid = 0; tid < params_BFER.n_threads; tid++)
+			point->monitor.push_back(this->build_monitor(tid));
+		point->monitor_red = new module::Monitor_BFER_reduction<B>(point->monitor);
+		point->terminal    = nullptr; // built by the first thread taking the SNR point
+		point->done        = false;
+		point->queued      = true;
+
+		this->snr_points.push_back(point);
+	}
+
+	// deal the SNR points in round-robin, pushed in reverse order so each thread starts with its lowest SNR while the
+	// thieves take the highest ones (the longest to simulate)
+	this->scheduler.clear();
+	for (auto p = (int)this->snr_points.size() -1; p >= 0; p--)
+		this->scheduler.push(p % params_BFER.n_threads, p);
+
+	if (!params_BFER.ter->disabled && !params_BFER.debug)
+		this->terminal->legend(std::cout);
+
+	std::vector<std::thread> threads(params_BFER.n_threads -1);
+	for (auto tid = 1; tid < params_BFER.n_threads; tid++)
+		threads[tid -1] = std::thread(BFER<B,R,Q>::start_thread_concurrent, this, tid);
+
+	BFER<B,R,Q>::start_thread_concurrent(this, 0);
+
+	for (auto tid = 1; tid < params_BFER.n_threads; tid++)
+		threads[tid -1].join();
+
+	// display the SNR points interrupted before the end
+	if (!params_BFER.ter->disabled)
+		for (auto point : this->snr_points)
+			if (point->terminal != nullptr && !point->done)
+				point->terminal->final_report(std::cout);
+
+	for (auto &e : this->prev_err_messages)
+		std::cerr << tools::apply_on_each_line(tools::addr2line(e), &tools::format_error) << std::endl;
+	if (!this->prev_err_messages.empty())
+		this->simu_error = true;
+
+	this->release_objects();
+}
+
+template <typename B, typename R, typename Q>
+void BFER<B,R,Q>
+::start_thread_concurrent(BFER<B,R,Q> *simu, const int tid)
+{
+	try
+	{
+		simu->prepare_thread(tid);
+		simu->simulation_loop_concurrent(tid);
+	}
+	catch (std::exception const& e)
+	{
+		module::Monitor::stop();
+
+		simu->mutex_exception.lock();
+		if (std::find(simu->prev_err_messages.begin(), simu->prev_err_messages.end(), e.what()) == simu->prev_err_messages.end())
+			simu->prev_err_messages.push_back(e.what());
+		simu->mutex_exception.unlock();
+	}
+}
+
+template <typename B, typename R, typename Q>
+void BFER<B,R,Q>
+::simulation_loop_concurrent(const int tid)
+{
+	auto &monitor = *this->monitor[tid];
+	auto  cur_p   = -1;
+
+	int p;
+	while (!module::Monitor::is_interrupt() && this->take_snr_point(tid, p))
+	{
+		auto &point = *this->snr_points[p];
+		if (point.done)
+			continue;
+
+		if (p != cur_p)
+		{
+			this->set_sigma(tid, point.sigma);
+			cur_p = p;
+
+			std::lock_guard<std::mutex> lock(this->mutex_terminal);
+			if (point.terminal == nullptr)
+			{
+				point.terminal = factory::Terminal_BFER::build<B>(*params_BFER.ter, *point.monitor_red);
+				point.terminal->set_esn0(point.snr_s);
+				point.terminal->set_ebn0(point.snr_b);
+				point.t_start = std::chrono::steady_clock::now();
+			}
+		}
+
+		for (auto b = 0; b < snr_batch_size && !point.done && !module::Monitor::is_interrupt(); b++)
+			this->exec_frames(tid);
+		point.monitor[tid]->collect(monitor);
+
+		if (this->is_snr_point_over(point))
+		{
+			// only the thread which closes the SNR point displays it
+			if (!point.done.exchange(true) && !params_BFER.ter->disabled)
+			{
+				std::lock_guard<std::mutex> lock(this->mutex_terminal);
+				point.terminal->final_report(std::cout);
+			}
+		}
+		else if (!point.queued.exchange(true))
+			// the point is given back only if it is not already in a deque (the helpers work on points they did not
+			// pop, see 'take_snr_point')
+			this->scheduler.push(tid, p);
+	}
+}
+
+template <typename B, typename R, typename Q>
+bool BFER<B,R,Q>
+::take_snr_point(const int tid, int &p)
+{
+	if (this->scheduler.pop(tid, p))
+	{
+		this->snr_points[p]->queued = false;
+		return true;
+	}
+
+	// nothing left to steal: help the threads on the SNR points which are still running (without popping them, a
+	// point is in the deques at most once)
+	const auto n_points = (int)this->snr_points.size();
+	for (auto i = 0; i < n_points; i++)
+	{
+		const auto q = (tid + i) % n_points;
+		if (!this->snr_points[q]->done)
+		{
+			p = q;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+template <typename B, typename R, typename Q>
+bool BFER<B,R,Q>
+::is_snr_point_over(const SNR_point &point) const
+{
+	using namespace std::chrono;
+
+	return point.monitor_red->get_n_fe() >= point.monitor_red->get_fe_limit() ||
+	       (this->max_fra != 0 && point.monitor_red->get_n_analyzed_fra() >= this->max_fra) ||
+	       (params_BFER.stop_time != seconds(0) && (steady_clock::now() - point.t_start) >= params_BFER.stop_time);
+}
+
 template <typename B, typename R, typename Q>
 void BFER<B,R,Q>
 ::release_objects()
 {
 }
 
+template <typename B, typename R, typename Q>
+void BFER<B,R,Q>
+::prepare_thread(const int tid)
+{
+}
+
 template <typename B, typename R, typename Q>
 module::Monitor_BFER<B>* BFER<B,R,Q>
 ::build_monitor(const int tid)
@@ -297,6 +535,22 @@ tools::Terminal_BFER<B>* BFER<B,R,Q>
 	return factory::Terminal_BFER::build<B>(*params_BFER.ter, *this->monitor_red);
 }
 
+template <typename B, typename R, typename Q>
+bool BFER<B,R,Q>
+::has_frames(const int tid) const
+{
+	if (this->max_fra == 0)
+		return true;
+
+	if (!params_BFER.err_track_revert)
+		return this->monitor_red->get_n_analyzed_fra() < this->max_fra;
+
+	// each thread stops after its own share of the dumped frames, the other threads do not play its frames
+	const auto n_threads = (unsigned)params_BFER.n_threads;
+	const auto n_fra_thr = (unsigned)tid < this->max_fra ? (this->max_fra - tid + n_threads -1) / n_threads : 0;
+	return this->monitor[tid]->get_n_analyzed_fra() < n_fra_thr;
+}
+
 template <typename B, typename R, typename Q>
 void BFER<B,R,Q>
 ::start_thread_build_comm_chain(BFER<B,R,Q> *simu, const int tid)
@@ -2,10 +2,13 @@
 #define SIMULATION_BFER_HPP_
 
 #include <map>
+#include <mutex>
+#include <atomic>
 #include <chrono>
 #include <vector>
 
 #include "Tools/Threads/Barrier.hpp"
+#include "Tools/Threads/Work_stealing_scheduler.hpp"
 #include "Tools/Display/Terminal/BFER/Terminal_BFER.hpp"
 #include "Tools/Display/Dumper/Dumper.hpp"
 #include "Tools/Display/Dumper/Dumper_reduction.hpp"
@@ -57,6 +60,31 @@ protected:
 	// terminal (for the output of the code)
 	tools::Terminal_BFER<B> *terminal;
 
+	// an SNR point of the sweep when the SNR points are simulated concurrently
+	struct SNR_point
+	{
+		float snr_s;
+		float snr_b;
+		float sigma;
+
+		// one monitor per thread (the frames of the thread are collected into it after each batch)
+		std::vector<module::Monitor_BFER          <B>*> monitor;
+		            module::Monitor_BFER_reduction<B>*  monitor_red;
+		tools::Terminal_BFER<B>*                        terminal;
+
+		std::chrono::time_point<std::chrono::steady_clock> t_start;
+		std::atomic<bool>                                  done;
+		std::atomic<bool>                                  queued; // true while the point is in a deque
+	};
+
+	// number of executions of the communication chain before an SNR point is given back to the scheduler
+	static constexpr int snr_batch_size = 16;
+
+	// the SNR points are distributed among the threads, the idle threads steal the SNR points of the busy ones
+	std::vector<SNR_point*>        snr_points;
+	tools::Work_stealing_scheduler scheduler;
+	std::mutex                     mutex_terminal;
+
 public:
 	explicit BFER(const factory::BFER::parameters& params_BFER);
 	virtual ~BFER();
@@ -68,11 +96,27 @@ protected:
 	virtual void release_objects();
 	virtual void _launch() = 0;
 
+	// hooks of the concurrent simulation of the SNR points
+	virtual void set_sigma     (const int tid, const float sigma) = 0;
+	virtual void prepare_thread(const int tid = 0);                // does nothing by default
+	virtual void exec_frames   (const int tid = 0) = 0;
+
 	module::Monitor_BFER <B>* build_monitor (const int tid = 0);
 	tools ::Terminal_BFER<B>* build_terminal(                 );
 
+	// true while the thread 'tid' has frames to play (always true when the number of frames is not limited), in the
+	// error tracking revert mode the thread 'tid' replays the dumped frames tid, tid + n_threads, ...
+	bool has_frames(const int tid) const;
+
 private:
+	void set_snr                   (const float snr                  );
+	void launch_concurrent         (                                 );
+	void simulation_loop_concurrent(const int tid = 0                );
+	bool take_snr_point            (const int tid, int &p            );
+	bool is_snr_point_over         (const SNR_point &point           ) const;
+
 	static void start_thread_build_comm_chain(BFER<B,R,Q> *simu, const int tid);
+	static void start_thread_concurrent      (BFER<B,R,Q> *simu, const int tid);
 };
 }
 }
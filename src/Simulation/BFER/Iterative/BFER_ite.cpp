@@ -112,6 +112,7 @@ void BFER_ite<B,R,Q>
 		this->dumper[tid]->register_data(enc_data, (unsigned int)enc_size, this->params_BFER_ite.err_track_threshold, "enc", false, this->params_BFER_ite.src->n_frames,
 		                                 {(unsigned)this->params_BFER_ite.cdc->enc->K});
 
+		channel.set_noise_tracking(true);
 		this->dumper[tid]->register_data(channel.get_noise(), this->params_BFER_ite.err_track_threshold, "chn", true, this->params_BFER_ite.src->n_frames, {});
 
 		if (interleaver_core[tid]->is_uniform())
@@ -125,11 +126,16 @@ void BFER_ite<B,R,Q>
 {
 	// set current sigma
 	for (auto tid = 0; tid < this->params_BFER_ite.n_threads; tid++)
-	{
-		this->channel[tid]->set_sigma(                                                                    this->sigma);
-		this->modem  [tid]->set_sigma(this->params_BFER_ite.mdm->complex ? this->sigma * std::sqrt(2.f) : this->sigma);
-		this->codec  [tid]->set_sigma(                                                                    this->sigma);
-	}
+		this->set_sigma(tid, this->sigma);
+}
+
+template <typename B, typename R, typename Q>
+void BFER_ite<B,R,Q>
+::set_sigma(const int tid, const float sigma)
+{
+	this->channel[tid]->set_sigma(                                                              sigma);
+	this->modem  [tid]->set_sigma(this->params_BFER_ite.mdm->complex ? sigma * std::sqrt(2.f) : sigma);
+	this->codec  [tid]->set_sigma(                                                              sigma);
 }
 
 template <typename B, typename R, typename Q>
@@ -159,7 +165,9 @@ module::Source<B>* BFER_ite<B,R,Q>
 	const auto seed_src = rd_engine_seed[tid]();
 
 	auto params_src = params_BFER_ite.src->clone();
-	params_src->seed = seed_src;
+	params_src->seed      = seed_src;
+	params_src->stream_id = tid;
+	params_src->n_streams = params_BFER_ite.n_threads;
 	auto s = params_src->template build<B>();
 	delete params_src;
 	return s;
@@ -179,7 +187,9 @@ module::Codec_SISO_SIHO<B,Q>* BFER_ite<B,R,Q>
 	const auto seed_enc = rd_engine_seed[tid]();
 
 	auto params_cdc = params_BFER_ite.cdc->clone();
-	params_cdc->enc->seed = seed_enc;
+	params_cdc->enc->seed      = seed_enc;
+	params_cdc->enc->stream_id = tid;
+	params_cdc->enc->n_streams = params_BFER_ite.n_threads;
 	auto crc = this->params_BFER_ite.crc->type == "NO" ? nullptr : this->crc[tid];
 	auto c = params_cdc->template build<B,Q>(crc);
 	delete params_cdc;
@@ -199,7 +209,9 @@ tools ::Interleaver_core<>* BFER_ite<B,R,Q>
 		std::stringstream s_snr_b;
 		s_snr_b << std::setprecision(2) << std::fixed << this->snr_b;
 
-		params_itl->core->path = params_BFER_ite.err_track_path + "_" + s_snr_b.str() + ".itl";
+		params_itl->core->path      = params_BFER_ite.err_track_path + "_" + s_snr_b.str() + ".itl";
+		params_itl->core->stream_id = tid;
+		params_itl->core->n_streams = params_BFER_ite.n_threads;
 	}
 
 	auto i = params_itl->core->template build<>();
@@ -221,7 +233,10 @@ module::Channel<R>* BFER_ite<B,R,Q>
 	const auto seed_chn = rd_engine_seed[tid]();
 
 	auto params_chn = params_BFER_ite.chn->clone();
-	params_chn->seed = seed_chn;
+	// the counter-based generator shares the seed between the threads, each thread draws its own noise blocks
+	params_chn->seed      = params_chn->implem == "THREEFRY" ? params_BFER_ite.local_seed : seed_chn;
+	params_chn->stream_id = tid;
+	params_chn->n_streams = params_BFER_ite.n_threads;
 	auto c = params_chn->template build<R>();
 	delete params_chn;
 	return c;
@@ -54,6 +54,7 @@ protected:
 	virtual void __build_communication_chain(const int tid = 0);
 	virtual void _launch();
 	virtual void release_objects();
+	virtual void set_sigma(const int tid, const float sigma);
 
 	virtual module::Source          <B    >* build_source     (const int tid = 0);
 	virtual module::CRC             <B    >* build_crc        (const int tid = 0);
@@ -30,6 +30,10 @@ SC_BFER_ite<B,R,Q>
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "SystemC simulation does not support the coded "
 		                                                            "monitoring.");
 
+	if (params_BFER_ite.snr_concurrent)
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "SystemC simulation does not support the "
+		                                                            "concurrent simulation of the SNR points.");
+
 	this->modules["coset_real_i"] = std::vector<module::Module*>(params_BFER_ite.n_threads, nullptr);
 }
 
@@ -158,6 +162,15 @@ void SC_BFER_ite<B,R,Q>
 	sc_core::sc_default_global_context = sc_core::sc_curr_simcontext;
 }
 
+template <typename B, typename R, typename Q>
+void SC_BFER_ite<B,R,Q>
+::exec_frames(const int tid)
+{
+	// the SNR points can't be simulated concurrently (checked in the constructor)
+	throw tools::runtime_error(__FILE__, __LINE__, __func__, "SystemC simulation does not support the concurrent "
+	                                                         "simulation of the SNR points.");
+}
+
 template <typename B, typename R, typename Q>
 void SC_BFER_ite<B,R,Q>
 ::bind_sockets()
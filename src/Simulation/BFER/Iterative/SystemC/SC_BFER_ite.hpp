@@ -37,6 +37,7 @@ protected:
 	virtual void __build_communication_chain(const int tid = 0);
 	virtual void release_objects();
 	virtual void _launch();
+	virtual void exec_frames(const int tid = 0);
 
 	virtual module::Coset<B,Q>* build_coset_real(const int tid = 0);
 
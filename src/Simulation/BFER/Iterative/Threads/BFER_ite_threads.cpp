@@ -18,15 +18,12 @@ using namespace aff3ct::simulation;
 template <typename B, typename R, typename Q>
 BFER_ite_threads<B,R,Q>
 ::BFER_ite_threads(const factory::BFER_ite::parameters &params_BFER_ite)
-: BFER_ite<B,R,Q>(params_BFER_ite)
+: BFER_ite<B,R,Q>(params_BFER_ite),
+  sequence_head(params_BFER_ite.n_threads),
+  sequence_crc (params_BFER_ite.n_threads),
+  sequence_ite (params_BFER_ite.n_threads),
+  sequence_tail(params_BFER_ite.n_threads)
 {
-	if (this->params_BFER_ite.err_track_revert)
-	{
-		if (this->params_BFER_ite.n_threads != 1)
-			std::clog << tools::format_warning("Multi-threading detected with error tracking revert feature! "
-			                                   "Each thread will play the same frames. Please run with one thread.")
-			          << std::endl;
-	}
 }
 
 template <typename B, typename R, typename Q>
@@ -63,7 +60,7 @@ void BFER_ite_threads<B,R,Q>
 {
 	try
 	{
-		simu->sockets_binding(tid);
+		simu->prepare_thread (tid);
 		simu->simulation_loop(tid);
 	}
 	catch (std::exception const& e)
@@ -77,6 +74,14 @@ void BFER_ite_threads<B,R,Q>
 	}
 }
 
+template <typename B, typename R, typename Q>
+void BFER_ite_threads<B,R,Q>
+::prepare_thread(const int tid)
+{
+	this->sockets_binding(tid);
+	this->build_sequence (tid);
+}
+
 template <typename B, typename R, typename Q>
 void BFER_ite_threads<B,R,Q>
 ::sockets_binding(const int tid)
@@ -303,7 +308,7 @@ void BFER_ite_threads<B,R,Q>
 
 template <typename B, typename R, typename Q>
 void BFER_ite_threads<B,R,Q>
-::simulation_loop(const int tid)
+::build_sequence(const int tid)
 {
 	auto &source          = *this->source         [tid];
 	auto &crc             = *this->crc            [tid];
@@ -321,6 +326,91 @@ void BFER_ite_threads<B,R,Q>
 	auto &decoder_siso = *codec.get_decoder_siso();
 	auto &decoder_siho = *codec.get_decoder_siho();
 
+	using namespace module;
+
+	const auto is_crc = this->params_BFER_ite.crc->type != "NO";
+	const auto is_wg  = this->params_BFER_ite.chn->type.find("RAYLEIGH") != std::string::npos;
+
+	auto &head = this->sequence_head[tid]; head.clear();
+	auto &scrc = this->sequence_crc [tid]; scrc.clear();
+	auto &ite  = this->sequence_ite [tid]; ite .clear();
+	auto &tail = this->sequence_tail[tid]; tail.clear();
+
+	if (this->params_BFER_ite.src->type != "AZCW")
+	{
+		head.push_back(source[src::tsk::generate]);
+		if (is_crc)
+			head.push_back(crc[crc::tsk::build]);
+		if (this->params_BFER_ite.cdc->enc->type != "NO")
+			head.push_back(encoder[enc::tsk::encode]);
+
+		head.push_back(interleaver_bit[itl::tsk::interleave]);
+		head.push_back(modem          [mdm::tsk::modulate  ]);
+	}
+
+	if (this->params_BFER_ite.chn->type != "NO")
+		head.push_back(channel[is_wg ? chn::tsk::add_noise_wg : chn::tsk::add_noise]);
+	if (modem.is_filter())
+		head.push_back(modem[mdm::tsk::filter]);
+	if (this->params_BFER_ite.qnt->type != "NO")
+		head.push_back(quantizer[qnt::tsk::process]);
+	if (modem.is_demodulator())
+		head.push_back(modem[is_wg ? mdm::tsk::demodulate_wg : mdm::tsk::demodulate]);
+
+	head.push_back(interleaver_llr[itl::tsk::deinterleave]);
+
+	// ---------------------------------------------------------------------------------------------------- CRC checking
+	if (is_crc)
+	{
+		scrc.push_back(codec[cdc::tsk::extract_sys_bit]);
+		scrc.push_back(crc  [crc::tsk::check          ]);
+	}
+
+	// -------------------------------------------------------------------------------------- turbo demodulation loop
+	if (this->params_BFER_ite.coset)
+	{
+		ite.push_back(coset_real  [cst::tsk::apply      ]);
+		ite.push_back(decoder_siso[dec::tsk::decode_siso]);
+		ite.push_back(coset_real  [cst::tsk::apply      ]);
+	}
+	else
+	{
+		ite.push_back(decoder_siso[dec::tsk::decode_siso]);
+	}
+
+	ite.push_back(interleaver_llr[itl::tsk::interleave]);
+	if (modem.is_demodulator())
+		ite.push_back(modem[is_wg ? mdm::tsk::tdemodulate_wg : mdm::tsk::tdemodulate]);
+	ite.push_back(interleaver_llr[itl::tsk::deinterleave]);
+
+	// ------------------------------------------------------------------------------------------------ final decoding
+	if (this->params_BFER_ite.coset)
+		tail.push_back(coset_real[cst::tsk::apply]);
+
+	if (this->params_BFER_ite.coded_monitoring)
+	{
+		tail.push_back(decoder_siho[dec::tsk::decode_siho_cw]);
+		if (this->params_BFER_ite.coset)
+			tail.push_back(coset_bit[cst::tsk::apply]);
+	}
+	else
+	{
+		tail.push_back(decoder_siho[dec::tsk::decode_siho]);
+		if (this->params_BFER_ite.coset)
+			tail.push_back(coset_bit[cst::tsk::apply]);
+		if (is_crc)
+			tail.push_back(crc[crc::tsk::extract]);
+	}
+
+	tail.push_back(monitor[mnt::tsk::check_errors]);
+}
+
+template <typename B, typename R, typename Q>
+void BFER_ite_threads<B,R,Q>
+::simulation_loop(const int tid)
+{
+	auto &monitor = *this->monitor[tid];
+
 	using namespace module;
 	using namespace std::chrono;
 	auto t_snr = steady_clock::now();
@@ -328,7 +418,7 @@ void BFER_ite_threads<B,R,Q>
 	while ((!this->monitor_red->fe_limit_achieved()) && // while max frame error count has not been reached
 	        (this->params_BFER_ite.stop_time == seconds(0) || 
 	        (steady_clock::now() - t_snr) < this->params_BFER_ite.stop_time) &&
-	        (this->monitor_red->get_n_analyzed_fra() < this->max_fra || this->max_fra == 0))
+	        this->has_frames(tid))
 	{
 		if (this->params_BFER_ite.debug)
 		{
@@ -341,122 +431,33 @@ void BFER_ite_threads<B,R,Q>
 			std::cout << "#" << std::endl;
 		}
 
-		if (this->params_BFER_ite.src->type != "AZCW")
-		{
-			source[src::tsk::generate].exec();
-			if (this->params_BFER_ite.crc->type != "NO")
-				crc[crc::tsk::build].exec();
-			if (this->params_BFER_ite.cdc->enc->type != "NO")
-				encoder[enc::tsk::encode].exec();
-
-			interleaver_bit[itl::tsk::interleave].exec();
-			modem          [mdm::tsk::modulate  ].exec();
-		}
+		this->exec_frames(tid);
+	}
+}
 
-		if (this->params_BFER_ite.chn->type.find("RAYLEIGH") != std::string::npos)
-		{
-			if (this->params_BFER_ite.chn->type != "NO")
-				channel[chn::tsk::add_noise_wg].exec();
-			if (modem.is_filter())
-				modem [mdm::tsk::filter].exec();
-			if (this->params_BFER_ite.qnt->type != "NO")
-				quantizer[qnt::tsk::process].exec();
-			if (modem.is_demodulator())
-				modem[mdm::tsk::demodulate_wg].exec();
-		}
-		else
-		{
-			if (this->params_BFER_ite.chn->type != "NO")
-				channel[chn::tsk::add_noise].exec();
-			if (modem.is_filter())
-				modem[mdm::tsk::filter].exec();
-			if (this->params_BFER_ite.qnt->type != "NO")
-				quantizer[qnt::tsk::process].exec();
-			if (modem.is_demodulator())
-				modem[mdm::tsk::demodulate].exec();
-		}
+template <typename B, typename R, typename Q>
+void BFER_ite_threads<B,R,Q>
+::exec_frames(const int tid)
+{
+	auto &head = this->sequence_head[tid];
+	auto &scrc = this->sequence_crc [tid];
+	auto &ite  = this->sequence_ite [tid];
+	auto &tail = this->sequence_tail[tid];
 
-		interleaver_llr[itl::tsk::deinterleave].exec();
+	const auto n_ite     = this->params_BFER_ite.n_ite;
+	const auto crc_start = scrc.size() ? this->params_BFER_ite.crc_start : n_ite +1;
 
-		// ------------------------------------------------------------------------------------------------------------
-		// ------------------------------------------------------------------------------------ turbo demodulation loop
-		// ------------------------------------------------------------------------------------------------------------
-		for (auto ite = 1; ite <= this->params_BFER_ite.n_ite; ite++)
-		{
-			// ------------------------------------------------------------------------------------------- CRC checking
-			if (this->params_BFER_ite.crc->type != "NO" && ite >= this->params_BFER_ite.crc_start)
-			{
-				codec[cdc::tsk::extract_sys_bit].exec();
-				if (crc[crc::tsk::check].exec())
-					break;
-			}
-
-			// ----------------------------------------------------------------------------------------------- decoding
-			if (this->params_BFER_ite.coset)
-			{
-				coset_real  [cst::tsk::apply      ].exec();
-				decoder_siso[dec::tsk::decode_siso].exec();
-				coset_real  [cst::tsk::apply      ].exec();
-			}
-			else
-			{
-				decoder_siso[dec::tsk::decode_siso].exec();
-			}
-
-			// ------------------------------------------------------------------------------------------- interleaving
-			interleaver_llr[itl::tsk::interleave].exec();
-
-			// ------------------------------------------------------------------------------------------- demodulation
-			if (this->params_BFER_ite.chn->type.find("RAYLEIGH") != std::string::npos)
-			{
-				if (modem.is_demodulator())
-					modem[mdm::tsk::tdemodulate_wg].exec();
-			}
-			else
-			{
-				if (modem.is_demodulator())
-					modem[mdm::tsk::tdemodulate].exec();
-			}
-
-			// ----------------------------------------------------------------------------------------- deinterleaving
-			interleaver_llr[itl::tsk::deinterleave].exec();
-		}
+	head.exec();
 
-		if (this->params_BFER_ite.coset)
-		{
-			coset_real[cst::tsk::apply].exec();
-
-			if (this->params_BFER_ite.coded_monitoring)
-			{
-				decoder_siho[dec::tsk::decode_siho_cw].exec();
-				coset_bit   [cst::tsk::apply         ].exec();
-			}
-			else
-			{
-				decoder_siho[dec::tsk::decode_siho].exec();
-				coset_bit   [cst::tsk::apply      ].exec();
-
-				if (this->params_BFER_ite.crc->type != "NO")
-					crc[crc::tsk::extract].exec();
-			}
-		}
-		else
-		{
-			if (this->params_BFER_ite.coded_monitoring)
-			{
-				decoder_siho[dec::tsk::decode_siho_cw].exec();
-			}
-			else
-			{
-				decoder_siho[dec::tsk::decode_siho].exec();
-
-				if (this->params_BFER_ite.crc->type != "NO")
-					crc[crc::tsk::extract].exec();
-			}
-		}
+	for (auto i = 1; i <= n_ite; i++)
+	{
+		if (i >= crc_start && scrc.exec())
+			break;
 
-		monitor[mnt::tsk::check_errors].exec();
+		ite.exec();
 	}
+
+	tail.exec();
 }
 
 // ==================================================================================== explicit template instantiation
@@ -1,6 +1,8 @@
 #ifndef SIMULATION_BFER_ITE_THREADS_HPP_
 #define SIMULATION_BFER_ITE_THREADS_HPP_
 
+#include "Module/Sequence.hpp"
+
 #include "../BFER_ite.hpp"
 
 namespace aff3ct
@@ -10,15 +12,25 @@ namespace simulation
 template <typename B = int, typename R = float, typename Q = R>
 class BFER_ite_threads : public BFER_ite<B,R,Q>
 {
+protected:
+	// the communication chain of each thread compiled into flat sequences of tasks
+	std::vector<module::Sequence> sequence_head; // from the source to the first deinterleaving
+	std::vector<module::Sequence> sequence_crc;  // CRC checking in the turbo demodulation loop
+	std::vector<module::Sequence> sequence_ite;  // one iteration of the turbo demodulation loop
+	std::vector<module::Sequence> sequence_tail; // from the last decoding to the monitor
+
 public:
 	explicit BFER_ite_threads(const factory::BFER_ite::parameters &params_BFER_ite);
 	virtual ~BFER_ite_threads();
 
 protected:
 	virtual void _launch();
+	virtual void prepare_thread(const int tid = 0);
+	virtual void exec_frames   (const int tid = 0);
 
 private:
 	void sockets_binding(const int tid = 0);
+	void build_sequence (const int tid = 0);
 	void simulation_loop(const int tid = 0);
 
 	static void start_thread(BFER_ite_threads<B,R,Q> *simu, const int tid = 0);
@@ -48,6 +48,7 @@ protected:
 	virtual void __build_communication_chain(const int tid = 0);
 	virtual void _launch();
 	virtual void release_objects();
+	virtual void set_sigma(const int tid, const float sigma);
 
 	module::Source    <B    >* build_source    (const int tid = 0);
 	module::CRC       <B    >* build_crc       (const int tid = 0);
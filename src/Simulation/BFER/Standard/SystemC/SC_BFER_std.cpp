@@ -24,6 +24,10 @@ SC_BFER_std<B,R,Q>
 	if (params_BFER_std.coded_monitoring)
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "SystemC simulation does not support the coded "
 		                                                            "monitoring.");
+
+	if (params_BFER_std.snr_concurrent)
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "SystemC simulation does not support the "
+		                                                            "concurrent simulation of the SNR points.");
 }
 
 template <typename B, typename R, typename Q>
@@ -115,6 +119,15 @@ void SC_BFER_std<B,R,Q>
 	sc_core::sc_default_global_context = sc_core::sc_curr_simcontext;
 }
 
+template <typename B, typename R, typename Q>
+void SC_BFER_std<B,R,Q>
+::exec_frames(const int tid)
+{
+	// the SNR points can't be simulated concurrently (checked in the constructor)
+	throw tools::runtime_error(__FILE__, __LINE__, __func__, "SystemC simulation does not support the concurrent "
+	                                                         "simulation of the SNR points.");
+}
+
 template <typename B, typename R, typename Q>
 void SC_BFER_std<B,R,Q>
 ::bind_sockets()
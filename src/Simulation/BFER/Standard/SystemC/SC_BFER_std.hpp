@@ -26,6 +26,7 @@ protected:
 
 	virtual void __build_communication_chain(const int tid = 0);
 	virtual void _launch();
+	virtual void exec_frames(const int tid = 0);
 
 private:
 	void bind_sockets();
@@ -3,6 +3,8 @@
 #include <vector>
 #include <chrono>
 #include <thread>
+#include <sstream>
+#include <algorithm>
 
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Display/Frame_trace/Frame_trace.hpp"
@@ -18,14 +20,33 @@ using namespace aff3ct::simulation;
 template <typename B, typename R, typename Q>
 BFER_std_threads<B,R,Q>
 ::BFER_std_threads(const factory::BFER_std::parameters &params_BFER_std)
-: BFER_std<B,R,Q>(params_BFER_std)
+: BFER_std<B,R,Q>(params_BFER_std),
+  sequence(params_BFER_std.n_threads)
 {
-	if (this->params_BFER_std.err_track_revert)
+	if (this->params_BFER_std.pipeline)
 	{
-		if (this->params_BFER_std.n_threads != 1)
-			std::clog << tools::format_warning("Multi-threading detected with error tracking revert feature! "
-			                                   "Each thread will play the same frames. Please run with one thread.")
-			          << std::endl;
+		if (this->params_BFER_std.n_threads < 3)
+		{
+			std::stringstream message;
+			message << "The pipeline requires at least 3 threads ('n_threads' = "
+			        << this->params_BFER_std.n_threads << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (this->params_BFER_std.snr_concurrent)
+		{
+			std::stringstream message;
+			message << "The pipeline is not compatible with the concurrent simulation of the SNR points.";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		// the replicas of a stage do not play the frames in the order of the source
+		if (this->params_BFER_std.err_track_revert)
+		{
+			std::stringstream message;
+			message << "The pipeline is not compatible with the error tracking revert feature.";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
 	}
 }
 
@@ -41,6 +62,12 @@ void BFER_std_threads<B,R,Q>
 {
 	BFER_std<B,R,Q>::_launch();
 
+	if (this->params_BFER_std.pipeline)
+	{
+		this->_launch_pipeline();
+		return;
+	}
+
 	std::vector<std::thread> threads(this->params_BFER_std.n_threads -1);
 	// launch a group of slave threads (there is "n_threads -1" slave threads)
 	for (auto tid = 1; tid < this->params_BFER_std.n_threads; tid++)
@@ -57,13 +84,50 @@ void BFER_std_threads<B,R,Q>
 		throw std::runtime_error(this->prev_err_messages.back());
 }
 
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::_launch_pipeline()
+{
+	using namespace module;
+	using namespace std::chrono;
+
+	const auto n_threads = this->params_BFER_std.n_threads;
+
+	// the pipeline uses the communication chain of each thread as the chain of one of its replicas
+	std::vector<Sequence*> chains;
+	for (auto tid = 0; tid < n_threads; tid++)
+	{
+		this->prepare_thread(tid);
+		chains.push_back(&this->sequence[tid]);
+	}
+
+	// 1st stage: from the source to the decoder, 2nd stage: from the decoder to the monitor, 3rd stage: the monitor
+	auto &dec   = *this->codec[0]->get_decoder_siho();
+	auto &tasks = this->sequence[0].get_tasks();
+	auto *t_dec = &dec[this->params_BFER_std.coded_monitoring ? dec::tsk::decode_siho_cw : dec::tsk::decode_siho];
+
+	const auto split_dec = (size_t)(std::find(tasks.begin(), tasks.end(), t_dec) - tasks.begin());
+	const auto split_mnt = tasks.size() -1;
+
+	Pipeline pipeline(chains, {split_dec, split_mnt}, {1, (size_t)n_threads -2, 1});
+
+	const auto t_snr = steady_clock::now();
+	pipeline.exec([this, t_snr]() -> bool
+	{
+		return this->monitor_red->fe_limit_achieved() ||
+		       (this->params_BFER_std.stop_time != seconds(0) &&
+		       (steady_clock::now() - t_snr) >= this->params_BFER_std.stop_time) ||
+		       (this->max_fra != 0 && this->monitor_red->get_n_analyzed_fra() >= this->max_fra);
+	});
+}
+
 template <typename B, typename R, typename Q>
 void BFER_std_threads<B,R,Q>
 ::start_thread(BFER_std_threads<B,R,Q> *simu, const int tid)
 {
 	try
 	{
-		simu->sockets_binding(tid);
+		simu->prepare_thread (tid);
 		simu->simulation_loop(tid);
 	}
 	catch (std::exception const& e)
@@ -77,6 +141,14 @@ void BFER_std_threads<B,R,Q>
 	}
 }
 
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::prepare_thread(const int tid)
+{
+	this->sockets_binding(tid);
+	this->build_sequence (tid);
+}
+
 template <typename B, typename R, typename Q>
 void BFER_std_threads<B,R,Q>
 ::sockets_binding(const int tid)
@@ -235,7 +307,7 @@ void BFER_std_threads<B,R,Q>
 
 template <typename B, typename R, typename Q>
 void BFER_std_threads<B,R,Q>
-::simulation_loop(const int tid)
+::build_sequence(const int tid)
 {
 	auto &source     = *this->source    [tid];
 	auto &crc        = *this->crc       [tid];
@@ -249,6 +321,68 @@ void BFER_std_threads<B,R,Q>
 	auto &coset_bit  = *this->coset_bit [tid];
 	auto &monitor    = *this->monitor   [tid];
 
+	using namespace module;
+
+	const auto is_crc = this->params_BFER_std.crc->type != "NO";
+	const auto is_pct = this->params_BFER_std.cdc->pct != nullptr && this->params_BFER_std.cdc->pct->type != "NO";
+	const auto is_chn = this->params_BFER_std.chn->type != "NO";
+	const auto is_qnt = this->params_BFER_std.qnt->type != "NO";
+	const auto is_wg  = this->params_BFER_std.chn->type.find("RAYLEIGH") != std::string::npos;
+
+	auto &seq = this->sequence[tid];
+	seq.clear();
+
+	if (this->params_BFER_std.src->type != "AZCW")
+	{
+		seq.push_back(source[src::tsk::generate]);
+		if (is_crc)
+			seq.push_back(crc[crc::tsk::build]);
+		if (this->params_BFER_std.cdc->enc->type != "NO")
+			seq.push_back(encoder[enc::tsk::encode]);
+		if (is_pct)
+			seq.push_back(puncturer[pct::tsk::puncture]);
+		seq.push_back(modem[mdm::tsk::modulate]);
+	}
+
+	if (is_chn)
+		seq.push_back(channel[is_wg ? chn::tsk::add_noise_wg : chn::tsk::add_noise]);
+	if (modem.is_filter())
+		seq.push_back(modem[mdm::tsk::filter]);
+	if (modem.is_demodulator())
+		seq.push_back(modem[is_wg ? mdm::tsk::demodulate_wg : mdm::tsk::demodulate]);
+	if (is_qnt)
+		seq.push_back(quantizer[qnt::tsk::process]);
+
+	if (is_pct)
+		seq.push_back(puncturer[pct::tsk::depuncture]);
+
+	if (this->params_BFER_std.coset)
+		seq.push_back(coset_real[cst::tsk::apply]);
+
+	if (this->params_BFER_std.coded_monitoring)
+	{
+		seq.push_back(decoder[dec::tsk::decode_siho_cw]);
+		if (this->params_BFER_std.coset)
+			seq.push_back(coset_bit[cst::tsk::apply]);
+	}
+	else
+	{
+		seq.push_back(decoder[dec::tsk::decode_siho]);
+		if (this->params_BFER_std.coset)
+			seq.push_back(coset_bit[cst::tsk::apply]);
+		if (is_crc)
+			seq.push_back(crc[crc::tsk::extract]);
+	}
+
+	seq.push_back(monitor[mnt::tsk::check_errors]);
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::simulation_loop(const int tid)
+{
+	auto &monitor = *this->monitor[tid];
+
 	using namespace module;
 	using namespace std::chrono;
 	auto t_snr = steady_clock::now();
@@ -257,7 +391,7 @@ void BFER_std_threads<B,R,Q>
 	while (!this->monitor_red->fe_limit_achieved() && // while max frame error count has not been reached
 	       (this->params_BFER_std.stop_time == seconds(0) || 
 	       (steady_clock::now() - t_snr) < this->params_BFER_std.stop_time) &&
-	       (this->monitor_red->get_n_analyzed_fra() < this->max_fra || this->max_fra == 0))
+	       this->has_frames(tid))
 	{
 		if (this->params_BFER_std.debug)
 		{
@@ -270,79 +404,17 @@ void BFER_std_threads<B,R,Q>
 			std::cout << "#" << std::endl;
 		}
 
-		if (this->params_BFER_std.src->type != "AZCW")
-		{
-			source[src::tsk::generate].exec();
-			if (this->params_BFER_std.crc->type != "NO")
-				crc[crc::tsk::build].exec();
-			if (this->params_BFER_std.cdc->enc->type != "NO")
-				encoder[enc::tsk::encode].exec();
-			if (this->params_BFER_std.cdc->pct != nullptr && this->params_BFER_std.cdc->pct->type != "NO")
-				puncturer[pct::tsk::puncture].exec();
-			modem[mdm::tsk::modulate].exec();
-		}
-
-		if (this->params_BFER_std.chn->type.find("RAYLEIGH") != std::string::npos)
-		{
-			if (this->params_BFER_std.chn->type != "NO")
-				channel[chn::tsk::add_noise_wg].exec();
-			if (modem.is_filter())
-				modem[mdm::tsk::filter].exec();
-			if (modem.is_demodulator())
-				modem[mdm::tsk::demodulate_wg].exec();
-			if (this->params_BFER_std.qnt->type != "NO")
-				quantizer[qnt::tsk::process].exec();
-		}
-		else
-		{
-			if (this->params_BFER_std.chn->type != "NO")
-				channel[chn::tsk::add_noise].exec();
-			if (modem.is_filter())
-				modem[mdm::tsk::filter].exec();
-			if (modem.is_demodulator())
-				modem[mdm::tsk::demodulate].exec();
-			if (this->params_BFER_std.qnt->type != "NO")
-				quantizer[qnt::tsk::process].exec();
-		}
-
-		if (this->params_BFER_std.cdc->pct != nullptr && this->params_BFER_std.cdc->pct->type != "NO")
-			puncturer[pct::tsk::depuncture].exec();
-
-		if (this->params_BFER_std.coset)
-		{
-			coset_real[cst::tsk::apply].exec();
-
-			if (this->params_BFER_std.coded_monitoring)
-			{
-				decoder  [dec::tsk::decode_siho_cw].exec();
-				coset_bit[cst::tsk::apply         ].exec();
-			}
-			else
-			{
-				decoder  [dec::tsk::decode_siho].exec();
-				coset_bit[cst::tsk::apply      ].exec();
-				if (this->params_BFER_std.crc->type != "NO")
-					crc[crc::tsk::extract].exec();
-			}
-		}
-		else
-		{
-			if (this->params_BFER_std.coded_monitoring)
-			{
-				decoder[dec::tsk::decode_siho_cw].exec();
-			}
-			else
-			{
-				decoder[dec::tsk::decode_siho].exec();
-				if (this->params_BFER_std.crc->type != "NO")
-					crc[crc::tsk::extract].exec();
-			}
-		}
-
-		monitor[mnt::tsk::check_errors].exec();
+		this->exec_frames(tid);
 	}
 }
 
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::exec_frames(const int tid)
+{
+	this->sequence[tid].exec();
+}
+
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #ifdef MULTI_PREC
@@ -1,6 +1,9 @@
 #ifndef SIMULATION_BFER_STD_THREADS_HPP_
 #define SIMULATION_BFER_STD_THREADS_HPP_
 
+#include "Module/Sequence.hpp"
+#include "Module/Pipeline.hpp"
+
 #include "../BFER_std.hpp"
 
 namespace aff3ct
@@ -10,15 +13,24 @@ namespace simulation
 template <typename B = int, typename R = float, typename Q = R>
 class BFER_std_threads : public BFER_std<B,R,Q>
 {
+protected:
+	// the communication chain of each thread compiled into a flat sequence of tasks
+	std::vector<module::Sequence> sequence;
+
 public:
 	explicit BFER_std_threads(const factory::BFER_std::parameters &params_BFER_std);
 	virtual ~BFER_std_threads();
 
 protected:
 	virtual void _launch();
+	virtual void prepare_thread(const int tid = 0);
+	virtual void exec_frames   (const int tid = 0);
 
 private:
+	void _launch_pipeline();
+
 	void sockets_binding(const int tid = 0);
+	void build_sequence (const int tid = 0);
 	void simulation_loop(const int tid = 0);
 
 	static void start_thread(BFER_std_threads<B,R,Q> *simu, const int tid = 0);
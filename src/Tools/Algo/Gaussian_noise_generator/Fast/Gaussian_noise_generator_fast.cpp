@@ -2,6 +2,7 @@
 #include <mipp.h>
 
 #include "Tools/Exception/exception.hpp"
+#include "Tools/Perf/double_words.h"
 
 #include "Gaussian_noise_generator_fast.hpp"
 
@@ -75,13 +76,38 @@ float Gaussian_noise_generator_fast<float>
 }
 }
 
+namespace aff3ct
+{
+namespace tools
+{
+template <>
+mipp::Reg<double> Gaussian_noise_generator_fast<double>
+::get_random_simd()
+{
+	// return a vector of numbers between ]0,1[
+	return mt19937_simd.randd_oo();
+}
+}
+}
+
+namespace aff3ct
+{
+namespace tools
+{
+template <>
+double Gaussian_noise_generator_fast<double>
+::get_random()
+{
+	// return a number between ]0,1[
+	return mt19937.randd_oo();
+}
+}
+}
+
 template <typename R>
 void Gaussian_noise_generator_fast<R>
-::generate(R *noise, const unsigned length, const R sigma, const R mu) //TODO: integrate mu in the computation
+::_generate(const R *X, R *noise, const unsigned length, const R sigma, const R mu)
 {
-	if (!mipp::isAligned(noise))
-		throw runtime_error(__FILE__, __LINE__, __func__, "'noise' is misaligned memory.");
-
 	const auto twopi = (R)(2.0 * 3.14159265358979323846);
 
 	// SIMD version of the Box Muller method in the polar form
@@ -100,8 +126,17 @@ void Gaussian_noise_generator_fast<R>
 		auto awgn1 = radius * costheta + mu;
 		auto awgn2 = radius * sintheta + mu;
 
-		awgn1.store(&noise[i                    ]);
-		awgn2.store(&noise[i + mipp::nElReg<R>()]);
+		if (X != nullptr) // accumulate the noise into the output
+		{
+			mipp::Reg<R> x1, x2;
+			x1.loadu(&X[i                    ]);
+			x2.loadu(&X[i + mipp::nElReg<R>()]);
+			awgn1 += x1;
+			awgn2 += x2;
+		}
+
+		awgn1.storeu(&noise[i                    ]);
+		awgn2.storeu(&noise[i + mipp::nElReg<R>()]);
 	}
 
 	// seq version of the Box Muller method in the polar form
@@ -117,8 +152,8 @@ void Gaussian_noise_generator_fast<R>
 		const auto sintheta = std::sin(theta);
 		const auto costheta = std::cos(theta);
 
-		noise[i +0] = radius * sintheta + mu;
-		noise[i +1] = radius * costheta + mu;
+		noise[i +0] = radius * sintheta + mu + (X != nullptr ? X[i +0] : (R)0);
+		noise[i +1] = radius * costheta + mu + (X != nullptr ? X[i +1] : (R)0);
 	}
 
 	// distribute the last odd element
@@ -132,10 +167,166 @@ void Gaussian_noise_generator_fast<R>
 
 		const auto sintheta = std::sin(theta);
 
-		noise[length -1] = radius * sintheta + mu;
+		noise[length -1] = radius * sintheta + mu + (X != nullptr ? X[length -1] : (R)0);
 	}
 }
 
+namespace aff3ct
+{
+namespace tools
+{
+template <>
+void Gaussian_noise_generator_fast<double>
+::_generate(const double *X, double *noise, const unsigned length, const double sigma, const double mu)
+{
+	// the SIMD logarithm and sine/cosine are computed here with the basic operations only: the exponent and the
+	// mantissa of the doubles are handled with 32-bit integer operations on the high words (the masks are built once)
+	static const auto r_mantissa = set_double_words((int)0xFFFFFFFF, (int)0x000FFFFF);
+	static const auto r_exponent = set_double_words((int)0x00000000, (int)0x7FF00000);
+	static const auto r_one      = set_double_words((int)0x00000000, (int)0x3FF00000); // 1.0
+	static const auto r_magic    = set_double_words((int)0x00000000, (int)0x43300000); // 2^52
+	static const auto r_sign     = set_double_words((int)0x00000000, (int)0x80000000);
+	static const auto r_swap     = set_double_words((int)0x00000000, (int)0x40000000);
+
+	const mipp::Reg<double> r_zero   = 0.0;
+	const mipp::Reg<double> r_half   = 0.5;
+	const mipp::Reg<double> r_1      = 1.0;
+	const mipp::Reg<double> r_bias   = 1023.0;
+	const mipp::Reg<double> r_2p52   = 4503599627370496.0;     // 2^52
+	const mipp::Reg<double> r_2m32   = 1.0 / 4294967296.0;     // 2^-32
+	const mipp::Reg<double> r_sqrt2  = 1.41421356237309504880;
+	const mipp::Reg<double> r_ln2    = 0.69314718055994530942;
+	const mipp::Reg<double> r_pio2   = 1.57079632679489661923;
+	const mipp::Reg<double> r_m2     = -2.0;
+	const mipp::Reg<double> r_sigma  = sigma;
+	const mipp::Reg<double> r_mu     = mu;
+
+	const auto vec_loop_size = (int)(((int)length / (mipp::nElReg<double>() * 2)) * mipp::nElReg<double>() * 2);
+	for (auto i = 0; i < vec_loop_size; i += mipp::nElReg<double>() * 2)
+	{
+		// radius = sqrt(-2 log(u1)) with u1 in ]0,1[, log(u1) = e * log(2) + log(m) and m in [sqrt(2)/2, sqrt(2)[
+		const auto u1  = get_random_simd();
+		const auto u1i = mipp::cast<double,int>(u1);
+
+		auto e = (mipp::cast<int,double>(((u1i & r_exponent) >> 20) | r_magic) - r_2p52) * r_2m32 - r_bias;
+		auto m =  mipp::cast<int,double>( (u1i & r_mantissa)        | r_one  );
+
+		const auto m_big = m > r_sqrt2;
+		m = mipp::blend(m * r_half, m, m_big);
+		e = mipp::blend(e + r_1,    e, m_big);
+
+		// log(m) = 2 atanh(s) with s = (m -1) / (m +1) and |s| < 0.172
+		const auto s  = (m - r_1) / (m + r_1);
+		const auto s2 = s * s;
+		auto p = mipp::Reg<double>(1.0 / 23.0);
+		p = mipp::fmadd(p, s2, mipp::Reg<double>(1.0 / 21.0));
+		p = mipp::fmadd(p, s2, mipp::Reg<double>(1.0 / 19.0));
+		p = mipp::fmadd(p, s2, mipp::Reg<double>(1.0 / 17.0));
+		p = mipp::fmadd(p, s2, mipp::Reg<double>(1.0 / 15.0));
+		p = mipp::fmadd(p, s2, mipp::Reg<double>(1.0 / 13.0));
+		p = mipp::fmadd(p, s2, mipp::Reg<double>(1.0 / 11.0));
+		p = mipp::fmadd(p, s2, mipp::Reg<double>(1.0 /  9.0));
+		p = mipp::fmadd(p, s2, mipp::Reg<double>(1.0 /  7.0));
+		p = mipp::fmadd(p, s2, mipp::Reg<double>(1.0 /  5.0));
+		p = mipp::fmadd(p, s2, mipp::Reg<double>(1.0 /  3.0));
+		p = mipp::fmadd(p, s2, r_1);
+
+		const auto log_u1 = mipp::fmadd(e, r_ln2, (s + s) * p);
+		const auto radius = mipp::sqrt(log_u1 * r_m2) * r_sigma;
+
+		// theta is uniform in [-pi/4, pi/4[, the two remaining random bits of the high words select the sign of the
+		// cosine and swap the sine and the cosine: the angle is uniform on the whole circle
+		const auto r2 = mt19937_simd.rand_s32();
+		const auto x  = (mipp::cast<int,double>((r2 & r_mantissa) | r_one) - (r_1 + r_half)) * r_pio2;
+		const auto x2 = x * x;
+
+		auto sinx = mipp::Reg<double>(1.0 / 355687428096000.0); // 1/17!
+		sinx = mipp::fnmadd(sinx, x2, mipp::Reg<double>(1.0 / 1307674368000.0));
+		sinx = mipp::fnmadd(sinx, x2, mipp::Reg<double>(1.0 / 6227020800.0));
+		sinx = mipp::fnmadd(sinx, x2, mipp::Reg<double>(1.0 / 39916800.0));
+		sinx = mipp::fnmadd(sinx, x2, mipp::Reg<double>(1.0 / 362880.0));
+		sinx = mipp::fnmadd(sinx, x2, mipp::Reg<double>(1.0 / 5040.0));
+		sinx = mipp::fnmadd(sinx, x2, mipp::Reg<double>(1.0 / 120.0));
+		sinx = mipp::fnmadd(sinx, x2, mipp::Reg<double>(1.0 / 6.0));
+		sinx = mipp::fnmadd(sinx, x2, r_1) * x;
+
+		auto cosx = mipp::Reg<double>(1.0 / 6402373705728000.0); // 1/18!
+		cosx = mipp::fnmadd(cosx, x2, mipp::Reg<double>(1.0 / 20922789888000.0));
+		cosx = mipp::fnmadd(cosx, x2, mipp::Reg<double>(1.0 / 87178291200.0));
+		cosx = mipp::fnmadd(cosx, x2, mipp::Reg<double>(1.0 / 479001600.0));
+		cosx = mipp::fnmadd(cosx, x2, mipp::Reg<double>(1.0 / 3628800.0));
+		cosx = mipp::fnmadd(cosx, x2, mipp::Reg<double>(1.0 / 40320.0));
+		cosx = mipp::fnmadd(cosx, x2, mipp::Reg<double>(1.0 / 720.0));
+		cosx = mipp::fnmadd(cosx, x2, mipp::Reg<double>(1.0 / 24.0));
+		cosx = mipp::fnmadd(cosx, x2, r_half);
+		cosx = mipp::fnmadd(cosx, x2, r_1);
+
+		cosx = mipp::cast<int,double>(mipp::cast<double,int>(cosx) ^ (r2 & r_sign));
+		const auto m_swap = mipp::cast<int,double>(r2 & r_swap) > r_zero;
+
+		auto awgn1 = mipp::fmadd(radius, mipp::blend(sinx, cosx, m_swap), r_mu);
+		auto awgn2 = mipp::fmadd(radius, mipp::blend(cosx, sinx, m_swap), r_mu);
+
+		if (X != nullptr) // accumulate the noise into the output
+		{
+			mipp::Reg<double> x1, x2;
+			x1.loadu(&X[i                         ]);
+			x2.loadu(&X[i + mipp::nElReg<double>()]);
+			awgn1 += x1;
+			awgn2 += x2;
+		}
+
+		awgn1.storeu(&noise[i                         ]);
+		awgn2.storeu(&noise[i + mipp::nElReg<double>()]);
+	}
+
+	// seq version of the Box Muller method in the polar form
+	const auto twopi = 2.0 * 3.14159265358979323846;
+	const auto seq_loop_size = (int)(length / 2) * 2;
+	for (auto i = vec_loop_size; i < seq_loop_size; i += 2)
+	{
+		const auto u1 = get_random();
+		const auto u2 = get_random();
+
+		const auto radius = std::sqrt(std::log(u1) * -2.0) * sigma;
+		const auto theta  = u2 * twopi;
+
+		noise[i +0] = radius * std::sin(theta) + mu + (X != nullptr ? X[i +0] : 0.0);
+		noise[i +1] = radius * std::cos(theta) + mu + (X != nullptr ? X[i +1] : 0.0);
+	}
+
+	// distribute the last odd element
+	if ((int)length != seq_loop_size)
+	{
+		const auto u1 = get_random();
+		const auto u2 = get_random();
+
+		const auto radius = std::sqrt(std::log(u1) * -2.0) * sigma;
+		const auto theta  = twopi * u2;
+
+		noise[length -1] = radius * std::sin(theta) + mu + (X != nullptr ? X[length -1] : 0.0);
+	}
+}
+}
+}
+
+template <typename R>
+void Gaussian_noise_generator_fast<R>
+::generate(R *noise, const unsigned length, const R sigma, const R mu)
+{
+	if (!mipp::isAligned(noise))
+		throw runtime_error(__FILE__, __LINE__, __func__, "'noise' is misaligned memory.");
+
+	this->_generate(nullptr, noise, length, sigma, mu);
+}
+
+template <typename R>
+void Gaussian_noise_generator_fast<R>
+::add_noise(const R *X, R *Y, const unsigned length, const R sigma, const R mu)
+{
+	this->_generate(X, Y, length, sigma, mu);
+}
+
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #ifdef MULTI_PREC
@@ -24,11 +24,15 @@ public:
 	virtual ~Gaussian_noise_generator_fast();
 
 	virtual void set_seed(const int seed);
-	virtual void generate(R *noise, const unsigned length, const R sigma, const R mu = 0.0);
+	virtual void generate (R *noise,           const unsigned length, const R sigma, const R mu = 0.0);
+	virtual void add_noise(const R *X, R *Y,   const unsigned length, const R sigma, const R mu = 0.0);
 
 private:
 	inline mipp::Reg<R> get_random_simd();
 	inline R            get_random     ();
+
+	// computes 'noise' = 'X' + the Gaussian noise, or the Gaussian noise only when 'X' is nullptr
+	void _generate(const R *X, R *noise, const unsigned length, const R sigma, const R mu);
 };
 
 template <typename R = float>
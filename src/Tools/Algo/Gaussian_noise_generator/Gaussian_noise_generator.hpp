@@ -2,6 +2,8 @@
 #define GAUSSIAN_NOISE_GENERATOR_HPP_
 
 #include <vector>
+#include <algorithm>
+#include <mipp.h>
 
 namespace aff3ct
 {
@@ -25,8 +27,48 @@ public:
 		this->generate(noise.data(), (unsigned)noise.size(), sigma, mu);
 	}
 
+	template <class A = std::allocator<R>>
+	void add_noise(const std::vector<R,A> &X, std::vector<R,A> &Y, const R sigma, const R mu = 0.0)
+	{
+		this->add_noise(X.data(), Y.data(), (unsigned)Y.size(), sigma, mu);
+	}
+
 	virtual void set_seed(const int seed) = 0;
 	virtual void generate(R *noise, const unsigned length, const R sigma, const R mu = 0.0) = 0;
+
+	/*
+	 * Generates the noise and adds it to 'X': Y[i] = X[i] + noise[i] ('X' and 'Y' can be the same buffer).
+	 *
+	 * The default implementation generates the noise by small chunks that stay in the L1 cache, the generators
+	 * should override it to accumulate the noise into 'Y' directly from the registers.
+	 */
+	virtual void add_noise(const R *X, R *Y, const unsigned length, const R sigma, const R mu = 0.0)
+	{
+		constexpr unsigned chunk_size = 256;
+		alignas(64) R noise[chunk_size];
+
+		for (unsigned i = 0; i < length; i += chunk_size)
+		{
+			const auto n = std::min(chunk_size, length - i);
+			this->generate(noise, n, sigma, mu);
+			add(X + i, noise, Y + i, n);
+		}
+	}
+
+protected:
+	static void add(const R *X, const R *noise, R *Y, const unsigned length)
+	{
+		const auto vec_loop_size = (length / mipp::nElReg<R>()) * mipp::nElReg<R>();
+		for (unsigned i = 0; i < vec_loop_size; i += mipp::nElReg<R>())
+		{
+			mipp::Reg<R> r_x, r_n;
+			r_x.loadu(&X    [i]);
+			r_n.loadu(&noise[i]);
+			(r_x + r_n).storeu(&Y[i]);
+		}
+		for (auto i = vec_loop_size; i < length; i++)
+			Y[i] = X[i] + noise[i];
+	}
 };
 
 template <typename R = float>
@@ -34,4 +76,4 @@ using Gaussian_gen = Gaussian_noise_generator<R>;
 }
 }
 
-#endif /* CHANNEL_HPP_ */
+#endif /* GAUSSIAN_NOISE_GENERATOR_HPP_ */
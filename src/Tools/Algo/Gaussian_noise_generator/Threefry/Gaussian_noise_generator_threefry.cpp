@@ -0,0 +1,240 @@
+#include <cmath>
+#include <cstring>
+#include <sstream>
+#include <algorithm>
+#include <mipp.h>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Gaussian_noise_generator_threefry.hpp"
+
+using namespace aff3ct::tools;
+
+template <typename R>
+constexpr int Gaussian_noise_generator_threefry<R>::chunk_size;
+
+template <typename R>
+Gaussian_noise_generator_threefry<R>
+::Gaussian_noise_generator_threefry(const int seed, const unsigned stream_id, const unsigned n_streams)
+: Gaussian_noise_generator<R>(),
+  threefry(),
+  seed(seed),
+  stream_id(0),
+  n_streams(1)
+{
+	if (mipp::nElReg<int>() > chunk_size / 2)
+	{
+		std::stringstream message;
+		message << "'mipp::nElReg<int>()' has to be smaller or equal to 'chunk_size' / 2 ('mipp::nElReg<int>()' = "
+		        << mipp::nElReg<int>() << ", 'chunk_size' = " << chunk_size << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	this->set_stream(stream_id, n_streams);
+}
+
+template <typename R>
+Gaussian_noise_generator_threefry<R>
+::~Gaussian_noise_generator_threefry()
+{
+}
+
+template <typename R>
+void Gaussian_noise_generator_threefry<R>
+::set_seed(const int seed)
+{
+	this->seed = seed;
+	this->next_block.clear();
+}
+
+template <typename R>
+void Gaussian_noise_generator_threefry<R>
+::set_stream(const unsigned stream_id, const unsigned n_streams)
+{
+	if (n_streams == 0 || stream_id >= n_streams)
+	{
+		std::stringstream message;
+		message << "'stream_id' has to be smaller than 'n_streams' ('stream_id' = " << stream_id
+		        << ", 'n_streams' = " << n_streams << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	this->stream_id = stream_id;
+	this->n_streams = n_streams;
+	this->next_block.clear();
+}
+
+template <typename R>
+uint32_t Gaussian_noise_generator_threefry<R>
+::sigma_key(const R sigma)
+{
+	// the key does not depend on the floating-point precision of the simulation
+	const auto sigma_f = (float)sigma;
+	uint32_t key;
+	std::memcpy(&key, &sigma_f, sizeof(key));
+	return key;
+}
+
+template <typename R>
+uint32_t Gaussian_noise_generator_threefry<R>
+::next_block_id(const R sigma)
+{
+	auto it = this->next_block.find(sigma_key(sigma));
+	if (it == this->next_block.end())
+		it = this->next_block.insert(std::make_pair(sigma_key(sigma), (uint32_t)this->stream_id)).first;
+
+	const auto block_id = it->second;
+	it->second += this->n_streams;
+
+	return block_id;
+}
+
+template <typename R>
+void Gaussian_noise_generator_threefry<R>
+::generate(R *noise, const unsigned length, const R sigma, const R mu)
+{
+	this->generate(noise, length, sigma, mu, this->next_block_id(sigma));
+}
+
+template <typename R>
+void Gaussian_noise_generator_threefry<R>
+::add_noise(const R *X, R *Y, const unsigned length, const R sigma, const R mu)
+{
+	this->add_noise(X, Y, length, sigma, mu, this->next_block_id(sigma));
+}
+
+template <typename R>
+void Gaussian_noise_generator_threefry<R>
+::generate(R *noise, const unsigned length, const R sigma, const R mu, const uint32_t block_id)
+{
+	this->threefry.set_key((uint32_t)this->seed, sigma_key(sigma));
+
+	const auto n_chunks = length / chunk_size;
+	for (unsigned c = 0; c < n_chunks; c++)
+		this->generate_chunk(noise + c * chunk_size, c, block_id, sigma, mu);
+
+	// the last chunk is computed entirely to keep the same values whatever the length
+	if (length % chunk_size)
+	{
+		R chunk[chunk_size];
+		this->generate_chunk(chunk, n_chunks, block_id, sigma, mu);
+		std::copy(chunk, chunk + length % chunk_size, noise + n_chunks * chunk_size);
+	}
+}
+
+template <typename R>
+void Gaussian_noise_generator_threefry<R>
+::add_noise(const R *X, R *Y, const unsigned length, const R sigma, const R mu, const uint32_t block_id)
+{
+	this->threefry.set_key((uint32_t)this->seed, sigma_key(sigma));
+
+	// the chunks stay in the registers or in the L1 cache
+	R chunk[chunk_size];
+	for (unsigned i = 0; i < length; i += chunk_size)
+	{
+		const auto n = std::min((unsigned)chunk_size, length - i);
+		this->generate_chunk(chunk, i / chunk_size, block_id, sigma, mu);
+		Gaussian_noise_generator<R>::add(X + i, chunk, Y + i, n);
+	}
+}
+
+// the lane indexes of a mipp::Reg<int>
+static mipp::Reg<int> lane_ids()
+{
+	mipp::vector<int> ids(mipp::nElReg<int>());
+	for (auto i = 0; i < mipp::nElReg<int>(); i++)
+		ids[i] = i;
+	return mipp::Reg<int>(ids.data());
+}
+
+template <typename R>
+void Gaussian_noise_generator_threefry<R>
+::generate_chunk(R *chunk, const uint32_t chunk_id, const uint32_t block_id, const R sigma, const R mu)
+{
+	constexpr int n_pairs = chunk_size / 2;
+	const auto twopi = (R)(2.0 * 3.14159265358979323846);
+
+	// SIMD generation of the random words (one counter per lane)
+	uint32_t x0[n_pairs], x1[n_pairs];
+	static const auto r_ids = lane_ids(); // built once for all the chunks
+
+	const auto r_block = mipp::Reg<int>((int)block_id);
+	for (auto p = 0; p < n_pairs; p += mipp::nElReg<int>())
+	{
+		const auto r_pair = r_ids + mipp::Reg<int>((int)(chunk_id * n_pairs + p));
+
+		mipp::Reg<int> r_x0, r_x1;
+		this->threefry.rand(r_pair, r_block, r_x0, r_x1);
+
+		r_x0.storeu((int*)&x0[p]);
+		r_x1.storeu((int*)&x1[p]);
+	}
+
+	// seq version of the Box Muller method
+	for (auto p = 0; p < n_pairs; p++)
+	{
+		// numbers between ]0,1[
+		const auto u1 = ((R)x0[p] + (R)0.5) * (R)(1.0 / 4294967296.0);
+		const auto u2 = ((R)x1[p] + (R)0.5) * (R)(1.0 / 4294967296.0);
+
+		const auto radius = (R)std::sqrt(std::log(u1) * (R)-2.0) * sigma;
+		const auto theta  = u2 * twopi;
+
+		chunk[          p] = radius * std::cos(theta) + mu;
+		chunk[n_pairs + p] = radius * std::sin(theta) + mu;
+	}
+}
+
+namespace aff3ct
+{
+namespace tools
+{
+template <>
+void Gaussian_noise_generator_threefry<float>
+::generate_chunk(float *chunk, const uint32_t chunk_id, const uint32_t block_id, const float sigma, const float mu)
+{
+	constexpr int n_pairs = chunk_size / 2;
+	const auto twopi = (float)(2.0 * 3.14159265358979323846);
+
+	static const auto r_ids = lane_ids(); // built once for all the chunks
+
+	const auto r_block = mipp::Reg<int>((int)block_id);
+	const auto r_low24 = mipp::Reg<int>(0x00FFFFFF);
+
+	// SIMD version of the Box Muller method (one counter per lane)
+	for (auto p = 0; p < n_pairs; p += mipp::nElReg<int>())
+	{
+		const auto r_pair = r_ids + mipp::Reg<int>((int)(chunk_id * n_pairs + p));
+
+		mipp::Reg<int> r_x0, r_x1;
+		this->threefry.rand(r_pair, r_block, r_x0, r_x1);
+
+		// numbers between ]0,1[ from the 24 most significant bits (exactly representable in single precision)
+		const auto u1 = (mipp::cvt<int,float>((r_x0 >> 8) & r_low24) + 0.5f) * (1.f / 16777216.f);
+		const auto u2 = (mipp::cvt<int,float>((r_x1 >> 8) & r_low24) + 0.5f) * (1.f / 16777216.f);
+
+		const auto radius = mipp::sqrt(mipp::log(u1) * -2.f) * sigma;
+		const auto theta  = u2 * twopi;
+
+		mipp::Reg<float> sintheta, costheta;
+		mipp::sincos(theta, sintheta, costheta);
+
+		const auto awgn1 = radius * costheta + mu;
+		const auto awgn2 = radius * sintheta + mu;
+
+		awgn1.storeu(&chunk[          p]);
+		awgn2.storeu(&chunk[n_pairs + p]);
+	}
+}
+}
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::tools::Gaussian_noise_generator_threefry<R_32>;
+template class aff3ct::tools::Gaussian_noise_generator_threefry<R_64>;
+#else
+template class aff3ct::tools::Gaussian_noise_generator_threefry<R>;
+#endif
+// ==================================================================================== explicit template instantiation
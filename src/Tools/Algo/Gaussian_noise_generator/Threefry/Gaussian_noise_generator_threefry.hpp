@@ -0,0 +1,81 @@
+#ifndef GAUSSIAN_NOISE_GENERATOR_THREEFRY_HPP_
+#define GAUSSIAN_NOISE_GENERATOR_THREEFRY_HPP_
+
+#include <map>
+#include <cstdint>
+
+#include "Tools/Algo/PRNG/PRNG_Threefry.hpp"
+
+#include "../Gaussian_noise_generator.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Gaussian_noise_generator_threefry
+ *
+ * \brief Counter-based Gaussian noise generator: the noise is a pure function of (seed, sigma, block index).
+ *
+ * Each call to generate() produces one block of noise (generally the frames of one channel execution). The blocks
+ * are numbered separately for each sigma value, and a generator only produces the blocks of its stream:
+ * 'stream_id', 'stream_id' + 'n_streams', 'stream_id' + 2 * 'n_streams', ... When the threads of a simulation share
+ * the same seed and use their own stream, no block is drawn twice, the threads do not share any state, and the noise
+ * of a block does not depend on the number of threads: it can be regenerated at any time with the 'block_id' version
+ * of generate().
+ *
+ * The elements of a block are produced by chunks of 32 values, the Box-Muller transform being applied to the output
+ * of one Threefry counter per pair of values. The layout of a chunk does not depend on the SIMD width.
+ */
+template <typename R = float>
+class Gaussian_noise_generator_threefry : public Gaussian_noise_generator<R>
+{
+private:
+	static constexpr int chunk_size = 32;
+
+	tools::PRNG_Threefry          threefry;
+	int                           seed;
+	unsigned                      stream_id;
+	unsigned                      n_streams;
+	std::map<uint32_t, uint32_t>  next_block; // next block index for each sigma value
+
+public:
+	explicit Gaussian_noise_generator_threefry(const int seed = 0, const unsigned stream_id = 0,
+	                                           const unsigned n_streams = 1);
+	virtual ~Gaussian_noise_generator_threefry();
+
+	virtual void set_seed(const int seed);
+
+	/*!
+	 * \brief Selects the blocks produced by the stateful generate() method and restarts the block numbering.
+	 *
+	 * \param stream_id: index of the first block of the stream (typically the thread id).
+	 * \param n_streams: number of interleaved streams (typically the number of threads).
+	 */
+	void set_stream(const unsigned stream_id, const unsigned n_streams);
+
+	virtual void generate (R *noise,         const unsigned length, const R sigma, const R mu = 0.0);
+	virtual void add_noise(const R *X, R *Y, const unsigned length, const R sigma, const R mu = 0.0);
+
+	/*!
+	 * \brief Generates the block of noise 'block_id' without modifying the state of the generator.
+	 */
+	void generate(R *noise, const unsigned length, const R sigma, const R mu, const uint32_t block_id);
+
+	/*!
+	 * \brief Adds the block of noise 'block_id' to 'X' without modifying the state of the generator.
+	 */
+	void add_noise(const R *X, R *Y, const unsigned length, const R sigma, const R mu, const uint32_t block_id);
+
+private:
+	static uint32_t sigma_key(const R sigma);
+	uint32_t next_block_id(const R sigma);
+	void generate_chunk(R *chunk, const uint32_t chunk_id, const uint32_t block_id, const R sigma, const R mu);
+};
+
+template <typename R = float>
+using Gaussian_gen_threefry = Gaussian_noise_generator_threefry<R>;
+}
+}
+
+#endif /* GAUSSIAN_NOISE_GENERATOR_THREEFRY_HPP_ */
@@ -0,0 +1,220 @@
+#include <cmath>
+#include <cstdlib>
+
+#include "Gaussian_noise_generator_ziggurat.hpp"
+
+using namespace aff3ct::tools;
+
+template <typename R>
+constexpr int Gaussian_noise_generator_ziggurat<R>::n_layers;
+
+// the abscissa of the start of the tail and the area of a layer (for 128 layers)
+static constexpr double zig_r = 3.442619855899;
+static constexpr double zig_v = 9.91256303526217e-3;
+
+// the scale of the signed 25-bit abscissa (the 25 most significant bits of the random word minus 2^24)
+static constexpr double zig_m = 16777216.0; // 2^24
+
+template <typename R>
+Gaussian_noise_generator_ziggurat<R>
+::Gaussian_noise_generator_ziggurat(const int seed)
+: Gaussian_noise_generator<R>(),
+  mt19937(seed),
+  mt19937_simd()
+{
+	this->set_seed(seed);
+
+	// build the tables of the layers (from the top of the tail to the top of the density)
+	auto dn = zig_r, tn = zig_r;
+	const auto q = zig_v / std::exp(-0.5 * dn * dn);
+
+	k[0] = (uint32_t)((dn / q) * zig_m); // the base layer includes the tail
+	k[1] = 0;
+
+	w[0]              = (R)(q  / zig_m);
+	w[n_layers -1]    = (R)(dn / zig_m);
+
+	f[0]              = 1.0;
+	f[n_layers -1]    = std::exp(-0.5 * dn * dn);
+
+	for (auto i = n_layers -2; i >= 1; i--)
+	{
+		dn = std::sqrt(-2.0 * std::log(zig_v / dn + std::exp(-0.5 * dn * dn)));
+		k[i +1] = (uint32_t)((dn / tn) * zig_m);
+		tn = dn;
+		f[i] = std::exp(-0.5 * dn * dn);
+		w[i] = (R)(dn / zig_m);
+	}
+}
+
+template <typename R>
+Gaussian_noise_generator_ziggurat<R>
+::~Gaussian_noise_generator_ziggurat()
+{
+}
+
+template <typename R>
+void Gaussian_noise_generator_ziggurat<R>
+::set_seed(const int seed)
+{
+	mt19937.seed(seed);
+
+	mipp::vector<int> seeds(mipp::nElReg<int>());
+	for (auto i = 0; i < mipp::nElReg<int>(); i++)
+		seeds[i] = mt19937.rand();
+	mt19937_simd.seed(seeds.data());
+}
+
+template <typename R>
+R Gaussian_noise_generator_ziggurat<R>
+::normal_slow(int32_t j, int32_t iz)
+{
+	for (;;)
+	{
+		const auto x = (double)j * (double)w[iz];
+
+		// sample from the tail
+		if (iz == 0)
+		{
+			double xt, y;
+			do
+			{
+				xt = -std::log(mt19937.randd_oo()) / zig_r;
+				y  = -std::log(mt19937.randd_oo());
+			}
+			while (y + y < xt * xt);
+
+			return (R)(j > 0 ? zig_r + xt : -zig_r - xt);
+		}
+
+		// sample from the wedge
+		if (f[iz] + mt19937.randd_oo() * (f[iz -1] - f[iz]) < std::exp(-0.5 * x * x))
+			return (R)x;
+
+		// rejected: new draw
+		const auto u = mt19937.rand_u32();
+		iz = (int32_t)(u & (n_layers -1));
+		j  = (int32_t)(u >> 7) - (1 << 24);
+		if ((uint32_t)std::abs(j) < k[iz])
+			return (R)j * w[iz];
+	}
+}
+
+template <typename R>
+R Gaussian_noise_generator_ziggurat<R>
+::normal()
+{
+	const auto u  = mt19937.rand_u32();
+	const auto iz = (int32_t)(u & (n_layers -1));
+	const auto j  = (int32_t)(u >> 7) - (1 << 24);
+
+	if ((uint32_t)std::abs(j) < k[iz])
+		return (R)j * w[iz];
+	else
+		return this->normal_slow(j, iz);
+}
+
+template <typename R>
+void Gaussian_noise_generator_ziggurat<R>
+::generate_simd(R *noise, const R sigma, const R mu)
+{
+	int32_t j[mipp::nElReg<int>()], iz[mipp::nElReg<int>()];
+	const auto r_msk = mipp::Reg<int>((1 << 25) -1);
+	const auto r_off = mipp::Reg<int>( 1 << 24    );
+
+	const auto u = mt19937_simd.rand_s32();
+	(((u >> 7) & r_msk) - r_off     ).storeu(j );
+	(u & mipp::Reg<int>(n_layers -1)).storeu(iz);
+
+	for (auto l = 0; l < mipp::nElReg<int>(); l++)
+	{
+		const auto x = ((uint32_t)std::abs(j[l]) < k[iz[l]]) ? (R)j[l] * w[iz[l]] : this->normal_slow(j[l], iz[l]);
+		noise[l] = x * sigma + mu;
+	}
+}
+
+namespace aff3ct
+{
+namespace tools
+{
+template <>
+void Gaussian_noise_generator_ziggurat<float>
+::generate_simd(float *noise, const float sigma, const float mu)
+{
+	int32_t j[mipp::nElReg<int>()], iz[mipp::nElReg<int>()], k_iz[mipp::nElReg<int>()];
+	float w_iz[mipp::nElReg<float>()];
+	const auto r_msk = mipp::Reg<int>((1 << 25) -1);
+	const auto r_off = mipp::Reg<int>( 1 << 24    );
+
+	const auto u    = mt19937_simd.rand_s32();
+	const auto r_j  = ((u >> 7) & r_msk) - r_off;
+	const auto r_iz = u & mipp::Reg<int>(n_layers -1);
+	r_iz.storeu(iz);
+
+	// table lookups
+	for (auto l = 0; l < mipp::nElReg<int>(); l++)
+	{
+		k_iz[l] = (int32_t)k[iz[l]];
+		w_iz[l] =          w[iz[l]];
+	}
+
+	// the tables of the lanes are on the stack (not aligned): unaligned loads
+	mipp::Reg<float> r_w_iz; r_w_iz.loadu(w_iz);
+	mipp::Reg<int  > r_k_iz; r_k_iz.loadu(k_iz);
+
+	// the abscissas are in [-2^24, 2^24[: the conversion to float is exact and the absolute value can't overflow
+	const auto r_x      = mipp::cvt<int,float>(r_j) * r_w_iz;
+	const auto m_accept = mipp::abs(r_j) < r_k_iz;
+
+	mipp::fmadd(r_x, mipp::Reg<float>(sigma), mipp::Reg<float>(mu)).storeu(noise);
+
+	// the rare rejected lanes go through the wedge and the tail
+	if (!mipp::testz(~m_accept))
+	{
+		r_j.storeu(j);
+		for (auto l = 0; l < mipp::nElReg<int>(); l++)
+			if ((uint32_t)std::abs(j[l]) >= k[iz[l]])
+				noise[l] = this->normal_slow(j[l], iz[l]) * sigma + mu;
+	}
+}
+}
+}
+
+template <typename R>
+void Gaussian_noise_generator_ziggurat<R>
+::generate(R *noise, const unsigned length, const R sigma, const R mu)
+{
+	const auto vec_loop_size = (length / mipp::nElReg<int>()) * mipp::nElReg<int>();
+	for (unsigned i = 0; i < vec_loop_size; i += mipp::nElReg<int>())
+		this->generate_simd(noise + i, sigma, mu);
+
+	for (auto i = vec_loop_size; i < length; i++)
+		noise[i] = this->normal() * sigma + mu;
+}
+
+template <typename R>
+void Gaussian_noise_generator_ziggurat<R>
+::add_noise(const R *X, R *Y, const unsigned length, const R sigma, const R mu)
+{
+	R noise[mipp::nElReg<int>()];
+
+	const auto vec_loop_size = (length / mipp::nElReg<int>()) * mipp::nElReg<int>();
+	for (unsigned i = 0; i < vec_loop_size; i += mipp::nElReg<int>())
+	{
+		this->generate_simd(noise, sigma, mu);
+		Gaussian_noise_generator<R>::add(X + i, noise, Y + i, mipp::nElReg<int>());
+	}
+
+	for (auto i = vec_loop_size; i < length; i++)
+		Y[i] = X[i] + this->normal() * sigma + mu;
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::tools::Gaussian_noise_generator_ziggurat<R_32>;
+template class aff3ct::tools::Gaussian_noise_generator_ziggurat<R_64>;
+#else
+template class aff3ct::tools::Gaussian_noise_generator_ziggurat<R>;
+#endif
+// ==================================================================================== explicit template instantiation
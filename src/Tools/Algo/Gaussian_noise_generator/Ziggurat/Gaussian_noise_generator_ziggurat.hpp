@@ -0,0 +1,60 @@
+#ifndef GAUSSIAN_NOISE_GENERATOR_ZIGGURAT_HPP_
+#define GAUSSIAN_NOISE_GENERATOR_ZIGGURAT_HPP_
+
+#include <cstdint>
+#include <mipp.h>
+
+#include "Tools/Algo/PRNG/PRNG_MT19937.hpp"
+#include "Tools/Algo/PRNG/PRNG_MT19937_simd.hpp"
+
+#include "../Gaussian_noise_generator.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Gaussian_noise_generator_ziggurat
+ *
+ * \brief Gaussian noise generator based on the Ziggurat method (Marsaglia and Tsang, 2000).
+ *
+ * The normal density is covered by 128 layers of equal area. A 32-bit random word gives the layer (7 bits) and a
+ * signed abscissa (25 bits): when the abscissa falls in the rectangular part of its layer (~98.8% of the draws), the
+ * sample is accepted after one table lookup and one multiplication, without any log, sqrt or sin/cos. The words are
+ * drawn and tested by SIMD registers, the few rejected lanes are fixed with the scalar wedge and tail procedures.
+ * The layer index and the abscissa use disjoint bits (the original algorithm shares the low bits of the word, which
+ * is known to slightly bias the distribution).
+ */
+template <typename R = float>
+class Gaussian_noise_generator_ziggurat : public Gaussian_noise_generator<R>
+{
+private:
+	static constexpr int n_layers = 128;
+
+	tools::PRNG_MT19937      mt19937;      // Mersenne Twister 19937 (scalar)
+	tools::PRNG_MT19937_simd mt19937_simd; // Mersenne Twister 19937 (SIMD)
+
+	uint32_t k[n_layers]; // the bounds of the rectangular parts of the layers (on the 25-bit abscissa scale)
+	R        w[n_layers]; // the widths of the layers divided by the abscissa scale
+	double   f[n_layers]; // the density at the right edge of the layers
+
+public:
+	explicit Gaussian_noise_generator_ziggurat(const int seed = 0);
+	virtual ~Gaussian_noise_generator_ziggurat();
+
+	virtual void set_seed(const int seed);
+	virtual void generate (R *noise,         const unsigned length, const R sigma, const R mu = 0.0);
+	virtual void add_noise(const R *X, R *Y, const unsigned length, const R sigma, const R mu = 0.0);
+
+private:
+	inline void generate_simd(R *noise, const R sigma, const R mu);
+	inline R    normal       ();
+	       R    normal_slow  (int32_t j, int32_t iz);
+};
+
+template <typename R = float>
+using Gaussian_gen_ziggurat = Gaussian_noise_generator_ziggurat<R>;
+}
+}
+
+#endif /* GAUSSIAN_NOISE_GENERATOR_ZIGGURAT_HPP_ */
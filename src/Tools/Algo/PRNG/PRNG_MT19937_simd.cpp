@@ -1,5 +1,7 @@
 #include <limits>
 
+#include "Tools/Perf/double_words.h"
+
 #include "PRNG_MT19937_simd.hpp"
 
 using namespace aff3ct::tools;
@@ -185,3 +187,24 @@ mipp::Reg<float> PRNG_MT19937_simd::randf_oo()
 
 	return mipp::abs((rand_s32.cvt<float>() + 0.5f) / (max + 1.0f));
 }
+
+// builds doubles in [1, 2> from two consecutive 32-bit random numbers: the 52 bits of the mantissa are random and the
+// exponent is set to 0
+static inline mipp::Reg<double> to_double_12(const mipp::Reg<int> rand_s32)
+{
+	static const auto mantissa = set_double_words((int)0xFFFFFFFF, (int)0x000FFFFF);
+	static const auto exponent = set_double_words((int)0x00000000, (int)0x3FF00000);
+
+	return mipp::cast<int,double>((rand_s32 & mantissa) | exponent);
+}
+
+mipp::Reg<double> PRNG_MT19937_simd::randd_co()
+{
+	return to_double_12(this->rand_s32()) - mipp::Reg<double>(1.0);
+}
+
+mipp::Reg<double> PRNG_MT19937_simd::randd_oo()
+{
+	// shift of half a step (2^-53) to exclude 0 and 1
+	return to_double_12(this->rand_s32()) - mipp::Reg<double>(1.0 - 1.0 / 9007199254740992.0);
+}
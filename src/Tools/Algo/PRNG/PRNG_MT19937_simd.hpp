@@ -80,6 +80,26 @@ public:
 	 */
 	mipp::Reg<float> randf_oo();
 
+	/*!
+	 * \brief Returns a random double in the OPEN range [0, 1>
+	 * Mnemonic: randd_co = random double 0=closed 1=open.
+	 *
+	 * The 52 bits of the mantissa are random (two 32-bit numbers are combined into one double).
+	 *
+	 * \return a vector register of pseudo random numbers.
+	 */
+	mipp::Reg<double> randd_co();
+
+	/*!
+	 * \brief Returns a random double in the OPEN range <0, 1>
+	 * Mnemonic: randd_oo = random double 0=open 1=open.
+	 *
+	 * The 52 bits of the mantissa are random (two 32-bit numbers are combined into one double).
+	 *
+	 * \return a vector register of pseudo random numbers.
+	 */
+	mipp::Reg<double> randd_oo();
+
 private:
 	void generate_numbers();
 };
@@ -0,0 +1,25 @@
+#include "PRNG_Threefry.hpp"
+
+using namespace aff3ct::tools;
+
+constexpr int      PRNG_Threefry::n_rounds;
+constexpr uint32_t PRNG_Threefry::parity;
+
+PRNG_Threefry
+::PRNG_Threefry(const uint32_t k0, const uint32_t k1)
+{
+	this->set_key(k0, k1);
+}
+
+PRNG_Threefry
+::~PRNG_Threefry()
+{
+}
+
+void PRNG_Threefry
+::set_key(const uint32_t k0, const uint32_t k1)
+{
+	this->ks[0] = k0;
+	this->ks[1] = k1;
+	this->ks[2] = parity ^ k0 ^ k1;
+}
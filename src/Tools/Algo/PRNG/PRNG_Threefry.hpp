@@ -0,0 +1,121 @@
+/*!
+ * \file
+ * \brief The Threefry-2x32 counter-based pseudo-random number generator (PRNG).
+ *
+ * Threefry is a counter-based PRNG (Salmon et al., "Parallel Random Numbers: As Easy as 1, 2, 3", SC'11): the output
+ * is a bijection of a 64-bit counter parametrized by a 64-bit key. There is no internal state to update, so any
+ * element of the random stream can be computed directly from its position, and as many independent streams as
+ * needed can be obtained by changing the key. The rounds only use additions, rotations and xors on 32-bit words:
+ * the SIMD version computes one counter per lane.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+
+#ifndef PRNG_THREEFRY_HPP
+#define PRNG_THREEFRY_HPP
+
+#include <cstdint>
+#include <mipp.h>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class PRNG_Threefry
+ * \brief The Threefry-2x32 counter-based pseudo-random number generator (20 rounds).
+ */
+class PRNG_Threefry
+{
+protected:
+	static constexpr int      n_rounds = 20;
+	static constexpr uint32_t parity   = 0x1BD11BDA; // the Skein key schedule parity
+
+	uint32_t ks[3]; // the expanded key
+
+public:
+	explicit PRNG_Threefry(const uint32_t k0 = 0, const uint32_t k1 = 0);
+	virtual ~PRNG_Threefry();
+
+	/*!
+	 * \brief Selects the random stream.
+	 *
+	 * \param k0: first  32-bit word of the key.
+	 * \param k1: second 32-bit word of the key.
+	 */
+	void set_key(const uint32_t k0, const uint32_t k1);
+
+	/*!
+	 * \brief Computes the random block associated to the counter (c0, c1).
+	 *
+	 * \param c0: first  32-bit word of the counter.
+	 * \param c1: second 32-bit word of the counter.
+	 * \param x0: first  32 random bits.
+	 * \param x1: second 32 random bits.
+	 */
+	inline void rand(const uint32_t c0, const uint32_t c1, uint32_t &x0, uint32_t &x1) const
+	{
+		x0 = c0 + ks[0];
+		x1 = c1 + ks[1];
+
+		for (auto r = 0; r < n_rounds; r++)
+		{
+			x0 += x1;
+			x1  = (x1 << rot(r)) | (x1 >> (32 - rot(r)));
+			x1 ^= x0;
+
+			if ((r & 3) == 3) // key injection every 4 rounds
+			{
+				const auto s = (uint32_t)((r +1) >> 2);
+				x0 += ks[(s +0) % 3];
+				x1 += ks[(s +1) % 3] + s;
+			}
+		}
+	}
+
+	/*!
+	 * \brief Computes mipp::nElReg<int>() random blocks at once (SIMD version of rand()).
+	 *
+	 * \param c0: vector register of the first  32-bit words of the counters.
+	 * \param c1: vector register of the second 32-bit words of the counters.
+	 * \param x0: vector register of the first  32 random bits.
+	 * \param x1: vector register of the second 32 random bits.
+	 */
+	inline void rand(const mipp::Reg<int> c0, const mipp::Reg<int> c1, mipp::Reg<int> &x0, mipp::Reg<int> &x1) const
+	{
+		const mipp::Reg<int> r_ks[3] = {mipp::Reg<int>((int)ks[0]),
+		                                mipp::Reg<int>((int)ks[1]),
+		                                mipp::Reg<int>((int)ks[2])};
+
+		x0 = c0 + r_ks[0];
+		x1 = c1 + r_ks[1];
+
+		for (auto r = 0; r < n_rounds; r++)
+		{
+			// the mask keeps the rotation correct whatever the kind of right shift (arithmetic or logical)
+			const auto msk = mipp::Reg<int>((int)((1u << rot(r)) -1));
+			x0 += x1;
+			x1  = (x1 << rot(r)) | ((x1 >> (32 - rot(r))) & msk);
+			x1 ^= x0;
+
+			if ((r & 3) == 3) // key injection every 4 rounds
+			{
+				const auto s = (r +1) >> 2;
+				x0 += r_ks[(s +0) % 3];
+				x1 += r_ks[(s +1) % 3] + mipp::Reg<int>(s);
+			}
+		}
+	}
+
+private:
+	static inline int rot(const int r)
+	{
+		constexpr int R_32x2[8] = {13, 15, 26, 6, 17, 29, 16, 24};
+		return R_32x2[r & 7];
+	}
+};
+}
+}
+
+#endif /* PRNG_THREEFRY_HPP */
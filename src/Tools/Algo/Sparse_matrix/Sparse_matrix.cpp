@@ -2,6 +2,9 @@
 #include <sstream>
 #include <vector>
 #include <algorithm>
+#include <numeric>
+#include <mutex>
+#include <limits>
 
 #include "Tools/Exception/exception.hpp"
 
@@ -10,16 +13,33 @@
 using namespace aff3ct;
 using namespace aff3ct::tools;
 
+static const unsigned none = std::numeric_limits<unsigned>::max();
+
 Sparse_matrix
 ::Sparse_matrix(const unsigned n_rows, const unsigned n_cols)
-: n_rows         (n_rows),
-  n_cols         (n_cols),
-  rows_max_degree(0     ),
-  cols_max_degree(0     ),
-  n_connections  (0     ),
-  row_to_cols    (n_rows),
-  col_to_rows    (n_cols)
+: n_rows         (n_rows    ),
+  n_cols         (n_cols    ),
+  rows_max_degree(0         ),
+  cols_max_degree(0         ),
+  n_connections  (0         ),
+  row_offsets    (n_rows + 1),
+  col_offsets    (n_cols + 1),
+  compressed     (true      )
+{
+}
+
+Sparse_matrix
+::Sparse_matrix(const Sparse_matrix &other)
+: compressed(true)
 {
+	this->copy(other);
+}
+
+Sparse_matrix
+::Sparse_matrix(Sparse_matrix &&other)
+: compressed(true)
+{
+	*this = std::move(other);
 }
 
 Sparse_matrix
@@ -27,6 +47,76 @@ Sparse_matrix
 {
 }
 
+Sparse_matrix& Sparse_matrix
+::operator=(const Sparse_matrix &other)
+{
+	if (this != &other)
+		this->copy(other);
+	return *this;
+}
+
+Sparse_matrix& Sparse_matrix
+::operator=(Sparse_matrix &&other)
+{
+	if (this == &other)
+		return *this;
+
+	other.check_compressed();
+
+	this->n_rows          = other.n_rows;
+	this->n_cols          = other.n_cols;
+	this->rows_max_degree = other.rows_max_degree;
+	this->cols_max_degree = other.cols_max_degree;
+	this->n_connections   = other.n_connections;
+	this->row_offsets     = std::move(other.row_offsets);
+	this->row_indexes     = std::move(other.row_indexes);
+	this->col_offsets     = std::move(other.col_offsets);
+	this->col_indexes     = std::move(other.col_indexes);
+
+	this->pending            .clear();
+	this->pending_next       .clear();
+	this->pending_rows_head  .clear();
+	this->pending_rows_degree.clear();
+	this->pending_cols_degree.clear();
+	this->compressed.store(true, std::memory_order_release);
+
+	// leave 'other' as an empty matrix
+	other.n_rows          = 0;
+	other.n_cols          = 0;
+	other.rows_max_degree = 0;
+	other.cols_max_degree = 0;
+	other.n_connections   = 0;
+	other.row_offsets.assign(1, 0);
+	other.row_indexes.clear();
+	other.col_offsets.assign(1, 0);
+	other.col_indexes.clear();
+
+	return *this;
+}
+
+void Sparse_matrix
+::copy(const Sparse_matrix &other)
+{
+	other.check_compressed();
+
+	this->n_rows          = other.n_rows;
+	this->n_cols          = other.n_cols;
+	this->rows_max_degree = other.rows_max_degree;
+	this->cols_max_degree = other.cols_max_degree;
+	this->n_connections   = other.n_connections;
+	this->row_offsets     = other.row_offsets;
+	this->row_indexes     = other.row_indexes;
+	this->col_offsets     = other.col_offsets;
+	this->col_indexes     = other.col_indexes;
+
+	this->pending            .clear();
+	this->pending_next       .clear();
+	this->pending_rows_head  .clear();
+	this->pending_rows_degree.clear();
+	this->pending_cols_degree.clear();
+	this->compressed.store(true, std::memory_order_release);
+}
+
 unsigned Sparse_matrix
 ::get_n_rows() const
 {
@@ -57,42 +147,33 @@ unsigned Sparse_matrix
 	return this->n_connections;
 }
 
-const std::vector<unsigned>& Sparse_matrix
-::get_cols_from_row(const size_t row_index) const
-{
-	return this->row_to_cols[row_index];
-}
-
-const std::vector<unsigned>& Sparse_matrix
-::get_rows_from_col(const size_t col_index) const
-{
-	return this->col_to_rows[col_index];
-}
-
-const std::vector<unsigned>& Sparse_matrix
-::operator[](const size_t col_index) const
-{
-	return this->get_rows_from_col(col_index);
-}
-
 bool Sparse_matrix
 ::at(const size_t row_index, const size_t col_index) const
 {
-	auto it = std::find(this->row_to_cols[row_index].begin(), this->row_to_cols[row_index].end(), col_index);
+	const auto cols = this->get_cols_from_row(row_index);
+	auto it = std::find(cols.begin(), cols.end(), (unsigned)col_index);
 
-	return (it != this->row_to_cols[row_index].end());
+	return (it != cols.end());
 }
 
-const std::vector<std::vector<unsigned int>>& Sparse_matrix
-::get_row_to_cols() const
+bool Sparse_matrix
+::operator==(const Sparse_matrix &other) const
 {
-	return this->row_to_cols;
+	this->check_compressed();
+	other.check_compressed();
+
+	return this->n_rows      == other.n_rows      &&
+	       this->n_cols      == other.n_cols      &&
+	       this->row_offsets == other.row_offsets &&
+	       this->row_indexes == other.row_indexes &&
+	       this->col_offsets == other.col_offsets &&
+	       this->col_indexes == other.col_indexes;
 }
 
-const std::vector<std::vector<unsigned int>>& Sparse_matrix
-::get_col_to_rows() const
+bool Sparse_matrix
+::operator!=(const Sparse_matrix &other) const
 {
-	return this->col_to_rows;
+	return !(*this == other);
 }
 
 void Sparse_matrix
@@ -114,27 +195,39 @@ void Sparse_matrix
 		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
 	}
 
-	for (size_t i = 0; i < this->row_to_cols[row_index].size(); i++)
-		if (this->row_to_cols[row_index][i] == col_index)
-		{
-			std::stringstream message;
-			message << "'col_index' already exists ('col_index' = " << col_index << ").";
-			throw runtime_error(__FILE__, __LINE__, __func__, message.str());
-		}
+	const auto first = this->row_indexes.begin() + this->row_offsets[row_index   ];
+	const auto last  = this->row_indexes.begin() + this->row_offsets[row_index +1];
+	auto exists = std::find(first, last, (unsigned)col_index) != last;
 
-	for (size_t i = 0; i < this->col_to_rows[col_index].size(); i++)
-		if (this->col_to_rows[col_index][i] == row_index)
-		{
-			std::stringstream message;
-			message << "'row_index' already exists ('row_index' = " << row_index << ").";
-			throw runtime_error(__FILE__, __LINE__, __func__, message.str());
-		}
+	if (this->pending.empty())
+	{
+		this->pending_rows_head  .assign(this->n_rows, none);
+		this->pending_rows_degree.assign(this->n_rows, 0   );
+		this->pending_cols_degree.assign(this->n_cols, 0   );
+	}
+
+	for (auto p = this->pending_rows_head[row_index]; !exists && p != none; p = this->pending_next[p])
+		exists = this->pending[p].second == col_index;
+
+	if (exists)
+	{
+		std::stringstream message;
+		message << "'col_index' already exists ('col_index' = " << col_index << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
 
-	this->row_to_cols[row_index].push_back((unsigned)col_index);
-	this->col_to_rows[col_index].push_back((unsigned)row_index);
+	this->pending_next.push_back(this->pending_rows_head[row_index]);
+	this->pending_rows_head[row_index] = (unsigned)this->pending.size();
+	this->pending.push_back(std::make_pair((unsigned)row_index, (unsigned)col_index));
+	this->compressed.store(false, std::memory_order_release);
 
-	rows_max_degree = std::max(rows_max_degree, (unsigned)this->row_to_cols[row_index].size());
-	cols_max_degree = std::max(cols_max_degree, (unsigned)this->col_to_rows[col_index].size());
+	const auto row_degree = this->row_offsets[row_index +1] - this->row_offsets[row_index]
+	                      + ++this->pending_rows_degree[row_index];
+	const auto col_degree = this->col_offsets[col_index +1] - this->col_offsets[col_index]
+	                      + ++this->pending_cols_degree[col_index];
+
+	rows_max_degree = std::max(rows_max_degree, row_degree);
+	cols_max_degree = std::max(cols_max_degree, col_degree);
 
 	this->n_connections++;
 }
@@ -152,9 +245,12 @@ Sparse_matrix Sparse_matrix
 void Sparse_matrix
 ::self_transpose()
 {
+	this->check_compressed();
+
 	std::swap(this->n_rows,          this->n_cols         );
 	std::swap(this->rows_max_degree, this->cols_max_degree);
-	std::swap(this->row_to_cols,     this->col_to_rows    );
+	std::swap(this->row_offsets,     this->col_offsets    );
+	std::swap(this->row_indexes,     this->col_indexes    );
 }
 
 float Sparse_matrix
@@ -173,20 +269,87 @@ void Sparse_matrix
 		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
 	}
 
+	this->check_compressed();
+
+	const auto &offsets = this->col_offsets;
+	const auto degree = [&offsets](const unsigned c) { return offsets[c +1] - offsets[c]; };
+
+	// the permutation is sorted with the same algorithm as the columns themselves were before (same ties order)
+	std::vector<unsigned> old_cols(this->n_cols);
+	std::iota(old_cols.begin(), old_cols.end(), 0);
 	if (order == "ASC")
+		std::sort(old_cols.begin(), old_cols.end(),
+		          [&degree](const unsigned c1, const unsigned c2) { return degree(c1) < degree(c2); });
+	else // order == "DSC"
+		std::sort(old_cols.begin(), old_cols.end(),
+		          [&degree](const unsigned c1, const unsigned c2) { return degree(c1) > degree(c2); });
+
+	std::vector<unsigned> new_col_offsets(this->n_cols +1, 0);
+	std::vector<unsigned> new_col_indexes(this->n_connections);
+	for (unsigned c = 0; c < this->n_cols; c++)
 	{
-		std::sort(this->col_to_rows.begin(), this->col_to_rows.end(), 
-		          [](const std::vector<unsigned> &i1, const  std::vector<unsigned> &i2) { return i1.size() < i2.size(); });
+		new_col_offsets[c +1] = new_col_offsets[c] + degree(old_cols[c]);
+		std::copy(this->col_indexes.begin() + this->col_offsets[old_cols[c]   ],
+		          this->col_indexes.begin() + this->col_offsets[old_cols[c] +1],
+		          new_col_indexes.begin() + new_col_offsets[c]);
 	}
-	else // order == "DSC"
+	this->col_offsets = std::move(new_col_offsets);
+	this->col_indexes = std::move(new_col_indexes);
+
+	// the degree of the rows does not change, each row now lists its columns in ascending order
+	std::vector<unsigned> cursor(this->row_offsets.begin(), this->row_offsets.end() -1);
+	for (unsigned c = 0; c < this->n_cols; c++)
+		for (auto r = this->col_offsets[c]; r < this->col_offsets[c +1]; r++)
+			this->row_indexes[cursor[this->col_indexes[r]]++] = c;
+}
+
+/*
+ * Merge the pending connections of one direction in its compressed arrays ('first' is the row index in the pending
+ * pairs when 'by_row' and the column index otherwise).
+ */
+static void merge_pending(std::vector<unsigned> &offsets, std::vector<unsigned> &indexes,
+                          const std::vector<unsigned> &pending_degree,
+                          const std::vector<std::pair<unsigned,unsigned>> &pending, const bool by_row)
+{
+	const auto n = offsets.size() -1;
+
+	std::vector<unsigned> new_offsets(n +1, 0);
+	for (size_t i = 0; i < n; i++)
+		new_offsets[i +1] = new_offsets[i] + (offsets[i +1] - offsets[i]) + pending_degree[i];
+
+	std::vector<unsigned> new_indexes(new_offsets[n]);
+	std::vector<unsigned> cursor(n);
+	for (size_t i = 0; i < n; i++)
 	{
-		std::sort(this->col_to_rows.begin(), this->col_to_rows.end(), 
-		          [](const  std::vector<unsigned> &i1, const std::vector<unsigned> &i2) { return i1.size() > i2.size(); });
+		std::copy(indexes.begin() + offsets[i], indexes.begin() + offsets[i +1], new_indexes.begin() + new_offsets[i]);
+		cursor[i] = new_offsets[i] + (offsets[i +1] - offsets[i]);
 	}
 
-	for (auto &r : this->row_to_cols)
-		r.clear();
-	for (size_t i = 0; i < this->col_to_rows.size(); i++)
-		for (size_t j = 0; j < this->col_to_rows[i].size(); j++)
-			this->row_to_cols[this->col_to_rows[i][j]].push_back(i);
-}
\ No newline at end of file
+	for (const auto &p : pending)
+		if (by_row) new_indexes[cursor[p.first ]++] = p.second;
+		else        new_indexes[cursor[p.second]++] = p.first;
+
+	offsets = std::move(new_offsets);
+	indexes = std::move(new_indexes);
+}
+
+void Sparse_matrix
+::compress() const
+{
+	static std::mutex mutex_compress;
+	std::lock_guard<std::mutex> lock(mutex_compress);
+
+	if (this->compressed.load(std::memory_order_relaxed))
+		return;
+
+	merge_pending(this->row_offsets, this->row_indexes, this->pending_rows_degree, this->pending, true );
+	merge_pending(this->col_offsets, this->col_indexes, this->pending_cols_degree, this->pending, false);
+
+	std::vector<std::pair<unsigned,unsigned>>().swap(this->pending);
+	std::vector<unsigned>().swap(this->pending_next       );
+	std::vector<unsigned>().swap(this->pending_rows_head  );
+	std::vector<unsigned>().swap(this->pending_rows_degree);
+	std::vector<unsigned>().swap(this->pending_cols_degree);
+
+	this->compressed.store(true, std::memory_order_release);
+}
@@ -3,13 +3,121 @@
 
 #include <vector>
 #include <string>
+#include <atomic>
+#include <algorithm>
+#include <utility>
+#include <cstddef>
 
 namespace aff3ct
 {
 namespace tools
 {
+/*
+ * Sparse binary matrix stored in the compressed sparse row (CSR) and compressed sparse column (CSC) formats: for each
+ * direction a single offsets array and a single indexes array (the columns of the row 'i' are in
+ * row_indexes[row_offsets[i]] to row_indexes[row_offsets[i +1] -1]).
+ * The connections added by 'add_connection' are pending until the next read access, then they are merged in the
+ * compressed arrays (after the already compressed connections of the same row/column, in the insertion order). The
+ * merge is protected by a lock so a matrix can be read concurrently by several threads.
+ */
 class Sparse_matrix
 {
+public:
+	/*
+	 * Read-only view on the indexes of a row (or of a column) of the matrix, it behaves like a constant
+	 * std::vector<unsigned> and it remains valid as long as the matrix is not modified.
+	 */
+	class Indexes
+	{
+	private:
+		const unsigned *first;
+		const unsigned *last;
+
+	public:
+		Indexes(const unsigned *first, const unsigned *last) : first(first), last(last) {}
+
+		inline const unsigned* begin() const { return first;                  }
+		inline const unsigned* end  () const { return last;                   }
+		inline const unsigned* data () const { return first;                  }
+		inline size_t          size () const { return (size_t)(last - first); }
+		inline bool            empty() const { return first == last;          }
+		inline unsigned        front() const { return *first;                 }
+		inline unsigned        back () const { return *(last -1);             }
+
+		inline unsigned operator[](const size_t i) const { return first[i]; }
+
+		operator std::vector<unsigned>() const { return std::vector<unsigned>(first, last); }
+
+		inline bool operator==(const Indexes &other) const
+		{
+			return this->size() == other.size() && std::equal(first, last, other.first);
+		}
+
+		inline bool operator!=(const Indexes &other) const { return !(*this == other); }
+	};
+
+	/*
+	 * Read-only view on all the rows (or all the columns) of the matrix, it behaves like a constant
+	 * std::vector<std::vector<unsigned>>.
+	 */
+	class Adjacency
+	{
+	private:
+		const unsigned *offsets;
+		const unsigned *indexes;
+		size_t          n;
+
+	public:
+		// the dereferenced value is stored in the iterator so 'for (auto &r : H.get_row_to_cols())' works as before
+		class iterator
+		{
+		private:
+			const unsigned *offsets;
+			const unsigned *indexes;
+			size_t          i;
+			mutable Indexes cur;
+
+		public:
+			iterator(const unsigned *offsets, const unsigned *indexes, const size_t i)
+			: offsets(offsets), indexes(indexes), i(i), cur(nullptr, nullptr) {}
+
+			inline const Indexes& operator*() const
+			{
+				cur = Indexes(indexes + offsets[i], indexes + offsets[i +1]);
+				return cur;
+			}
+
+			inline iterator& operator++(                   )       { i++; return *this; }
+			inline bool      operator==(const iterator &it) const { return i == it.i;  }
+			inline bool      operator!=(const iterator &it) const { return i != it.i;  }
+		};
+
+		Adjacency(const unsigned *offsets, const unsigned *indexes, const size_t n)
+		: offsets(offsets), indexes(indexes), n(n) {}
+
+		inline size_t   size () const { return n;                             }
+		inline bool     empty() const { return n == 0;                        }
+		inline iterator begin() const { return iterator(offsets, indexes, 0); }
+		inline iterator end  () const { return iterator(offsets, indexes, n); }
+
+		inline Indexes operator[](const size_t i) const
+		{
+			return Indexes(indexes + offsets[i], indexes + offsets[i +1]);
+		}
+
+		inline bool operator==(const Adjacency &other) const
+		{
+			if (n != other.n)
+				return false;
+			for (size_t i = 0; i < n; i++)
+				if ((*this)[i] != other[i])
+					return false;
+			return true;
+		}
+
+		inline bool operator!=(const Adjacency &other) const { return !(*this == other); }
+	};
+
 private:
 	unsigned n_rows;
 	unsigned n_cols;
@@ -17,28 +125,51 @@ private:
 	unsigned cols_max_degree;
 	unsigned n_connections;
 
-	std::vector<std::vector<unsigned>> row_to_cols;
-	std::vector<std::vector<unsigned>> col_to_rows;
+	// the compression is done on the first read access: these members are updated by the 'const' accessors
+	mutable std::vector<unsigned> row_offsets; // size n_rows +1
+	mutable std::vector<unsigned> row_indexes; // size n_connections (once compressed)
+	mutable std::vector<unsigned> col_offsets; // size n_cols +1
+	mutable std::vector<unsigned> col_indexes; // size n_connections (once compressed)
+
+	// connections added since the last compression (emptied by 'compress')
+	mutable std::vector<std::pair<unsigned,unsigned>> pending;             // (row, col) in the insertion order
+	mutable std::vector<unsigned>                     pending_next;        // next pending connection of the same row
+	mutable std::vector<unsigned>                     pending_rows_head;   // first pending connection of each row
+	mutable std::vector<unsigned>                     pending_rows_degree;
+	mutable std::vector<unsigned>                     pending_cols_degree;
+
+	mutable std::atomic<bool> compressed;
 
 public:
 	Sparse_matrix(const unsigned n_rows = 0, const unsigned n_cols = 1);
+	Sparse_matrix(const Sparse_matrix &other);
+	Sparse_matrix(Sparse_matrix &&other);
 	virtual ~Sparse_matrix();
 
+	Sparse_matrix& operator=(const Sparse_matrix &other);
+	Sparse_matrix& operator=(Sparse_matrix &&other);
+
 	unsigned get_n_rows         () const;
 	unsigned get_n_cols         () const;
 	unsigned get_rows_max_degree() const;
 	unsigned get_cols_max_degree() const;
 	unsigned get_n_connections  () const;
 
-	const std::vector<unsigned>& get_cols_from_row(const size_t row_index) const;
-	const std::vector<unsigned>& get_rows_from_col(const size_t col_index) const;
+	inline Indexes get_cols_from_row(const size_t row_index) const;
+	inline Indexes get_rows_from_col(const size_t col_index) const;
 
-	const std::vector<unsigned>& operator[](const size_t col_index) const;
+	inline Indexes operator[](const size_t col_index) const;
 
 	bool at(const size_t row_index, const size_t col_index) const;
 
-	const std::vector<std::vector<unsigned int>>& get_row_to_cols() const;
-	const std::vector<std::vector<unsigned int>>& get_col_to_rows() const;
+	inline Adjacency get_row_to_cols() const;
+	inline Adjacency get_col_to_rows() const;
+
+	/*
+	 * Return true if the two matrices have the same dimensions and the same connections in the same order
+	 */
+	bool operator==(const Sparse_matrix &other) const;
+	bool operator!=(const Sparse_matrix &other) const;
 
 	void add_connection(const size_t row_index, const size_t col_index);
 
@@ -62,8 +193,15 @@ public:
 	 * The "order" parameter can be "ASC" for ascending or "DSC" for descending
 	 */
 	void sort_cols_per_density(std::string order = "DSC");
+
+private:
+	inline void check_compressed() const;
+	void compress() const;
+	void copy(const Sparse_matrix &other);
 };
 }
 }
 
+#include "Sparse_matrix.hxx"
+
 #endif /* SPARSE_MATRIX_HPP_ */
@@ -0,0 +1,50 @@
+#include "Sparse_matrix.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+inline void Sparse_matrix
+::check_compressed() const
+{
+	if (!this->compressed.load(std::memory_order_acquire))
+		this->compress();
+}
+
+inline Sparse_matrix::Indexes Sparse_matrix
+::get_cols_from_row(const size_t row_index) const
+{
+	this->check_compressed();
+	return Indexes(this->row_indexes.data() + this->row_offsets[row_index   ],
+	               this->row_indexes.data() + this->row_offsets[row_index +1]);
+}
+
+inline Sparse_matrix::Indexes Sparse_matrix
+::get_rows_from_col(const size_t col_index) const
+{
+	this->check_compressed();
+	return Indexes(this->col_indexes.data() + this->col_offsets[col_index   ],
+	               this->col_indexes.data() + this->col_offsets[col_index +1]);
+}
+
+inline Sparse_matrix::Indexes Sparse_matrix
+::operator[](const size_t col_index) const
+{
+	return this->get_rows_from_col(col_index);
+}
+
+inline Sparse_matrix::Adjacency Sparse_matrix
+::get_row_to_cols() const
+{
+	this->check_compressed();
+	return Adjacency(this->row_offsets.data(), this->row_indexes.data(), this->n_rows);
+}
+
+inline Sparse_matrix::Adjacency Sparse_matrix
+::get_col_to_rows() const
+{
+	this->check_compressed();
+	return Adjacency(this->col_offsets.data(), this->col_indexes.data(), this->n_cols);
+}
+}
+}
@@ -0,0 +1,49 @@
+#include <sstream>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "LDPC_BP_flooding_tables.hpp"
+
+using namespace aff3ct::tools;
+
+LDPC_BP_flooding_tables
+::LDPC_BP_flooding_tables(const Sparse_matrix &H)
+: n_variables_per_parity (H.get_n_cols()       ),
+  n_parities_per_variable(H.get_n_rows()       ),
+  first_branch           (H.get_n_rows(), 0    ),
+  transpose              (H.get_n_connections())
+{
+	const auto &CN_to_VN = H.get_col_to_rows();
+	const auto &VN_to_CN = H.get_row_to_cols();
+
+	for (auto i = 0; i < (int)H.get_n_cols(); i++)
+		n_variables_per_parity[i] = (unsigned)CN_to_VN[i].size();
+
+	for (auto i = 0; i < (int)H.get_n_rows(); i++)
+		n_parities_per_variable[i] = (unsigned)VN_to_CN[i].size();
+
+	for (auto i = 1; i < (int)H.get_n_rows(); i++)
+		first_branch[i] = first_branch[i -1] + n_parities_per_variable[i -1];
+
+	std::vector<unsigned> connections(H.get_n_rows(), 0);
+
+	auto k = 0;
+	for (auto i = 0; i < (int)CN_to_VN.size(); i++)
+	{
+		for (auto j = 0; j < (int)CN_to_VN[i].size(); j++)
+		{
+			const auto id_V = CN_to_VN[i][j];
+
+			if (connections[id_V] >= n_parities_per_variable[id_V])
+			{
+				std::stringstream message;
+				message << "'connections[id_V]' has to be smaller than 'VN_to_CN[id_V].size()' ('id_V' = "
+				        << id_V << ", 'connections[id_V]' = " << connections[id_V] << ", 'VN_to_CN[id_V].size()' = "
+				        << VN_to_CN[id_V].size() << ").";
+				throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+			}
+
+			transpose[k++] = first_branch[id_V] + connections[id_V]++;
+		}
+	}
+}
@@ -0,0 +1,31 @@
+#ifndef LDPC_BP_FLOODING_TABLES_HPP_
+#define LDPC_BP_FLOODING_TABLES_HPP_
+
+#include <vector>
+
+#include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*
+ * Read-only description of the bi-partite graph of H used by the flooding BP decoders. It only depends on H: the
+ * codecs build it once and share it between the decoders of all the simulation threads.
+ */
+struct LDPC_BP_flooding_tables
+{
+public:
+	std::vector<unsigned> n_variables_per_parity;  // degree of each check node
+	std::vector<unsigned> n_parities_per_variable; // degree of each variable node
+	std::vector<unsigned> first_branch;            // position of the first branch of each variable node in the VN
+	                                               // ordered arrays (prefix sum of the VN degrees)
+	std::vector<unsigned> transpose;               // position in the VN ordered arrays of each branch of the CN
+	                                               // ordered arrays
+
+	explicit LDPC_BP_flooding_tables(const Sparse_matrix &H);
+};
+}
+}
+
+#endif /* LDPC_BP_FLOODING_TABLES_HPP_ */
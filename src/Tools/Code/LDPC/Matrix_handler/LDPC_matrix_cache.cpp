@@ -0,0 +1,463 @@
+#include <dirent.h>
+
+#include <map>
+#include <mutex>
+#include <random>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <iterator>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "LDPC_matrix_cache.hpp"
+
+using namespace aff3ct::tools;
+
+static const char     cache_magic[8] = {'A','F','F','3','C','T','L','C'};
+static const uint32_t cache_version  = 1;
+static const uint32_t cache_kind_G     = 0;
+static const uint32_t cache_kind_invH2 = 1;
+
+template <typename T>
+static inline void write_array(std::ofstream& file, const T* data, const size_t n_elmts)
+{
+	file.write(reinterpret_cast<const char*>(data), n_elmts * sizeof(T));
+}
+
+template <typename T>
+static inline bool read_array(std::ifstream& file, T* data, const size_t n_elmts)
+{
+	file.read(reinterpret_cast<char*>(data), n_elmts * sizeof(T));
+	return file.good();
+}
+
+// the header is 32 bytes long: magic (8), version (4), kind (4), key (8), n_rows (4), n_cols (4)
+static void write_header(std::ofstream& file, const uint32_t kind, const uint64_t key, const uint32_t n_rows,
+                         const uint32_t n_cols)
+{
+	write_array(file, cache_magic, 8);
+	write_array(file, &cache_version, 1);
+	write_array(file, &kind,          1);
+	write_array(file, &key,           1);
+	write_array(file, &n_rows,        1);
+	write_array(file, &n_cols,        1);
+}
+
+static bool read_header(std::ifstream& file, const uint32_t kind, const uint64_t key, uint32_t& n_rows,
+                        uint32_t& n_cols)
+{
+	char     magic[8];
+	uint32_t f_version, f_kind;
+	uint64_t f_key;
+
+	return read_array(file, magic,      8) && std::equal(magic, magic + 8, cache_magic) &&
+	       read_array(file, &f_version, 1) && f_version == cache_version                &&
+	       read_array(file, &f_kind,    1) && f_kind    == kind                         &&
+	       read_array(file, &f_key,     1) && f_key     == key                          &&
+	       read_array(file, &n_rows,    1) &&
+	       read_array(file, &n_cols,    1);
+}
+
+// number of bytes between the current position and the end of the file
+static uint64_t remaining_bytes(std::ifstream& file)
+{
+	const auto cur = file.tellg();
+	file.seekg(0, std::ios::end);
+	const auto end = file.tellg();
+	file.seekg(cur);
+
+	return (cur < 0 || end < cur) ? 0 : (uint64_t)(end - cur);
+}
+
+// true if G is a systematic generator matrix of H: the rows of the information bits make an identity and H.G^T = 0
+// (a valid cache file with the same hash than H but computed from an other matrix is rejected)
+static bool is_generator(const Sparse_matrix& H, const Sparse_matrix& G, const std::vector<unsigned>& info_bits_pos)
+{
+	const bool transposed = H.get_n_rows() > H.get_n_cols();
+	const auto n_CN = transposed ? H.get_n_cols() : H.get_n_rows();
+	const auto n_VN = transposed ? H.get_n_rows() : H.get_n_cols();
+	const auto K    = G.get_n_cols();
+
+	if (G.get_n_rows() != n_VN || info_bits_pos.size() != K)
+		return false;
+
+	for (unsigned k = 0; k < K; k++)
+	{
+		const auto &cols = G.get_cols_from_row(info_bits_pos[k]);
+		if (cols.size() != 1 || cols[0] != k)
+			return false;
+	}
+
+	// each check node XORs the rows of G of its variable nodes (bit-packed), the result has to be null
+	const auto n_words = (K + 63) / 64;
+	std::vector<uint64_t> parity(n_words);
+	for (unsigned i = 0; i < n_CN; i++)
+	{
+		std::fill(parity.begin(), parity.end(), 0);
+		for (auto v : transposed ? H.get_rows_from_col(i) : H.get_cols_from_row(i))
+			for (auto k : G.get_cols_from_row(v))
+				parity[k / 64] ^= (uint64_t)1 << (k % 64);
+
+		if (std::any_of(parity.begin(), parity.end(), [](const uint64_t w) { return w != 0; }))
+			return false;
+	}
+
+	return true;
+}
+
+// the file is written under a temporary name and renamed when complete: the other processes see the whole file or
+// nothing
+template <class W>
+static void write_file(const std::string& filename, W write)
+{
+	std::random_device rd;
+	std::stringstream tmp_filename;
+	tmp_filename << filename << ".tmp" << std::hex << rd();
+
+	std::ofstream file(tmp_filename.str(), std::ios::out | std::ios::binary | std::ios::trunc);
+	if (!file.is_open())
+	{
+		std::stringstream message;
+		message << "Can't write the '" << tmp_filename.str() << "' file.";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	write(file);
+	file.close();
+
+	if (!file || std::rename(tmp_filename.str().c_str(), filename.c_str()) != 0)
+	{
+		std::remove(tmp_filename.str().c_str());
+
+		// an other process may have written the same file at the same time
+		if (file && std::ifstream(filename).is_open())
+			return;
+
+		std::stringstream message;
+		message << "Can't write the '" << filename << "' file.";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+uint64_t LDPC_matrix_cache
+::hash(const Sparse_matrix& H)
+{
+	// FNV-1a on the sorted connections of the check nodes (the smallest dimension of H)
+	const bool transposed = H.get_n_rows() > H.get_n_cols();
+	const auto n_CN = transposed ? H.get_n_cols() : H.get_n_rows();
+	const auto n_VN = transposed ? H.get_n_rows() : H.get_n_cols();
+
+	uint64_t key = 14695981039346656037ull;
+	auto add = [&key](const uint32_t v)
+	{
+		for (auto b = 0; b < 4; b++)
+		{
+			key ^= (v >> (8 * b)) & 0xFF;
+			key *= 1099511628211ull;
+		}
+	};
+
+	add(n_CN);
+	add(n_VN);
+
+	std::vector<unsigned> VNs;
+	for (unsigned i = 0; i < n_CN; i++)
+	{
+		const auto cols = transposed ? H.get_rows_from_col(i) : H.get_cols_from_row(i);
+		VNs.assign(cols.begin(), cols.end());
+		std::sort(VNs.begin(), VNs.end());
+
+		add((uint32_t)VNs.size());
+		for (auto v : VNs)
+			add(v);
+	}
+
+	return key;
+}
+
+std::string LDPC_matrix_cache
+::get_filename(const std::string& cache_path, const uint64_t key, const std::string& ext)
+{
+	DIR *dp;
+	if ((dp = opendir(cache_path.c_str())) == nullptr)
+	{
+		std::stringstream message;
+		message << "The following directory does not exist: '" + cache_path + "'.";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+	closedir(dp);
+
+	std::stringstream filename;
+	filename << cache_path << "/" << std::hex << std::setw(16) << std::setfill('0') << key << "." << ext;
+
+	return filename.str();
+}
+
+Sparse_matrix LDPC_matrix_cache
+::transform_H_to_G(const Sparse_matrix& H, std::vector<unsigned>& info_bits_pos, const std::string& cache_path)
+{
+	if (cache_path.empty())
+		return LDPC_matrix_handler::transform_H_to_G(H, info_bits_pos);
+
+	const auto key      = LDPC_matrix_cache::hash(H);
+	const auto filename = LDPC_matrix_cache::get_filename(cache_path, key, "G");
+
+	// the threads of a simulation wait for the first one instead of running the same elimination
+	static std::mutex mutex_cache;
+	std::lock_guard<std::mutex> lock(mutex_cache);
+
+	Sparse_matrix G;
+	if (!LDPC_matrix_cache::read_G(filename, key, G, info_bits_pos) || !is_generator(H, G, info_bits_pos))
+	{
+		G = LDPC_matrix_handler::transform_H_to_G(H, info_bits_pos);
+		LDPC_matrix_cache::write_G(filename, key, G, info_bits_pos);
+	}
+
+	return G;
+}
+
+LDPC_matrix_handler::Packed_matrix LDPC_matrix_cache
+::invert_H2(const Sparse_matrix& H, const std::string& cache_path)
+{
+	if (cache_path.empty())
+		return LDPC_matrix_handler::invert_H2(H);
+
+	const auto key      = LDPC_matrix_cache::hash(H);
+	const auto filename = LDPC_matrix_cache::get_filename(cache_path, key, "invH2");
+
+	static std::mutex mutex_cache;
+	std::lock_guard<std::mutex> lock(mutex_cache);
+
+	LDPC_matrix_handler::Packed_matrix invH2;
+	if (!LDPC_matrix_cache::read_invH2(filename, key, invH2))
+	{
+		invH2 = LDPC_matrix_handler::invert_H2(H);
+		LDPC_matrix_cache::write_invH2(filename, key, invH2);
+	}
+
+	return invH2;
+}
+
+// remove the entries of an in-memory sharing map whose object has been released by all its users
+template <class M, class E>
+static void prune(M& shared, E expired)
+{
+	for (auto it = shared.begin(); it != shared.end();)
+		it = expired(it->second) ? shared.erase(it) : std::next(it);
+}
+
+std::shared_ptr<const Sparse_matrix> LDPC_matrix_cache
+::share(const Sparse_matrix& H)
+{
+	// the key does not depend on the order of the connections but the decoders do: the shared matrix has to be equal
+	const auto key = std::make_pair(LDPC_matrix_cache::hash(H), H.get_n_rows());
+
+	static std::mutex mutex_share;
+	static std::map<std::pair<uint64_t,unsigned>, std::weak_ptr<const Sparse_matrix>> shared;
+	std::lock_guard<std::mutex> lock(mutex_share);
+
+	prune(shared, [](const std::weak_ptr<const Sparse_matrix>& w) { return w.expired(); });
+
+	auto ptr = shared[key].lock();
+	if (ptr == nullptr || *ptr != H)
+	{
+		ptr = std::make_shared<const Sparse_matrix>(H);
+		shared[key] = ptr;
+	}
+
+	return ptr;
+}
+
+std::shared_ptr<const Sparse_matrix> LDPC_matrix_cache
+::get_G(const Sparse_matrix& H, std::vector<unsigned>& info_bits_pos, const std::string& cache_path)
+{
+	const auto key = LDPC_matrix_cache::hash(H);
+
+	// the entry keeps the H it has been computed from: two matrices with the same hash are not mixed up
+	struct entry
+	{
+		std::shared_ptr<const Sparse_matrix> H;
+		std::weak_ptr<const Sparse_matrix> G;
+		std::vector<unsigned> info_bits_pos;
+	};
+
+	static std::mutex mutex_share;
+	static std::map<uint64_t, entry> shared;
+	std::lock_guard<std::mutex> lock(mutex_share);
+
+	prune(shared, [](const entry& e) { return e.G.expired(); });
+
+	auto &e = shared[key];
+	auto ptr = e.G.lock();
+	if (ptr == nullptr || *e.H != H)
+	{
+		e.H = LDPC_matrix_cache::share(H);
+		ptr = std::make_shared<const Sparse_matrix>(LDPC_matrix_cache::transform_H_to_G(H, e.info_bits_pos, cache_path));
+		e.G = ptr;
+	}
+
+	info_bits_pos = e.info_bits_pos;
+	return ptr;
+}
+
+std::shared_ptr<const LDPC_matrix_handler::Packed_matrix> LDPC_matrix_cache
+::get_invH2(const Sparse_matrix& H, const std::string& cache_path)
+{
+	const auto key = LDPC_matrix_cache::hash(H);
+
+	struct entry
+	{
+		std::shared_ptr<const Sparse_matrix> H;
+		std::weak_ptr<const LDPC_matrix_handler::Packed_matrix> invH2;
+	};
+
+	static std::mutex mutex_share;
+	static std::map<uint64_t, entry> shared;
+	std::lock_guard<std::mutex> lock(mutex_share);
+
+	prune(shared, [](const entry& e) { return e.invH2.expired(); });
+
+	auto &e = shared[key];
+	auto ptr = e.invH2.lock();
+	if (ptr == nullptr || *e.H != H)
+	{
+		e.H = LDPC_matrix_cache::share(H);
+		ptr = std::make_shared<const LDPC_matrix_handler::Packed_matrix>(LDPC_matrix_cache::invert_H2(H, cache_path));
+		e.invH2 = ptr;
+	}
+
+	return ptr;
+}
+
+bool LDPC_matrix_cache
+::read_G(const std::string& filename, const uint64_t key, Sparse_matrix& G, std::vector<unsigned>& info_bits_pos)
+{
+	std::ifstream file(filename, std::ios::in | std::ios::binary);
+	if (!file.is_open())
+		return false;
+
+	uint32_t n_rows, n_cols, n_connections, n_info;
+	if (!read_header(file, cache_kind_G, key, n_rows, n_cols) ||
+	    !read_array(file, &n_connections, 1) ||
+	    !read_array(file, &n_info,        1))
+		return false;
+
+	// the sizes are checked against the file size before any allocation: a corrupted header can't trigger a huge
+	// allocation or an overflow of 'n_rows +1'
+	const uint64_t n_elmts = (uint64_t)n_rows +1 + (uint64_t)n_connections + (uint64_t)n_info;
+	if (n_rows == 0 || n_cols == 0 || n_info > n_cols || n_connections > (uint64_t)n_rows * n_cols ||
+	    remaining_bytes(file) != n_elmts * sizeof(uint32_t))
+		return false;
+
+	std::vector<uint32_t> offsets((size_t)n_rows +1), indices(n_connections), info(n_info);
+	if (!read_array(file, offsets.data(), offsets.size()) ||
+	    !read_array(file, indices.data(), indices.size()) ||
+	    !read_array(file, info   .data(), info   .size()))
+		return false;
+
+	// reject the truncated or inconsistent files
+	if (offsets.front() != 0 || offsets.back() != n_connections)
+		return false;
+	for (unsigned i = 0; i < n_rows; i++)
+		if (offsets[i] > offsets[i +1])
+			return false;
+	// the columns of a row are distinct ('row_of_col[c]' is the last row connected to the column 'c')
+	std::vector<uint32_t> row_of_col(n_cols, n_rows);
+	for (unsigned i = 0; i < n_rows; i++)
+		for (auto k = offsets[i]; k < offsets[i +1]; k++)
+		{
+			const auto c = indices[k];
+			if (c >= n_cols || row_of_col[c] == i)
+				return false;
+			row_of_col[c] = i;
+		}
+
+	// the information bits positions are distinct rows of G
+	std::vector<bool> is_info(n_rows, false);
+	for (auto p : info)
+	{
+		if (p >= n_rows || is_info[p])
+			return false;
+		is_info[p] = true;
+	}
+
+	G = Sparse_matrix(n_rows, n_cols);
+	for (unsigned i = 0; i < n_rows; i++)
+		for (auto k = offsets[i]; k < offsets[i +1]; k++)
+			G.add_connection(i, indices[k]);
+
+	info_bits_pos.assign(info.begin(), info.end());
+
+	return true;
+}
+
+void LDPC_matrix_cache
+::write_G(const std::string& filename, const uint64_t key, const Sparse_matrix& G,
+          const std::vector<unsigned>& info_bits_pos)
+{
+	const auto n_rows = G.get_n_rows();
+
+	std::vector<uint32_t> offsets(n_rows +1, 0), indices;
+	indices.reserve(G.get_n_connections());
+	for (unsigned i = 0; i < n_rows; i++)
+	{
+		const auto &cols = G.get_cols_from_row(i);
+		indices.insert(indices.end(), cols.begin(), cols.end());
+		offsets[i +1] = (uint32_t)indices.size();
+	}
+
+	const std::vector<uint32_t> info(info_bits_pos.begin(), info_bits_pos.end());
+	const auto n_connections = (uint32_t)indices.size();
+	const auto n_info        = (uint32_t)info.size();
+
+	write_file(filename, [&](std::ofstream& file)
+	{
+		write_header(file, cache_kind_G, key, n_rows, G.get_n_cols());
+		write_array(file, &n_connections, 1);
+		write_array(file, &n_info,        1);
+		write_array(file, offsets.data(), offsets.size());
+		write_array(file, indices.data(), indices.size());
+		write_array(file, info   .data(), info   .size());
+	});
+}
+
+bool LDPC_matrix_cache
+::read_invH2(const std::string& filename, const uint64_t key, LDPC_matrix_handler::Packed_matrix& invH2)
+{
+	std::ifstream file(filename, std::ios::in | std::ios::binary);
+	if (!file.is_open())
+		return false;
+
+	// n_rows = M, n_cols = number of 64-bit words per row
+	uint32_t M, n_words;
+	if (!read_header(file, cache_kind_invH2, key, M, n_words) || n_words != ((uint64_t)M + 63) / 64 ||
+	    remaining_bytes(file) != (uint64_t)M * n_words * sizeof(uint64_t))
+		return false;
+
+	invH2.resize(M);
+	for (auto &row : invH2)
+	{
+		row.resize(n_words);
+		if (!read_array(file, row.data(), n_words))
+			return false;
+	}
+
+	return true;
+}
+
+void LDPC_matrix_cache
+::write_invH2(const std::string& filename, const uint64_t key, const LDPC_matrix_handler::Packed_matrix& invH2)
+{
+	const auto M       = (uint32_t)invH2.size();
+	const auto n_words = (uint32_t)(M + 63) / 64;
+
+	write_file(filename, [&](std::ofstream& file)
+	{
+		write_header(file, cache_kind_invH2, key, M, n_words);
+		for (auto &row : invH2)
+			write_array(file, row.data(), n_words);
+	});
+}
@@ -0,0 +1,77 @@
+#ifndef LDPC_MATRIX_CACHE_HPP_
+#define LDPC_MATRIX_CACHE_HPP_
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+#include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
+
+#include "LDPC_matrix_handler.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*
+ * On-disk cache of the matrices derived from H by the Gaussian eliminations of LDPC_matrix_handler.
+ * The files are named after a hash of H and stored in a binary format made of a 32-byte header followed by plain
+ * arrays in the native byte order (each array starts on a multiple of its element size, so the files can be memory
+ * mapped):
+ *   - "<hash>.G"     : G in compressed sparse rows (uint32 offsets and indices) and the information bits positions,
+ *   - "<hash>.invH2" : the bit-packed rows of inv(H2) (uint64 words).
+ * The cache is shared between the processes: a file is written under a temporary name and renamed at the end.
+ * The matrices can also be shared in memory between the threads of a process (share, get_G and get_invH2).
+ */
+struct LDPC_matrix_cache
+{
+public:
+	/*
+	 * Return a hash of H, independent of the orientation of the matrix and of the order of its connections.
+	 */
+	static uint64_t hash(const Sparse_matrix& H);
+
+	/*
+	 * Same as LDPC_matrix_handler::transform_H_to_G but the result is read from the 'cache_path' directory when it
+	 * has already been computed (and written in it otherwise). An empty 'cache_path' disables the cache. The G read from
+	 * the cache is checked against H (systematic and H.G^T = 0), it is computed again when the check fails.
+	 */
+	static Sparse_matrix transform_H_to_G(const Sparse_matrix& H, std::vector<unsigned>& info_bits_pos,
+	                                      const std::string& cache_path);
+
+	/*
+	 * Same as LDPC_matrix_handler::invert_H2 with a cache in the 'cache_path' directory (disabled if empty).
+	 */
+	static LDPC_matrix_handler::Packed_matrix invert_H2(const Sparse_matrix& H, const std::string& cache_path);
+
+	/*
+	 * In-memory sharing: as long as a returned pointer is alive, the next calls with an equal matrix return the same
+	 * object. Each simulation thread builds its own modules from its own H, with these functions they all point to a
+	 * single read-only H, G or inv(H2). The matrices are looked up by hash and compared to H on a hit, the released
+	 * ones are removed from the lookup tables.
+	 */
+	static std::shared_ptr<const Sparse_matrix> share(const Sparse_matrix& H);
+
+	static std::shared_ptr<const Sparse_matrix> get_G(const Sparse_matrix& H, std::vector<unsigned>& info_bits_pos,
+	                                                  const std::string& cache_path);
+
+	static std::shared_ptr<const LDPC_matrix_handler::Packed_matrix> get_invH2(const Sparse_matrix& H,
+	                                                                           const std::string& cache_path);
+
+protected:
+	static std::string get_filename(const std::string& cache_path, const uint64_t key, const std::string& ext);
+
+	static bool read_G (const std::string& filename, const uint64_t key, Sparse_matrix& G,
+	                    std::vector<unsigned>& info_bits_pos);
+	static void write_G(const std::string& filename, const uint64_t key, const Sparse_matrix& G,
+	                    const std::vector<unsigned>& info_bits_pos);
+
+	static bool read_invH2 (const std::string& filename, const uint64_t key, LDPC_matrix_handler::Packed_matrix& invH2);
+	static void write_invH2(const std::string& filename, const uint64_t key,
+	                        const LDPC_matrix_handler::Packed_matrix& invH2);
+};
+}
+}
+
+#endif /* LDPC_MATRIX_CACHE_HPP_ */
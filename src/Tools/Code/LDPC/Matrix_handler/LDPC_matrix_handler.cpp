@@ -7,6 +7,81 @@
 
 using namespace aff3ct::tools;
 
+static inline unsigned n_words(const unsigned n_bits)
+{
+	return (n_bits + 63) / 64;
+}
+
+static inline bool get_bit(const uint64_t *row, const unsigned j)
+{
+	return (row[j / 64] >> (j % 64)) & 1;
+}
+
+static inline void set_bit(uint64_t *row, const unsigned j)
+{
+	row[j / 64] |= (uint64_t)1 << (j % 64);
+}
+
+static inline void flip_bit(uint64_t *row, const unsigned j)
+{
+	row[j / 64] ^= (uint64_t)1 << (j % 64);
+}
+
+// the 'n' (<= 32) consecutive bits from the column j
+static inline unsigned get_bits(const uint64_t *row, const unsigned j, const unsigned n)
+{
+	const auto w = j / 64;
+	const auto s = j % 64;
+
+	auto bits = row[w] >> s;
+	if (s + n > 64)
+		bits |= row[w +1] << (64 - s);
+
+	return (unsigned)(bits & (((uint64_t)1 << n) -1));
+}
+
+// dst ^= src, the loop on 64-bit words is vectorized by the compiler
+static inline void xor_row(const uint64_t *src, uint64_t *dst, const unsigned n_words)
+{
+	for (unsigned w = 0; w < n_words; w++)
+		dst[w] ^= src[w];
+}
+
+static inline unsigned trailing_zeros(uint64_t v)
+{
+#if defined(__GNUC__) || defined(__clang__) || defined(__llvm__)
+	return (unsigned)__builtin_ctzll(v);
+#else
+	unsigned n = 0;
+	while (!(v & 1)) { v >>= 1; n++; }
+	return n;
+#endif
+}
+
+// call 'f' on the columns in [from, to) where the row is set, in increasing order
+template <class F>
+static inline void for_each_bit(const uint64_t *row, const unsigned from, const unsigned to, F f)
+{
+	if (from >= to)
+		return;
+
+	for (auto w = from / 64; w <= (to -1) / 64; w++)
+	{
+		auto word = row[w];
+		if (w == from / 64)
+			word &= ~(uint64_t)0 << (from % 64);
+
+		while (word)
+		{
+			const auto j = w * 64 + trailing_zeros(word);
+			if (j >= to)
+				return;
+			f(j);
+			word &= word -1;
+		}
+	}
+}
+
 void LDPC_matrix_handler
 ::sparse_to_full(const Sparse_matrix& sparse, Full_matrix& full)
 {
@@ -34,47 +109,55 @@ Sparse_matrix LDPC_matrix_handler
 Sparse_matrix LDPC_matrix_handler
 ::transform_H_to_G(const Sparse_matrix& H, std::vector<unsigned>& info_bits_pos)
 {
-	LDPC_matrix_handler::Full_matrix mat;
-
-	if (H.get_n_rows() > H.get_n_cols())
-		LDPC_matrix_handler::sparse_to_full(H.transpose(), mat);
-	else
-		LDPC_matrix_handler::sparse_to_full(H, mat);
+	const bool transposed = H.get_n_rows() > H.get_n_cols();
+	const auto n_row = transposed ? H.get_n_cols() : H.get_n_rows();
+	const auto n_col = transposed ? H.get_n_rows() : H.get_n_cols();
 
-	LDPC_matrix_handler::transform_H_to_G(mat, info_bits_pos);
+	LDPC_matrix_handler::Packed_matrix mat(n_row, std::vector<uint64_t>(n_words(n_col), 0));
+	for (unsigned i = 0; i < n_row; i++)
+	{
+		const auto &cols = transposed ? H.get_rows_from_col(i) : H.get_cols_from_row(i);
+		for (auto c : cols)
+			set_bit(mat[i].data(), c);
+	}
 
-	return LDPC_matrix_handler::full_to_sparse(mat);
+	return LDPC_matrix_handler::transform_H_to_G(mat, n_col, info_bits_pos);
 }
 
-void LDPC_matrix_handler
-::transform_H_to_G(Full_matrix& mat, std::vector<unsigned>& info_bits_pos)
+Sparse_matrix LDPC_matrix_handler
+::transform_H_to_G(Packed_matrix& mat, const unsigned n_col, std::vector<unsigned>& info_bits_pos)
 {
-	unsigned n_row = (unsigned)mat.size();
-	unsigned n_col = (unsigned)mat.front().size();
-
-	if (n_row > n_col)
+	if (mat.size() > n_col)
 	{
 		std::stringstream message;
-		message << "'n_row' has to be smaller or equal to 'n_col' ('n_row' = " << n_row
+		message << "'n_row' has to be smaller or equal to 'n_col' ('n_row' = " << mat.size()
 		        << ", 'n_col' = " << n_col << ").";
 		throw length_error(__FILE__, __LINE__, __func__, message.str());
 	}
 
 	std::vector<unsigned> swapped_cols;
-	LDPC_matrix_handler::create_diagonal(mat, swapped_cols);
-	LDPC_matrix_handler::create_identity(mat);
-
-	for (unsigned i = 0; i < n_row; i++) // erase the just created identity in the left part of H
-		mat[i].erase( mat[i].begin(), mat[i].begin() + n_row );
+	LDPC_matrix_handler::forward_elimination(mat, n_col, &swapped_cols);
+	LDPC_matrix_handler::backward_elimination(mat);
 
-	// mat dimension is now n_col*n_row (above it was n_row*n_col)
-	mat.resize(n_col, std::vector<bool>(n_col - n_row, 0));
-	for (unsigned i = n_row; i < n_col; i++) // Add identity at the end
-		mat[i][i-n_row] = 1;
+	// the null rows have been removed by the forward elimination
+	const auto n_row = (unsigned)mat.size();
 
-	// Re-organization: get G
+	// G (transposed) is made of the right part of mat (without the identity of the left part) and of an identity at
+	// the end, then its rows are swapped back: 'src_rows[i]' is the row of this construction that becomes the row 'i'
+	std::vector<unsigned> src_rows(n_col);
+	std::iota(src_rows.begin(), src_rows.end(), 0);
 	for (unsigned l = (unsigned)(swapped_cols.size() / 2); l > 0; l--)
-		std::swap(mat[swapped_cols[l*2-2]], mat[swapped_cols[l*2-1]]);
+		std::swap(src_rows[swapped_cols[l*2-2]], src_rows[swapped_cols[l*2-1]]);
+
+	Sparse_matrix G(n_col, n_col - n_row);
+	for (unsigned i = 0; i < n_col; i++)
+	{
+		const auto r = src_rows[i];
+		if (r < n_row)
+			for_each_bit(mat[r].data(), n_row, n_col, [&](const unsigned j) { G.add_connection(i, j - n_row); });
+		else
+			G.add_connection(i, r - n_row);
+	}
 
 	// return info bits positions
 	info_bits_pos.resize(n_col - n_row);
@@ -86,6 +169,8 @@ void LDPC_matrix_handler
 		std::swap(bits_pos[swapped_cols[l*2-2]], bits_pos[swapped_cols[l*2-1]]);
 
 	std::copy(bits_pos.begin() + n_row, bits_pos.end(), info_bits_pos.begin());
+
+	return G;
 }
 
 void LDPC_matrix_handler
@@ -102,76 +187,213 @@ void LDPC_matrix_handler
 		throw length_error(__FILE__, __LINE__, __func__, message.str());
 	}
 
-	unsigned i = 0;
-	bool found = false;
+	auto packed = LDPC_matrix_handler::pack(mat);
+	LDPC_matrix_handler::forward_elimination(packed, n_col, &swapped_cols);
+	mat = LDPC_matrix_handler::unpack(packed, n_col);
+}
+
+void LDPC_matrix_handler
+::create_identity(Full_matrix& mat)
+{
+	unsigned n_row = (unsigned)mat.size();
+	unsigned n_col = (unsigned)mat.front().size();
+
+	if (n_row > n_col)
+	{
+		std::stringstream message;
+		message << "'n_row' has to be smaller or equal to 'n_col' ('n_row' = " << n_row
+		        << ", 'n_col' = " << n_col << ").";
+		throw length_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	auto packed = LDPC_matrix_handler::pack(mat);
+	LDPC_matrix_handler::backward_elimination(packed);
+	mat = LDPC_matrix_handler::unpack(packed, n_col);
+}
+
+LDPC_matrix_handler::Packed_matrix LDPC_matrix_handler
+::pack(const Full_matrix& full)
+{
+	const auto n_cols = full.empty() ? 0 : (unsigned)full.front().size();
+
+	Packed_matrix packed(full.size(), std::vector<uint64_t>(n_words(n_cols), 0));
+	for (unsigned i = 0; i < full.size(); i++)
+		for (unsigned j = 0; j < n_cols; j++)
+			if (full[i][j])
+				set_bit(packed[i].data(), j);
+
+	return packed;
+}
+
+LDPC_matrix_handler::Full_matrix LDPC_matrix_handler
+::unpack(const Packed_matrix& packed, const unsigned n_cols)
+{
+	Full_matrix full(packed.size(), std::vector<bool>(n_cols, 0));
+	for (unsigned i = 0; i < packed.size(); i++)
+		for_each_bit(packed[i].data(), 0, n_cols, [&](const unsigned j) { full[i][j] = 1; });
+
+	return full;
+}
+
+bool LDPC_matrix_handler
+::forward_elimination(Packed_matrix& mat, const unsigned n_col, std::vector<unsigned>* swapped_cols)
+{
+	auto n_row = (unsigned)mat.size();
+	if (n_row == 0)
+		return true;
+
+	const auto n_w = (unsigned)mat.front().size();
 
+	// number of pivots of the current block already applied on each row (the rows are reduced lazily by the pivots of
+	// the current block, only when they are examined to find a pivot)
+	std::vector<unsigned> n_applied(n_row, 0);
+	std::vector<uint64_t> piv(block_size * n_w), table(((size_t)1 << block_size) * n_w);
+
+	unsigned i = 0;
 	while (i < n_row)
 	{
-		if (mat[i][i])
-		{
-			for (unsigned j = i +1; j < n_row; j++)
- 				if( mat[j][i] )
-					std::transform(mat[j].begin(), mat[j].end(), mat[i].begin(), mat[j].begin(), std::not_equal_to<int8_t>());
-		}
-		else
+		const auto b = i; // first pivot of the block
+
+		while (i < n_row && i - b < block_size)
 		{
-			for (unsigned j = i +1; j < n_row; j++) // find an other row which is good
-				if (mat[j][i])
-				{
-					std::swap(mat[i], mat[j]);
-					i--;
-					found = true;
+			// find the first row (from the i-th one) with a one in the column i, as in create_diagonal
+			auto j = i;
+			for (; j < n_row; j++)
+			{
+				for (auto p = n_applied[j]; p < i - b; p++)
+					if (get_bit(mat[j].data(), b + p))
+						xor_row(mat[b + p].data(), mat[j].data(), n_w);
+				n_applied[j] = i - b;
+
+				if (get_bit(mat[j].data(), i))
 					break;
-				}
+			}
 
-			if (!found) // if does not fund
-				for (unsigned j = i +1; j < n_col; j++) // find an other column which is good
-					if (mat[i][j])
+			if (j < n_row)
+			{
+				std::swap(mat[i], mat[j]);
+				std::swap(n_applied[i], n_applied[j]);
+				i++;
+				continue;
+			}
+
+			if (swapped_cols == nullptr)
+				return false;
+
+			// find an other column which is good
+			auto c = n_col;
+			for_each_bit(mat[i].data(), i +1, n_col, [&](const unsigned k) { c = std::min(c, k); });
+
+			if (c < n_col)
+			{
+				swapped_cols->push_back(i);
+				swapped_cols->push_back(c);
+
+				for (unsigned l = 0; l < n_row; l++)
+				{
+					const auto bit_i = get_bit(mat[l].data(), i);
+					const auto bit_c = get_bit(mat[l].data(), c);
+					if (bit_i != bit_c)
 					{
-						swapped_cols.push_back(i);
-						swapped_cols.push_back(j);
-
-						// swap the columns
-						std::vector<int8_t> column_save(n_row);
-						for (unsigned l = 0; l < n_row; l++) column_save[l] = (mat[l][i]);
-						for (unsigned l = 0; l < n_row; l++) mat[l][i] = mat[l][j];
-						for (unsigned l = 0; l < n_row; l++) mat[l][j] = column_save[l];
-
-						i--;
-						found = true;
-						break;
+						flip_bit(mat[l].data(), i);
+						flip_bit(mat[l].data(), c);
 					}
-
-			if (!found) // if does not fund again this mean that the row is the null vector
+				}
+				i++;
+			}
+			else // the row is the null vector
 			{
-				mat.erase(mat.begin() +i);
-				i--;
+				mat      .erase(mat      .begin() + i);
+				n_applied.erase(n_applied.begin() + i);
 				n_row--;
 			}
-			found = false;
 		}
-		i++;
+
+		const auto n_piv = i - b;
+		if (n_piv == 0)
+			break;
+
+		// the pivot rows are null on the left of their block, the XORs can start at the word of the first pivot
+		const auto first = b / 64;
+		const auto width = n_w - first;
+
+		for (unsigned p = 0; p < n_piv; p++)
+			std::copy(mat[b + p].begin() + first, mat[b + p].end(), piv.begin() + p * width);
+		build_table(piv, n_piv, b - first * 64, width, table);
+
+		for (auto r = i; r < n_row; r++)
+		{
+			const auto idx = get_bits(mat[r].data(), b, n_piv);
+			if (idx)
+				xor_row(table.data() + idx * width, mat[r].data() + first, width);
+			n_applied[r] = 0;
+		}
 	}
+
+	return true;
 }
 
 void LDPC_matrix_handler
-::create_identity(Full_matrix& mat)
+::backward_elimination(Packed_matrix& mat)
 {
-	unsigned n_row = (unsigned)mat.size();
-	unsigned n_col = (unsigned)mat.front().size();
+	const auto n_row = (unsigned)mat.size();
+	if (n_row == 0)
+		return;
 
-	if (n_row > n_col)
+	const auto n_w = (unsigned)mat.front().size();
+
+	std::vector<uint64_t> piv(block_size * n_w), table(((size_t)1 << block_size) * n_w);
+
+	// blocks of pivots from the bottom to the top: the pivots of the block are upper triangular and their columns are
+	// already null in the rows below the block
+	auto e = n_row;
+	while (e > 0)
 	{
-		std::stringstream message;
-		message << "'n_row' has to be smaller or equal to 'n_col' ('n_row' = " << n_row
-		        << ", 'n_col' = " << n_col << ").";
-		throw length_error(__FILE__, __LINE__, __func__, message.str());
+		const auto b     = e > block_size ? e - block_size : 0;
+		const auto n_piv = e - b;
+		const auto first = b / 64;
+		const auto width = n_w - first;
+
+		for (unsigned p = 0; p < n_piv; p++)
+			std::copy(mat[b + p].begin() + first, mat[b + p].end(), piv.begin() + p * width);
+		build_table(piv, n_piv, b - first * 64, width, table);
+
+		// the pivots have been reduced between them by build_table
+		for (unsigned p = 0; p < n_piv; p++)
+			std::copy(piv.begin() + p * width, piv.begin() + (p +1) * width, mat[b + p].begin() + first);
+
+		for (unsigned r = 0; r < b; r++)
+		{
+			const auto idx = get_bits(mat[r].data(), b, n_piv);
+			if (idx)
+				xor_row(table.data() + idx * width, mat[r].data() + first, width);
+		}
+
+		e = b;
 	}
+}
 
-	for (unsigned i = n_row - 1 ; i > 0; i--)
-		for (unsigned j = i; j > 0; j--)
-			if (mat[j-1][i])
-				std::transform (mat[j-1].begin(), mat[j-1].end(), mat[i].begin(), mat[j-1].begin(), std::not_equal_to<int8_t>());
+void LDPC_matrix_handler
+::build_table(std::vector<uint64_t>& piv, const unsigned n_piv, const unsigned first, const unsigned width,
+              std::vector<uint64_t>& table)
+{
+	// the pivot 'p' is null in the columns of the pivots 0 to p-1: clear the columns of the next pivots
+	for (auto p = n_piv -1; p > 0; p--)
+		for (unsigned q = 0; q < p; q++)
+			if (get_bit(piv.data() + q * width, first + p))
+				xor_row(piv.data() + p * width, piv.data() + q * width, width);
+
+	// table[idx] is the XOR of the pivots whose bit is set in 'idx'
+	std::fill(table.begin(), table.begin() + width, 0);
+	for (unsigned p = 0; p < n_piv; p++)
+	{
+		const auto n = (size_t)1 << p;
+		for (size_t idx = 0; idx < n; idx++)
+		{
+			std::copy(table.begin() + idx * width, table.begin() + (idx +1) * width, table.begin() + (n + idx) * width);
+			xor_row(piv.data() + p * width, table.data() + (n + idx) * width, width);
+		}
+	}
 }
 
 float LDPC_matrix_handler
@@ -250,7 +472,7 @@ std::vector<unsigned> LDPC_matrix_handler
 	return itl_vec;
 }
 
-LDPC_matrix_handler::QCFull_matrix LDPC_matrix_handler
+LDPC_matrix_handler::Packed_matrix LDPC_matrix_handler
 ::invert_H2(const Sparse_matrix& _H)
 {
 	Sparse_matrix H;
@@ -263,93 +485,27 @@ LDPC_matrix_handler::QCFull_matrix LDPC_matrix_handler
 	unsigned N = H.get_n_cols();
 	unsigned K = N - M;
 
-	QCFull_matrix MatriceCalcul;
-	MatriceCalcul.clear();
-	MatriceCalcul.resize(M, mipp::vector<int8_t>(2 * M, 0));
-
-	//Copy H2 on left
-	for (unsigned i = 0; i < M; i++)
-		for (unsigned j = 0; j < H.get_cols_from_row(i).size(); j++)
-			if (H.get_cols_from_row(i)[j] >= K)
-				MatriceCalcul[i][H.get_cols_from_row(i)[j] - K] = 1;
-
-	//Create identity on right
+	// [H2 I] is reduced to [I inv(H2)]
+	Packed_matrix mat(M, std::vector<uint64_t>(n_words(2 * M), 0));
 	for (unsigned i = 0; i < M; i++)
-			MatriceCalcul[i][M + i] = 1;
-
-	//Pivot de Gauss (Forward)
-	for (unsigned indLgn = 0; indLgn < M; indLgn++)
 	{
-		if (MatriceCalcul[indLgn][indLgn] == 0)
-		{
-			unsigned indLgnSwap = 0;
-			for (unsigned indLgn2 = indLgn + 1; indLgn2 < M; indLgn2++)
-			{
-				if (MatriceCalcul[indLgn2][indLgn] != 0)
-				{
-					indLgnSwap = indLgn2;
-					break;
-				}
-			}
-			if (indLgnSwap == 0)
-			{
-				std::stringstream message;
-				message << "Matrix H2 (H = [H1 H2]) is not invertible";
-				throw runtime_error(__FILE__, __LINE__, __func__, message.str());
-			}
-			std::swap(MatriceCalcul[indLgn], MatriceCalcul[indLgnSwap]);
-		}
-
-		//XOR des lignes
-		for (unsigned indLgn2 = indLgn + 1; indLgn2 < M; indLgn2++)
-		{
-			if (MatriceCalcul[indLgn2][indLgn] != 0)
-			{
-				const auto loop_size1 = (unsigned)(2 * M / mipp::nElReg<int8_t>());
-				for (unsigned i = 0; i < loop_size1; i++)
-				{
-					const auto rLgn  = mipp::Reg<int8_t>(&MatriceCalcul[indLgn][i * mipp::nElReg<int8_t>()]);
-					const auto rLgn2 = mipp::Reg<int8_t>(&MatriceCalcul[indLgn2][i * mipp::nElReg<int8_t>()]);
-					auto rLgn3       = rLgn2 ^ rLgn;
-					rLgn3.store(&MatriceCalcul[indLgn2][i * mipp::nElReg<int8_t>()]);
-				}
-				for (unsigned i = loop_size1 * mipp::nElReg<int8_t>(); i < 2 * M; i++)
-					MatriceCalcul[indLgn2][i] = MatriceCalcul[indLgn2][i] ^ MatriceCalcul[indLgn][i];
-			}
-		}
+		for (auto c : H.get_cols_from_row(i))
+			if (c >= K)
+				set_bit(mat[i].data(), c - K);
+		set_bit(mat[i].data(), M + i);
 	}
 
-	//Pivot de Gauss (Backward)
-	for (unsigned indLgn = M - 1; indLgn > 0; indLgn--)
+	if (!LDPC_matrix_handler::forward_elimination(mat, M, nullptr))
 	{
-		//XOR des lignes
-		for (unsigned indLgn2 = indLgn - 1; indLgn2 > 0; indLgn2--)
-		{
-			if (MatriceCalcul[indLgn2][indLgn] != 0)
-			{
-				const auto loop_size1 = (unsigned)(2 * M / mipp::nElReg<int8_t>());
-				for (unsigned i = 0; i < loop_size1; i++)
-				{
-					const auto rLgn  = mipp::Reg<int8_t>(&MatriceCalcul[indLgn][i * mipp::nElReg<int8_t>()]);
-					const auto rLgn2 = mipp::Reg<int8_t>(&MatriceCalcul[indLgn2][i * mipp::nElReg<int8_t>()]);
-					auto rLgn3       = rLgn2 ^ rLgn;
-					rLgn3.store(&MatriceCalcul[indLgn2][i * mipp::nElReg<int8_t>()]);
-				}
-				for (unsigned i = loop_size1 * mipp::nElReg<int8_t>(); i < 2 * M; i++)
-					MatriceCalcul[indLgn2][i] = MatriceCalcul[indLgn2][i] ^ MatriceCalcul[indLgn][i];
-			}
-		}
+		std::stringstream message;
+		message << "Matrix H2 (H = [H1 H2]) is not invertible";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
 	}
+	LDPC_matrix_handler::backward_elimination(mat);
 
-	QCFull_matrix invH2;
-	invH2.clear();
-	invH2.resize(M, mipp::vector<int8_t>(M, 0));
-
+	Packed_matrix invH2(M, std::vector<uint64_t>(n_words(M), 0));
 	for (unsigned i = 0; i < M; i++)
-		for (unsigned j = 0; j < M; j++)
-			invH2[i][j] = MatriceCalcul[i][M + j];
-
-	MatriceCalcul.clear();
+		for_each_bit(mat[i].data(), M, 2 * M, [&](const unsigned j) { set_bit(invH2[i].data(), j - M); });
 
 	return invH2;
 }
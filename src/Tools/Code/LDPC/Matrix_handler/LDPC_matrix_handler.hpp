@@ -2,9 +2,9 @@
 #define LDPC_MATRIX_HANDLER_HPP_
 
 #include <vector>
+#include <cstdint>
 #include <algorithm>
 #include <numeric>
-#include <mipp.h>
 
 #include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
 
@@ -16,7 +16,12 @@ struct LDPC_matrix_handler
 {
 public:
 	using Full_matrix   = std::vector<std::vector<bool>>;
-	using QCFull_matrix = std::vector<mipp::vector<int8_t>>;
+
+	/*
+	 * bit-packed binary matrix: the column j of a row is the bit (j % 64) of its word (j / 64), the unused bits of the
+	 * last word are zeros
+	 */
+	using Packed_matrix = std::vector<std::vector<uint64_t>>;
 
 	/*
 	 * convert a binary sparse matrix to a binary full matrix
@@ -73,11 +78,42 @@ public:
 
 	/*
 	 * inverse H2 (H = [H1 H2] with size(H2) = M x M) to allow encoding with p = H1 x inv(H2) x u
+	 * The M x M inverse is returned bit-packed.
+	 */
+	static Packed_matrix invert_H2(const Sparse_matrix& H);
+
+	/*
+	 * convert a binary full matrix to a bit-packed matrix and vice versa
 	 */
-	static QCFull_matrix invert_H2(const Sparse_matrix& H);
+	static Packed_matrix pack  (const Full_matrix& full);
+	static Full_matrix   unpack(const Packed_matrix& packed, const unsigned n_cols);
 
 protected :
-	static void transform_H_to_G(Full_matrix& mat, std::vector<unsigned>& info_bits_pos);
+	// number of pivots per block in the eliminations: the rows are updated by a single XOR per block with a table of
+	// the 2^block_size combinations of the pivots (method of the four Russians)
+	static constexpr unsigned block_size = 8;
+
+	static Sparse_matrix transform_H_to_G(Packed_matrix& mat, const unsigned n_cols,
+	                                      std::vector<unsigned>& info_bits_pos);
+
+	/*
+	 * Forward elimination: the packed version of create_diagonal, the pivots are chosen in the same order and the
+	 * result is the same. If 'swapped_cols' is a null pointer, the columns are never swapped and the function returns
+	 * false as soon as a pivot is missing (singular matrix).
+	 */
+	static bool forward_elimination(Packed_matrix& mat, const unsigned n_cols, std::vector<unsigned>* swapped_cols);
+
+	/*
+	 * Backward elimination: the packed version of create_identity.
+	 */
+	static void backward_elimination(Packed_matrix& mat);
+
+	/*
+	 * Build the table of the 2^n_piv combinations of the 'n_piv' pivot rows stored in 'piv' (each of 'width' words)
+	 * after having reduced them to the identity on their 'n_piv' consecutive pivot columns starting at the bit 'first'.
+	 */
+	static void build_table(std::vector<uint64_t>& piv, const unsigned n_piv, const unsigned first, const unsigned width,
+	                        std::vector<uint64_t>& table);
 };
 }
 }
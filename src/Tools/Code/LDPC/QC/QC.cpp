@@ -153,3 +153,92 @@ void QC
 {
 	AList::write(matrix, stream);
 }
+
+unsigned QC
+::get_lifting_factor(const Sparse_matrix &H)
+{
+	const auto n_VN = H.get_n_rows();
+	const auto n_CN = H.get_n_cols();
+
+	for (auto Z = std::min(n_VN, n_CN); Z > 1; Z--)
+		if (n_VN % Z == 0 && n_CN % Z == 0 && QC::_get_base_matrix(H, Z, nullptr))
+			return Z;
+
+	return 1;
+}
+
+std::vector<std::vector<int>> QC
+::get_base_matrix(const Sparse_matrix &H, const unsigned Z)
+{
+	if (Z == 0 || H.get_n_rows() % Z || H.get_n_cols() % Z)
+	{
+		std::stringstream message;
+		message << "'Z' has to divide the number of rows and the number of columns of 'H' ('Z' = " << Z
+		        << ", 'H.get_n_rows()' = " << H.get_n_rows() << ", 'H.get_n_cols()' = " << H.get_n_cols() << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	std::vector<std::vector<int>> base;
+	if (!QC::_get_base_matrix(H, Z, &base))
+	{
+		std::stringstream message;
+		message << "'H' is not made of circulant permutation blocks of size 'Z' ('Z' = " << Z << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	return base;
+}
+
+bool QC
+::_get_base_matrix(const Sparse_matrix &H, const unsigned Z, std::vector<std::vector<int>> *base)
+{
+	const auto n_layers = H.get_n_cols() / Z;
+	const auto n_blocks = H.get_n_rows() / Z;
+
+	// the layers are checked one by one so a matrix without QC structure is rejected early and cheaply
+	std::vector<int     > shifts (n_blocks, -1);
+	std::vector<unsigned> weights(n_blocks,  0);
+	std::vector<unsigned> touched;
+
+	if (base != nullptr)
+		base->clear();
+
+	for (unsigned i = 0; i < n_layers; i++)
+	{
+		for (unsigned k = 0; k < Z; k++)
+		{
+			for (auto v : H.get_rows_from_col(i * Z + k))
+			{
+				const auto j = v / Z;
+				const auto s = (int)((v % Z + Z - k) % Z);
+
+				if (shifts[j] == -1)
+				{
+					shifts[j] = s;
+					touched.push_back(j);
+				}
+				else if (shifts[j] != s)
+					return false;
+
+				weights[j]++;
+			}
+		}
+
+		// a circulant permutation block has exactly one connection per check node
+		for (auto j : touched)
+			if (weights[j] != Z)
+				return false;
+
+		if (base != nullptr)
+			base->push_back(shifts);
+
+		for (auto j : touched)
+		{
+			shifts [j] = -1;
+			weights[j] =  0;
+		}
+		touched.clear();
+	}
+
+	return true;
+}
@@ -19,8 +19,23 @@ public:
 	static std::vector<bool> read_pct_pattern(                             std::istream &stream, int N_red = -1);
 	static void              write           (const Sparse_matrix &matrix, std::ostream &stream                );
 
+	/*
+	 * Return the biggest lifting factor Z for which H is made of Z x Z circulant permutation (or null) blocks, the
+	 * variable nodes being the rows of H and the check nodes its columns (return 1 if H has no QC structure)
+	 */
+	static unsigned get_lifting_factor(const Sparse_matrix &H);
+
+	/*
+	 * Return the base matrix of H for the lifting factor Z: one row per layer of Z check nodes and one column per
+	 * block of Z variable nodes. A value s >= 0 means that the check node 'i * Z + k' is connected to the variable
+	 * node 'j * Z + (k + s) % Z' (same convention as in the QC files), -1 means a null block
+	 */
+	static std::vector<std::vector<int>> get_base_matrix(const Sparse_matrix &H, const unsigned Z);
+
 private:
 	static Sparse_matrix    _read            (                             std::istream &stream                );
+	static bool             _get_base_matrix (const Sparse_matrix &H, const unsigned Z,
+	                                          std::vector<std::vector<int>> *base                              );
 };
 }
 }
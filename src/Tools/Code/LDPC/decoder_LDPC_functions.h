@@ -0,0 +1,127 @@
+#ifndef DECODER_LDPC_FUNCTIONS_H
+#define DECODER_LDPC_FUNCTIONS_H
+
+#include <cmath>
+#include <cstdint>
+#include <mipp.h>
+
+#include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+// --------------------------------------------------------------------------------------------------------------------
+// ---------------------------------------------------------------------------------------------------------- MESSAGES
+
+//                                                                                                  messages saturation
+// the saturation of the check node messages guarantees that the sum of all the messages of a variable node does not
+// overflow
+template <typename R>
+inline R messages_saturation(const Sparse_matrix &H)
+{
+	return (R)((1 << ((sizeof(R) * 8 -2) - (int)std::log2(H.get_rows_max_degree()))) -1);
+}
+// in 8-bit the formula above leaves almost no dynamic to the messages: instead the variable nodes are saturated at
+// each layer update (see simd_add_sat and simd_contribution) and the messages take half of the dynamic
+template <>
+inline int8_t messages_saturation(const Sparse_matrix &H)
+{
+	return (int8_t)((1 << (sizeof(int8_t) * 8 -2)) -1);
+}
+
+// ---------------------------------------------------------------------------------------------------------- MESSAGES
+// --------------------------------------------------------------------------------------------------------------------
+
+// --------------------------------------------------------------------------------------------------------------------
+// --------------------------------------------------------------------------------------------------------- SIMD TOOLS
+
+//                                                                                                           saturation
+template <typename R>
+inline mipp::Reg<R> simd_sat(const mipp::Reg<R> val, const R saturation)
+{
+	return val;
+}
+template <>
+inline mipp::Reg<short> simd_sat(const mipp::Reg<short> v, const short s)
+{
+	return mipp::sat(v, (short)-s, (short)+s);
+}
+template <>
+inline mipp::Reg<int8_t> simd_sat(const mipp::Reg<int8_t> v, const int8_t s)
+{
+	return mipp::sat(v, (int8_t)-s, (int8_t)+s);
+}
+
+//                                                                                       saturated addition/subtraction
+// in 8-bit there is no room to prevent the overflows with a static saturation of the messages: the additions and the
+// subtractions saturate and the results are kept in [-127, 127] so the absolute value cannot overflow
+template <typename R>
+inline mipp::Reg<R> simd_add_sat(const mipp::Reg<R> a, const mipp::Reg<R> b)
+{
+	return a + b;
+}
+template <>
+inline mipp::Reg<int8_t> simd_add_sat(const mipp::Reg<int8_t> a, const mipp::Reg<int8_t> b)
+{
+	return mipp::max(mipp::adds(a, b), mipp::Reg<int8_t>((int8_t)-127));
+}
+
+template <typename R>
+inline mipp::Reg<R> simd_sub_sat(const mipp::Reg<R> a, const mipp::Reg<R> b)
+{
+	return a - b;
+}
+template <>
+inline mipp::Reg<int8_t> simd_sub_sat(const mipp::Reg<int8_t> a, const mipp::Reg<int8_t> b)
+{
+	return mipp::max(mipp::subs(a, b), mipp::Reg<int8_t>((int8_t)-127));
+}
+
+//                                                                                       variable node contribution
+// the contribution of a variable node to a check node is the variable node value minus the previous message of the
+// check node. In 8-bit a saturated variable node is considered as reliable and is kept as is: removing the message
+// would make its value shrink at each layer while its real value is much bigger
+template <typename R>
+inline mipp::Reg<R> simd_contribution(const mipp::Reg<R> var_node, const mipp::Reg<R> branch)
+{
+	return var_node - branch;
+}
+template <>
+inline mipp::Reg<int8_t> simd_contribution(const mipp::Reg<int8_t> var_node,
+                                                const mipp::Reg<int8_t> branch)
+{
+	const auto is_sat = mipp::abs(var_node) == mipp::Reg<int8_t>((int8_t)127);
+	return mipp::blend(var_node, simd_sub_sat<int8_t>(var_node, branch), is_sat);
+}
+
+//                                                                                                        normalization
+template <typename R, int F = 0> inline mipp::Reg<R> simd_normalize(const mipp::Reg<R> val, const float factor)
+{
+	return val * mipp::Reg<R>((R)factor);
+}
+template <> inline mipp::Reg<short > simd_normalize<short, 1>(const mipp::Reg<short > v, const float f) { return (v >> 3);                       } // v * 0.125
+template <> inline mipp::Reg<short > simd_normalize<short, 2>(const mipp::Reg<short > v, const float f) { return            (v >> 2);            } // v * 0.250
+template <> inline mipp::Reg<short > simd_normalize<short, 3>(const mipp::Reg<short > v, const float f) { return (v >> 3) + (v >> 2);            } // v * 0.375
+template <> inline mipp::Reg<short > simd_normalize<short, 4>(const mipp::Reg<short > v, const float f) { return                       (v >> 1); } // v * 0.500
+template <> inline mipp::Reg<short > simd_normalize<short, 5>(const mipp::Reg<short > v, const float f) { return (v >> 3) +            (v >> 1); } // v * 0.625
+template <> inline mipp::Reg<short > simd_normalize<short, 6>(const mipp::Reg<short > v, const float f) { return            (v >> 2) + (v >> 1); } // v * 0.750
+template <> inline mipp::Reg<short > simd_normalize<short, 7>(const mipp::Reg<short > v, const float f) { return (v >> 3) + (v >> 2) + (v >> 1); } // v * 0.825
+template <> inline mipp::Reg<short > simd_normalize<short, 8>(const mipp::Reg<short > v, const float f) { return v;                              } // v * 1.000
+template <> inline mipp::Reg<int8_t> simd_normalize<int8_t,1>(const mipp::Reg<int8_t> v, const float f) { return (v >> 3);                       } // v * 0.125
+template <> inline mipp::Reg<int8_t> simd_normalize<int8_t,2>(const mipp::Reg<int8_t> v, const float f) { return            (v >> 2);            } // v * 0.250
+template <> inline mipp::Reg<int8_t> simd_normalize<int8_t,3>(const mipp::Reg<int8_t> v, const float f) { return (v >> 3) + (v >> 2);            } // v * 0.375
+template <> inline mipp::Reg<int8_t> simd_normalize<int8_t,4>(const mipp::Reg<int8_t> v, const float f) { return                       (v >> 1); } // v * 0.500
+template <> inline mipp::Reg<int8_t> simd_normalize<int8_t,5>(const mipp::Reg<int8_t> v, const float f) { return (v >> 3) +            (v >> 1); } // v * 0.625
+template <> inline mipp::Reg<int8_t> simd_normalize<int8_t,6>(const mipp::Reg<int8_t> v, const float f) { return            (v >> 2) + (v >> 1); } // v * 0.750
+template <> inline mipp::Reg<int8_t> simd_normalize<int8_t,7>(const mipp::Reg<int8_t> v, const float f) { return (v >> 3) + (v >> 2) + (v >> 1); } // v * 0.825
+template <> inline mipp::Reg<int8_t> simd_normalize<int8_t,8>(const mipp::Reg<int8_t> v, const float f) { return v;                              } // v * 1.000
+template <> inline mipp::Reg<float > simd_normalize<float, 8>(const mipp::Reg<float > v, const float f) { return v;                              } // v * 1.000
+template <> inline mipp::Reg<double> simd_normalize<double,8>(const mipp::Reg<double> v, const float f) { return v;                              } // v * 1.000
+
+// --------------------------------------------------------------------------------------------------------- SIMD TOOLS
+// --------------------------------------------------------------------------------------------------------------------
+}
+}
+
+#endif /* DECODER_LDPC_FUNCTIONS_H */
@@ -2,8 +2,16 @@
 #define _USE_MATH_DEFINES
 #endif
 
+#include <map>
+#include <list>
+#include <mutex>
 #include <cmath>
+#include <cstring>
+#include <cstdint>
 #include <limits>
+#include <memory>
+#include <utility>
+#include <iterator>
 #include <fstream>
 #include <iostream>
 #include <algorithm>
@@ -12,9 +20,24 @@
 
 using namespace aff3ct::tools;
 
+constexpr double Frozenbits_generator_GA::alpha;
+constexpr double Frozenbits_generator_GA::beta;
+constexpr double Frozenbits_generator_GA::gamma;
+constexpr double Frozenbits_generator_GA::a;
+constexpr double Frozenbits_generator_GA::b;
+constexpr double Frozenbits_generator_GA::c;
+constexpr double Frozenbits_generator_GA::phi_pivot;
+constexpr double Frozenbits_generator_GA::phi_inv_pivot;
+constexpr double Frozenbits_generator_GA::minus_min;
+constexpr double Frozenbits_generator_GA::minus_max;
+constexpr int    Frozenbits_generator_GA::minus_n_vals;
+
+// maximum number of (N, sigma) kept in memory
+static const size_t memo_max_size = 32;
+
 Frozenbits_generator_GA
 ::Frozenbits_generator_GA(const int K, const int N, const float sigma)
-: Frozenbits_generator(K, N, sigma), m((int)std::log2(N)), z((int)std::exp2(m), 0)
+: Frozenbits_generator(K, N, sigma), m((int)std::log2(N)), z(N, 0), z_next(N, 0)
 {
 }
 
@@ -26,30 +49,109 @@ Frozenbits_generator_GA
 void Frozenbits_generator_GA
 ::evaluate()
 {
-	for (unsigned i = 0; i != this->best_channels.size(); i++) 
-		this->best_channels[i] = i;
+	struct Entry
+	{
+		std::mutex            mutex;
+		bool                  done = false;
+		std::vector<uint32_t> best_channels;
+	};
+
+	using Key   = std::pair<int,float>;
+	using Value = std::pair<std::shared_ptr<Entry>, std::list<Key>::iterator>; // entry and position in 'memo_order'
+
+	static std::mutex           mutex_memo;
+	static std::list<Key>       memo_order; // least recently used keys first
+	static std::map<Key, Value> memo;
+
+	const auto key = std::make_pair(this->N, this->sigma);
+
+	std::shared_ptr<Entry> entry;
+	{
+		std::lock_guard<std::mutex> lock(mutex_memo);
+		auto it = memo.find(key);
+		if (it == memo.end())
+		{
+			memo_order.push_back(key);
+			it = memo.insert(std::make_pair(key, Value(std::make_shared<Entry>(), std::prev(memo_order.end())))).first;
+
+			// forget the least recently used best channels (the generators still computing them keep their entry)
+			if (memo_order.size() > memo_max_size)
+			{
+				memo.erase(memo_order.front());
+				memo_order.pop_front();
+			}
+		}
+		else
+			memo_order.splice(memo_order.end(), memo_order, it->second.second);
 
-	for (auto i = 0; i < std::exp2(m); i++)
-		z[i] = 2.0 / std::pow((double)this->sigma, 2.0);
+		entry = it->second.first;
+	}
 
-	for (auto l = 1; l <= m; l++)
+	// the generators of the different threads wait for the first one computing the same best channels
+	std::lock_guard<std::mutex> lock(entry->mutex);
+	if (!entry->done)
 	{
-		auto o1 = (int)std::exp2(m - l +1);
-		auto o2 = (int)std::exp2(m - l   );
+		this->compute_best_channels();
+		entry->best_channels = this->best_channels;
+		entry->done          = true;
+	}
+	else
+		this->best_channels = entry->best_channels;
+}
 
-		for (auto t = 0; t < (int)std::exp2(l -1); t++)
+void Frozenbits_generator_GA
+::compute_best_channels()
+{
+	// the channels of the stage 'l' are stored in the order of their transforms ('minus' in 2t, 'plus' in 2t +1), after
+	// the last stage the channel 't' is the bit 't' of the frame
+	z[0] = 2.0 / ((double)this->sigma * (double)this->sigma);
+
+	for (auto l = 0; l < m; l++)
+	{
+		const auto n_channels = 1 << l;
+		for (auto t = 0; t < n_channels; t++)
 		{
-			double T = z[t * o1];
-			
-			z[t * o1] = phi_inv(1.0 - std::pow(1.0 - phi(T), 2.0));
-			if (z[t * o1] == HUGE_VAL)
-				z[t * o1] = T + M_LN2 / (alpha * gamma);
+			const auto T = z[t];
+			z_next[2 * t +0] = minus_interp(T);
+			z_next[2 * t +1] = 2.0 * T;
+		}
+		std::swap(z, z_next);
+	}
+
+	// sort the channels by decreasing mean LLRs with a LSD radix sort (four 16-bit digits) on the bits of the mean
+	// LLRs, transformed to be ordered like unsigned integers (and complemented for the decreasing order): the order is
+	// exactly the one of the doubles
+	std::vector<std::pair<uint64_t,uint32_t>> keys(this->N), keys_tmp(this->N);
+	for (auto i = 0; i < this->N; i++)
+	{
+		uint64_t bits;
+		std::memcpy(&bits, &z[i], sizeof(bits));
+		bits = (bits >> 63) ? ~bits : bits | (1ull << 63);
+		keys[i] = std::make_pair(~bits, (uint32_t)i);
+	}
+
+	std::vector<uint32_t> count(1 << 16);
+	for (auto shift = 0; shift < 64; shift += 16)
+	{
+		std::fill(count.begin(), count.end(), 0);
+		for (auto &k : keys)
+			count[(k.first >> shift) & 0xFFFF]++;
 
-			z[t * o1 + o2] = 2.0 * T;
+		uint32_t sum = 0;
+		for (auto &c : count)
+		{
+			const auto n = c;
+			c    = sum;
+			sum += n;
 		}
+
+		for (auto &k : keys)
+			keys_tmp[count[(k.first >> shift) & 0xFFFF]++] = k;
+		std::swap(keys, keys_tmp);
 	}
 
-	std::sort(this->best_channels.begin(), this->best_channels.end(), [this](int i1, int i2) { return z[i1] > z[i2]; });
+	for (auto i = 0; i < this->N; i++)
+		this->best_channels[i] = keys[i].second;
 }
 
 double Frozenbits_generator_GA
@@ -64,8 +166,41 @@ double Frozenbits_generator_GA
 double Frozenbits_generator_GA
 ::phi_inv(double t)
 {
-	if (t > phi_inv_pivot)	
+	if (t > phi_inv_pivot)
 		return 4.304964539 * (1 - sqrt(1 + 0.9567131408 * std::log(t)));
 	else
 		return std::pow(a * std::log(t) + b, c);
 }
+
+double Frozenbits_generator_GA
+::minus(double T)
+{
+	auto z = phi_inv(1.0 - std::pow(1.0 - phi(T), 2.0));
+	if (z == HUGE_VAL)
+		z = T + M_LN2 / (alpha * gamma);
+	return z;
+}
+
+double Frozenbits_generator_GA
+::minus_interp(double T)
+{
+	// 'minus' sampled on a logarithmic grid of [minus_min;minus_max] (computed once)
+	static const double log_min = std::log(minus_min);
+	static const double step    = (std::log(minus_max) - log_min) / (minus_n_vals -1);
+	static const std::vector<double> table = []()
+	{
+		std::vector<double> table(minus_n_vals);
+		for (auto i = 0; i < minus_n_vals; i++)
+			table[i] = Frozenbits_generator_GA::minus(std::exp(log_min + i * step));
+		return table;
+	}();
+
+	if (T <= minus_min || T >= minus_max)
+		return minus(T);
+
+	const auto x = (std::log(T) - log_min) / step;
+	const auto i = std::min((int)x, minus_n_vals -2);
+	const auto w = x - i;
+
+	return table[i] + w * (table[i +1] - table[i]);
+}
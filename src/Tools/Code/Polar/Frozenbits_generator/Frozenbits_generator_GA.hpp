@@ -10,25 +10,37 @@ namespace aff3ct
 {
 namespace tools
 {
+/*
+ * Gaussian approximation of the polar codes construction. The mean LLRs of the channels are computed stage by stage
+ * (all the channels of a stage in one batch) and the 'minus' transform is read in a table (linear interpolation on a
+ * logarithmic grid). The best channels of the 32 most recently used (N, sigma) are memoized: the generators of the
+ * different threads and the regenerations for an already seen SNR do not recompute them.
+ */
 class Frozenbits_generator_GA : public Frozenbits_generator
 {
 private:
 	const int m;
-	std::vector<double> z;
+	std::vector<double> z;      // mean LLRs of the channels of the current stage
+	std::vector<double> z_next; // mean LLRs of the channels of the next stage
 
-	const double alpha = -0.4527;
-	const double beta  =  0.0218;
-	const double gamma =  0.8600;
+	static constexpr double alpha = -0.4527;
+	static constexpr double beta  =  0.0218;
+	static constexpr double gamma =  0.8600;
 
-	const double a =  1.0  / alpha;
-	const double b = -beta / alpha;
-	const double c =  1.0  / gamma;
+	static constexpr double a =  1.0  / alpha;
+	static constexpr double b = -beta / alpha;
+	static constexpr double c =  1.0  / gamma;
 
-	const double phi_pivot     = 0.867861;
-	const double phi_inv_pivot = 0.6845772418;
+	static constexpr double phi_pivot     = 0.867861;
+	static constexpr double phi_inv_pivot = 0.6845772418;
 
 	const double bisection_max = std::numeric_limits<double>::max();
 
+	// the table of the 'minus' transform covers the mean LLRs in [minus_min;minus_max]
+	static constexpr double minus_min    = 1e-4;
+	static constexpr double minus_max    = 1e8;
+	static constexpr int    minus_n_vals = 1 << 14;
+
 public:
 	Frozenbits_generator_GA(const int K, const int N, const float sigma = 0.f);
 
@@ -36,8 +48,14 @@ public:
 
 protected:
 	void   evaluate();
-	double phi    (double t);
-	double phi_inv(double t);
+	void   compute_best_channels();
+
+	static double phi    (double t);
+	static double phi_inv(double t);
+
+	// mean LLR of the 'minus' channel from the mean LLR 'T' of the parent channel: phi_inv(1 - (1 - phi(T))^2)
+	static double minus       (double T);
+	static double minus_interp(double T);
 };
 }
 }
@@ -6,10 +6,22 @@
 #include <dirent.h>
 #include <errno.h>
 
-#include <iostream>
+#include <map>
+#include <queue>
+#include <tuple>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <memory>
+#include <random>
+#include <cstdio>
+#include <cstdint>
 #include <fstream>
 #include <sstream>
 #include <iomanip>
+#include <algorithm>
+#include <functional>
+#include <iostream>
 #include <cmath>
 
 #include "Tools/Exception/exception.hpp"
@@ -21,12 +33,42 @@ using namespace aff3ct::tools;
 
 const int Frozenbits_generator_TV::Mu = 100;
 
+static const char     cache_magic[8] = {'A','F','F','3','C','T','T','V'};
+static const uint32_t cache_version  = 1;
+
+// binary entropy function
+static inline double h2(const double e)
+{
+	if (e <= 0.)
+		return 0.;
+	return -(e * std::log2(e) + (1. - e) * std::log1p(-e) / std::log(2.));
+}
+
+// inverse of the binary entropy function on [0;1/2] (bisection)
+static double h2_inv(const double h)
+{
+	auto lo = 0., hi = 0.5;
+	for (auto i = 0; i < 64; i++)
+	{
+		const auto mid = (lo + hi) / 2.;
+		if (h2(mid) < h) lo = mid; else hi = mid;
+	}
+	return (lo + hi) / 2.;
+}
+
+// probability that a gaussian variable of mean 0 and variance 1 is greater than 'x'
+static inline double Q(const double x)
+{
+	return 0.5 * std::erfc(x / std::sqrt(2.));
+}
+
 Frozenbits_generator_TV
 ::Frozenbits_generator_TV(const int K, const int N,
                           const std::string &awgn_codes_dir,
-                          const std::string &bin_pb_path,
-                          const float sigma)
-: Frozenbits_generator_file(K, N, sigma), m((int)std::log2(N)), awgn_codes_dir(awgn_codes_dir), bin_pb_path(bin_pb_path)
+                          const float sigma,
+                          const int n_threads)
+: Frozenbits_generator_file(K, N, sigma), m((int)std::log2(N)), awgn_codes_dir(awgn_codes_dir),
+  n_threads(n_threads > 0 ? n_threads : std::max(1, (int)std::thread::hardware_concurrency()))
 {
 }
 
@@ -51,84 +93,390 @@ void Frozenbits_generator_TV
 		message << "The following directory does not exist: '" + awgn_codes_dir + "'.";
 		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
 	}
-	else
-	{
-		closedir(dp);
-		auto sub_folder = awgn_codes_dir + "/" + str_m;
 
+	closedir(dp);
+	auto sub_folder = awgn_codes_dir + "/" + str_m;
+
+	if ((dp = opendir(sub_folder.c_str())) == nullptr)
+	{
+		static std::mutex mutex_create_folder;
+		mutex_create_folder.lock();
 		if ((dp = opendir(sub_folder.c_str())) == nullptr)
 		{
-			static std::mutex mutex_create_folder;
-			mutex_create_folder.lock();
-			if ((dp = opendir(sub_folder.c_str())) == nullptr)
-			{
-				// mkdir mod = rwx r.x r.x
+			// mkdir mod = rwx r.x r.x
 #ifdef _MSC_VER // Windows with MSVC
-				if (_mkdir(sub_folder.c_str()) != 0)
-				{
+			if (_mkdir(sub_folder.c_str()) != 0)
+			{
 #elif defined(_WIN32) // MinGW on Windows
-				if (mkdir(sub_folder.c_str()) != 0)
-				{
+			if (mkdir(sub_folder.c_str()) != 0)
+			{
 #else // UNIX like
-				if (mkdir(sub_folder.c_str(), S_IRWXU | S_IRGRP | S_IXGRP | S_IROTH | S_IXOTH) != 0)
-				{
+			if (mkdir(sub_folder.c_str(), S_IRWXU | S_IRGRP | S_IXGRP | S_IROTH | S_IXOTH) != 0)
+			{
 #endif
-					mutex_create_folder.unlock();
-					std::stringstream message;
-					message << "Impossible to create '" + sub_folder + "'.";
-					throw runtime_error(__FILE__, __LINE__, __func__, message.str());
-				}
+				mutex_create_folder.unlock();
+				std::stringstream message;
+				message << "Impossible to create '" + sub_folder + "'.";
+				throw runtime_error(__FILE__, __LINE__, __func__, message.str());
 			}
-			mutex_create_folder.unlock();
 		}
 		else
 			closedir(dp);
+		mutex_create_folder.unlock();
+	}
+	else
+		closedir(dp);
 
-		auto filename = sub_folder + "/N" + str_N + "_awgn_s" + str_sigma + ".pc";
+	// the precomputed files have the priority
+	auto filename = sub_folder + "/N" + str_N + "_awgn_s" + str_sigma + ".pc";
+	if (this->load_channels_file(filename))
+		return;
 
-		if (!this->load_channels_file(filename))
+	// the generators of the different threads wait for the first one computing the same channels but the different
+	// channels (the different SNR points) are computed in parallel
+	struct Entry
+	{
+		std::mutex            mutex;
+		bool                  done = false;
+		std::vector<uint32_t> best_channels;
+	};
+
+	static std::mutex mutex_entries;
+	static std::map<std::tuple<int,float,int>, std::shared_ptr<Entry>> entries;
+
+	std::shared_ptr<Entry> entry;
+	{
+		std::lock_guard<std::mutex> lock(mutex_entries);
+		auto &e = entries[std::make_tuple(this->N, this->sigma, Mu)];
+		if (e == nullptr)
+			e = std::make_shared<Entry>();
+		entry = e;
+	}
+
+	std::lock_guard<std::mutex> lock(entry->mutex);
+	if (!entry->done)
+	{
+		auto cache_filename = sub_folder + "/N" + str_N + "_awgn_s" + str_sigma + "_q" + std::to_string(Mu) + ".tv";
+		if (!this->load_cache(cache_filename))
 		{
-#ifdef ENABLE_POLAR_BOUNDS
-			static std::mutex mutex_write_file;
-			mutex_write_file.lock();
-			if (!this->load_channels_file(filename))
-			{
-				auto cmd  = bin_pb_path;
-				cmd      += " --no-print";                             // do not display anything
-				cmd      += " -q " + std::to_string(Mu);               // quality
-				cmd      += " --awgn";                                 // type
-				cmd      += " --sigma=" + std::to_string(this->sigma); // sigma value
-				cmd      += " --log-length=" + str_m;                  // m
-				cmd      += " -f=" + filename;                         // filename
-
-				std::clog << format("(II) Generating best channels positions file (\"" + filename + "\")...",
-				                    Style::BOLD | FG::Color::BLUE) << "\r";
-				fflush(stdout);
-
-				if (system(cmd.c_str()) == 0)
-				{
-					if (!this->load_channels_file(filename))
-					{
-						mutex_write_file.unlock();
-						std::stringstream message;
-						message << "Can't open '" << filename << "' file.";
-						throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
-					}
-				}
-				else
-				{
-					mutex_write_file.unlock();
-					std::stringstream message;
-					message << "The following command failed: '" << cmd << "'.";
-					throw runtime_error(__FILE__, __LINE__, __func__, message.str());
-				}
-			}
-			mutex_write_file.unlock();
-#else
-			std::stringstream message;
-			message << "Can't open '" << filename <<"' file.";
-			throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
-#endif
+			this->construct();
+
+			// the channels are computed, a read-only or full directory only costs the construction at the next run
+			if (!this->write_cache(cache_filename))
+				std::clog << format_warning("The frozen bits cache can't be written in '" + cache_filename + "'.")
+				          << std::endl;
+		}
+
+		entry->best_channels = this->best_channels;
+		entry->done          = true;
+	}
+	else
+		this->best_channels = entry->best_channels;
+}
+
+void Frozenbits_generator_TV
+::construct()
+{
+	if (this->sigma <= 0.f)
+	{
+		std::stringstream message;
+		message << "'sigma' has to be greater than 0 ('sigma' = " << this->sigma << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	// a symbol of the BMS channels is a pair of output symbols of the channel
+	const auto max_size = Mu / 2;
+
+	// the first stages are computed sequentially, then the threads polarize whole sub-trees (several sub-trees per
+	// thread to balance the load)
+	auto depth = 0;
+	while (depth < m && (1 << depth) < 8 * n_threads)
+		depth++;
+
+	std::vector<BMS_channel> roots(1, Frozenbits_generator_TV::awgn((double)this->sigma, max_size));
+	for (auto l = 0; l < depth; l++)
+	{
+		std::vector<BMS_channel> next(2 * roots.size());
+		for (size_t t = 0; t < roots.size(); t++)
+		{
+			next[2 * t +0] = Frozenbits_generator_TV::minus(roots[t], max_size);
+			next[2 * t +1] = Frozenbits_generator_TV::plus (roots[t], max_size);
 		}
+		roots = std::move(next);
 	}
+
+	// the channel 'i' is obtained by applying the transforms given by the bits of 'i' (from the most significant one),
+	// a bit to 0 is a 'minus' transform, a bit to 1 a 'plus' transform
+	std::vector<double> pe(this->N);
+	std::function<void(const BMS_channel&, const int, const int)> polarize;
+	polarize = [&](const BMS_channel& W, const int n_stages, const int idx)
+	{
+		if (n_stages == 0)
+			pe[idx] = Frozenbits_generator_TV::error_probability(W);
+		else
+		{
+			polarize(Frozenbits_generator_TV::minus(W, max_size), n_stages -1, idx                      );
+			polarize(Frozenbits_generator_TV::plus (W, max_size), n_stages -1, idx + (1 << (n_stages -1)));
+		}
+	};
+
+	std::atomic<int> next_root(0);
+	auto worker = [&]()
+	{
+		int t;
+		while ((t = next_root++) < (int)roots.size())
+			polarize(roots[t], m - depth, t << (m - depth));
+	};
+
+	std::vector<std::thread> threads(std::min(n_threads, (int)roots.size()) -1);
+	for (auto &t : threads)
+		t = std::thread(worker);
+	worker();
+	for (auto &t : threads)
+		t.join();
+
+	for (unsigned i = 0; i != this->best_channels.size(); i++)
+		this->best_channels[i] = i;
+
+	std::sort(this->best_channels.begin(), this->best_channels.end(), [&pe](uint32_t i1, uint32_t i2)
+	{
+		return pe[i1] < pe[i2] || (pe[i1] == pe[i2] && i1 > i2);
+	});
+}
+
+Frozenbits_generator_TV::BMS_channel Frozenbits_generator_TV
+::awgn(const double sigma, const int max_size)
+{
+	// the positive outputs are split in 'max_size' intervals of equal capacity (the output 'y' and the output '-y' make
+	// a BSC of crossover probability 1 / (1 + exp(2y / sigma^2)))
+	std::vector<double> y(max_size +1);
+	y[0] = 0.;
+	for (auto i = 1; i < max_size; i++)
+	{
+		const auto e = h2_inv(1. - (double)i / (double)max_size);
+		y[i] = sigma * sigma / 2. * std::log((1. - e) / e);
+	}
+	y[max_size] = HUGE_VAL;
+
+	BMS_channel W;
+	for (auto i = 0; i < max_size; i++)
+	{
+		const auto p_right = Q((y[i] - 1.) / sigma) - Q((y[i +1] - 1.) / sigma);
+		const auto p_wrong = Q((y[i] + 1.) / sigma) - Q((y[i +1] + 1.) / sigma);
+		if (p_right + p_wrong > 0.)
+			W.push_back(std::make_pair(p_right + p_wrong, p_wrong / (p_right + p_wrong)));
+	}
+
+	Frozenbits_generator_TV::degrade(W, max_size);
+	return W;
+}
+
+Frozenbits_generator_TV::BMS_channel Frozenbits_generator_TV
+::minus(const BMS_channel& W, const int max_size)
+{
+	// BSC(e1) and BSC(e2) through a check node give a BSC(e1 (1 - e2) + e2 (1 - e1)), the symmetric pairs are merged
+	BMS_channel Wm;
+	Wm.reserve(W.size() * (W.size() +1) / 2);
+	for (size_t a = 0; a < W.size(); a++)
+		for (size_t b = a; b < W.size(); b++)
+		{
+			const auto p  = (a == b ? 1. : 2.) * W[a].first * W[b].first;
+			const auto e1 = W[a].second, e2 = W[b].second;
+			Wm.push_back(std::make_pair(p, e1 * (1. - e2) + e2 * (1. - e1)));
+		}
+
+	Frozenbits_generator_TV::degrade(Wm, max_size);
+	return Wm;
+}
+
+Frozenbits_generator_TV::BMS_channel Frozenbits_generator_TV
+::plus(const BMS_channel& W, const int max_size)
+{
+	// BSC(e1) and BSC(e2) through a variable node give a BSC when the two outputs agree and an other one when they
+	// disagree
+	BMS_channel Wp;
+	Wp.reserve(W.size() * (W.size() +1));
+	for (size_t a = 0; a < W.size(); a++)
+		for (size_t b = a; b < W.size(); b++)
+		{
+			const auto p  = (a == b ? 1. : 2.) * W[a].first * W[b].first;
+			const auto e1 = W[a].second, e2 = W[b].second;
+
+			const auto agree = (1. - e1) * (1. - e2) + e1 * e2;
+			Wp.push_back(std::make_pair(p * agree, e1 * e2 / agree));
+
+			const auto disagree = e1 * (1. - e2) + (1. - e1) * e2;
+			if (disagree > 0.)
+				Wp.push_back(std::make_pair(p * disagree, std::min(e1 * (1. - e2), (1. - e1) * e2) / disagree));
+		}
+
+	Frozenbits_generator_TV::degrade(Wp, max_size);
+	return Wp;
+}
+
+void Frozenbits_generator_TV
+::degrade(BMS_channel& W, const int max_size)
+{
+	W.erase(std::remove_if(W.begin(), W.end(), [](const std::pair<double,double>& s) { return s.first <= 0.; }),
+	        W.end());
+	std::sort(W.begin(), W.end(), [](const std::pair<double,double>& s1, const std::pair<double,double>& s2)
+	{
+		return s1.second < s2.second;
+	});
+
+	const auto n = (int)W.size();
+	if (n <= max_size)
+		return;
+
+	// merge the neighbour symbols (in the crossover probability order) losing the least capacity, until 'max_size'
+	// symbols remain (greedy merge of Tal & Vardy, the merged channel is degraded)
+	std::vector<double> ph(n); // p * h2(e) of each symbol
+	for (auto i = 0; i < n; i++)
+		ph[i] = W[i].first * h2(W[i].second);
+
+	auto loss = [&W, &ph](const int i, const int j)
+	{
+		const auto p = W[i].first + W[j].first;
+		const auto e = (W[i].first * W[i].second + W[j].first * W[j].second) / p;
+		return p * h2(e) - ph[i] - ph[j];
+	};
+
+	std::vector<int> prev(n), next(n), stamp(n, 0);
+	for (auto i = 0; i < n; i++)
+	{
+		prev[i] = i -1;
+		next[i] = (i +1 < n) ? i +1 : -1;
+	}
+
+	// (capacity loss, first symbol, stamp of the first symbol when the loss was computed)
+	using Merge = std::tuple<double,int,int>;
+	std::vector<Merge> init_merges;
+	init_merges.reserve(3 * n);
+	for (auto i = 0; i < n -1; i++)
+		init_merges.push_back(std::make_tuple(loss(i, i +1), i, 0));
+	std::priority_queue<Merge, std::vector<Merge>, std::greater<Merge>> merges(std::greater<Merge>(),
+	                                                                           std::move(init_merges));
+
+	auto size = n;
+	while (size > max_size)
+	{
+		const auto merge = merges.top();
+		merges.pop();
+
+		const auto i = std::get<1>(merge);
+		if (stamp[i] != std::get<2>(merge) || next[i] == -1)
+			continue; // outdated
+
+		// merge the symbol 'j' in the symbol 'i'
+		const auto j = next[i];
+		const auto p = W[i].first + W[j].first;
+		W[i].second = (W[i].first * W[i].second + W[j].first * W[j].second) / p;
+		W[i].first  = p;
+		ph[i]       = p * h2(W[i].second);
+
+		next[i] = next[j];
+		if (next[j] != -1)
+			prev[next[j]] = i;
+		stamp[j] = -1;
+		size--;
+
+		if (next[i] != -1)
+			merges.push(std::make_tuple(loss(i, next[i]), i, ++stamp[i]));
+		else
+			stamp[i]++;
+
+		if (prev[i] != -1)
+			merges.push(std::make_tuple(loss(prev[i], i), prev[i], ++stamp[prev[i]]));
+	}
+
+	// the first symbol is never merged in an other one
+	BMS_channel Wd;
+	Wd.reserve(size);
+	for (auto i = 0; i != -1; i = next[i])
+		Wd.push_back(W[i]);
+	W = std::move(Wd);
+}
+
+double Frozenbits_generator_TV
+::error_probability(const BMS_channel& W)
+{
+	auto pe = 0.;
+	for (auto &s : W)
+		pe += s.first * s.second;
+	return pe;
+}
+
+bool Frozenbits_generator_TV
+::load_cache(const std::string& filename)
+{
+	std::ifstream file(filename, std::ios::in | std::ios::binary);
+	if (!file.is_open())
+		return false;
+
+	char     magic[8];
+	uint32_t f_version, f_N, f_Mu;
+	float    f_sigma;
+
+	file.read(magic,                                8);
+	file.read(reinterpret_cast<char*>(&f_version), sizeof(f_version));
+	file.read(reinterpret_cast<char*>(&f_N),       sizeof(f_N      ));
+	file.read(reinterpret_cast<char*>(&f_Mu),      sizeof(f_Mu     ));
+	file.read(reinterpret_cast<char*>(&f_sigma),   sizeof(f_sigma  ));
+
+	if (!file.good() || !std::equal(magic, magic + 8, cache_magic) || f_version != cache_version ||
+	    f_N != (uint32_t)this->N || f_Mu != (uint32_t)Mu || f_sigma != this->sigma)
+		return false;
+
+	std::vector<uint32_t> best_channels(this->N);
+	file.read(reinterpret_cast<char*>(best_channels.data()), best_channels.size() * sizeof(uint32_t));
+	if (!file.good())
+		return false;
+
+	// reject the inconsistent files: the best channels have to be a permutation
+	std::vector<bool> seen(this->N, false);
+	for (auto c : best_channels)
+	{
+		if (c >= (uint32_t)this->N || seen[c])
+			return false;
+		seen[c] = true;
+	}
+
+	this->best_channels = best_channels;
+	return true;
+}
+
+bool Frozenbits_generator_TV
+::write_cache(const std::string& filename) const
+{
+	// the file is written under a temporary name and renamed when complete: the other processes see the whole file or
+	// nothing
+	std::random_device rd;
+	std::stringstream tmp_filename;
+	tmp_filename << filename << ".tmp" << std::hex << rd();
+
+	std::ofstream file(tmp_filename.str(), std::ios::out | std::ios::binary | std::ios::trunc);
+	if (!file.is_open())
+		return false;
+
+	const uint32_t N  = (uint32_t)this->N;
+	const uint32_t mu = (uint32_t)Mu;
+
+	file.write(cache_magic,                                   8);
+	file.write(reinterpret_cast<const char*>(&cache_version), sizeof(cache_version));
+	file.write(reinterpret_cast<const char*>(&N),             sizeof(N            ));
+	file.write(reinterpret_cast<const char*>(&mu),            sizeof(mu           ));
+	file.write(reinterpret_cast<const char*>(&this->sigma),   sizeof(this->sigma  ));
+	file.write(reinterpret_cast<const char*>(this->best_channels.data()), this->best_channels.size() * sizeof(uint32_t));
+	file.close();
+
+	if (!file || std::rename(tmp_filename.str().c_str(), filename.c_str()) != 0)
+	{
+		std::remove(tmp_filename.str().c_str());
+
+		// an other process may have written the same file at the same time
+		std::ifstream written(filename, std::ios::in | std::ios::binary);
+		return file && written.peek() != std::ifstream::traits_type::eof();
+	}
+
+	return true;
 }
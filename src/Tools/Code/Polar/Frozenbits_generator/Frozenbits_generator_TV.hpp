@@ -3,7 +3,7 @@
 
 #include <string>
 #include <vector>
-#include <mutex>
+#include <utility>
 
 #include "Frozenbits_generator_file.hpp"
 
@@ -11,25 +11,56 @@ namespace aff3ct
 {
 namespace tools
 {
+/*
+ * Tal & Vardy construction of the polar codes on the AWGN channel: the synthetic channels are approximated by degraded
+ * channels of at most 'Mu' output symbols and sorted by their error probability.
+ * The best channels are read from the '<awgn_codes_dir>/<m>/N<N>_awgn_s<sigma>.pc' files when they exist (text
+ * format), otherwise they are read from or written to a binary cache in the same directory
+ * ('N<N>_awgn_s<sigma>_q<Mu>.tv', see 'load_cache'). The construction runs in the process, on 'n_threads' threads
+ * (all the cores by default: the simulation threads wait for the frozen bits).
+ */
 class Frozenbits_generator_TV : public Frozenbits_generator_file
 {
+public:
+	// binary memoryless symmetric channel seen as a mixture of BSCs: (probability, crossover probability <= 1/2)
+	using BMS_channel = std::vector<std::pair<double,double>>;
+
 private:
 	const int m;
 	const std::string awgn_codes_dir;
-	const std::string bin_pb_path;
+	const int n_threads;
 
 	const static int Mu; // quality of channels generated
 
 public:
 	Frozenbits_generator_TV(const int K, const int N,
 	                        const std::string &awgn_codes_dir,
-	                        const std::string &bin_pb_path,
-	                        float sigma = 0.f);
+	                        float sigma = 0.f,
+	                        const int n_threads = 0); // 0 means 'std::thread::hardware_concurrency()'
 
 	virtual ~Frozenbits_generator_TV();
 
 protected:
 	void evaluate();
+
+	/*
+	 * Compute the error probabilities of the N synthetic channels and sort the best channels.
+	 */
+	void construct();
+
+	/*
+	 * The cache files are made of a 24-byte header (magic (8), version (4), N (4), Mu (4), sigma (4, float)) followed
+	 * by the N best channels (uint32) in the native byte order. 'write_cache' returns false when the file can't be
+	 * written.
+	 */
+	bool load_cache (const std::string& filename);
+	bool write_cache(const std::string& filename) const;
+
+	static BMS_channel awgn             (const double       sigma, const int max_size);
+	static BMS_channel minus            (const BMS_channel& W,     const int max_size);
+	static BMS_channel plus             (const BMS_channel& W,     const int max_size);
+	static void        degrade          (      BMS_channel& W,     const int max_size);
+	static double      error_probability(const BMS_channel& W                        );
 };
 }
 }
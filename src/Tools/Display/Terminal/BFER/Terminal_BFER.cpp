@@ -171,8 +171,9 @@ void Terminal_BFER<B>
 	_report(stream);
 
 	auto et = duration_cast<milliseconds>(steady_clock::now() - t_snr).count() / 1000.f;
-	auto tr = et * ((float)monitor.get_fe_limit() / (float)monitor.get_n_fe()) - et;
-	auto tr_format = get_time_format((monitor.get_n_fe() == 0) ? 0 : tr);
+	auto fe = monitor.get_n_fe_estimate(); // the remaining time is an estimation anyway
+	auto tr = et * ((float)monitor.get_fe_limit() / (float)fe) - et;
+	auto tr_format = get_time_format((fe == 0) ? 0 : tr);
 
 	stream << format(" | ", Style::BOLD) << std::setprecision(0) << std::fixed << std::setw(8) << tr_format;
 
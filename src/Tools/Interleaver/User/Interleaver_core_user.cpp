@@ -10,9 +10,18 @@ using namespace aff3ct::tools;
 
 template <typename T>
 Interleaver_core_user<T>
-::Interleaver_core_user(const int size, const std::string &filename, const int n_frames)
-: Interleaver_core<T>(size, "user", false, n_frames), cur_itl_id(0)
+::Interleaver_core_user(const int size, const std::string &filename, const int n_frames, const int stream_id,
+                        const int n_streams)
+: Interleaver_core<T>(size, "user", false, n_frames), cur_itl_id(0), n_streams(n_streams)
 {
+	if (n_streams <= 0 || stream_id < 0 || stream_id >= n_streams)
+	{
+		std::stringstream message;
+		message << "'stream_id' has to be positive and smaller than 'n_streams' ('stream_id' = " << stream_id
+		        << ", 'n_streams' = " << n_streams << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
 	if (filename.empty())
 		throw invalid_argument(__FILE__, __LINE__, __func__, "'filename' should not be empty.");
 
@@ -87,6 +96,8 @@ Interleaver_core_user<T>
 			}
 
 			file.close();
+
+			this->cur_itl_id = stream_id % n_itl;
 		}
 		else
 		{
@@ -116,7 +127,7 @@ void Interleaver_core_user<T>
 ::gen_lut(T *lut, const int frame_id)
 {
 	std::copy(this->pi_buffer[cur_itl_id].begin(), this->pi_buffer[cur_itl_id].end(), lut);
-	cur_itl_id = (cur_itl_id +1) % pi_buffer.size();
+	cur_itl_id = (cur_itl_id + n_streams) % pi_buffer.size();
 }
 
 // ==================================================================================== explicit template instantiation
@@ -13,9 +13,11 @@ class Interleaver_core_user : public Interleaver_core<T>
 private:
 	std::vector<std::vector<T>> pi_buffer;
 	int cur_itl_id;
+	const int n_streams;
 
 public:
-	Interleaver_core_user(const int size, const std::string &filename, const int n_frames = 1);
+	Interleaver_core_user(const int size, const std::string &filename, const int n_frames = 1, const int stream_id = 0,
+	                      const int n_streams = 1);
 	virtual ~Interleaver_core_user();
 
 protected:
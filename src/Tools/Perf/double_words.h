@@ -0,0 +1,25 @@
+#ifndef DOUBLE_WORDS_H_
+#define DOUBLE_WORDS_H_
+
+#include <mipp.h>
+
+namespace aff3ct
+{
+namespace tools
+{
+// alternates 'lo' and 'hi' in the 32-bit elements (the low and the high words of the 64-bit elements, little endian):
+// the bits of the doubles can then be handled with 32-bit integer operations
+inline mipp::Reg<int> set_double_words(const int lo, const int hi)
+{
+	mipp::vector<int> words(mipp::nElReg<int>());
+	for (auto i = 0; i < mipp::nElReg<int>(); i += 2)
+	{
+		words[i +0] = lo;
+		words[i +1] = hi;
+	}
+	return mipp::Reg<int>(words.data());
+}
+}
+}
+
+#endif /* DOUBLE_WORDS_H_ */
@@ -0,0 +1,69 @@
+#ifndef HAMMING_DISTANCE_H_
+#define HAMMING_DISTANCE_H_
+
+#include <limits>
+#include <cstdint>
+#include <algorithm>
+#include <mipp.h>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*
+ * Counts the number of positions where 'in1' and 'in2' differ, considering any non-zero value as a 1.
+ */
+template <typename B = int>
+inline int hamming_distance_seq(const B *in1, const B *in2, const int size)
+{
+	auto n_diff = 0;
+	for (auto i = 0; i < size; i++)
+		n_diff += !in1[i] != !in2[i];
+	return n_diff;
+}
+
+template <typename B = int>
+inline int hamming_distance(const B *in1, const B *in2, const int size)
+{
+	const auto r_zero = mipp::Reg<B>((B)0);
+	const auto r_one  = mipp::Reg<B>((B)1);
+
+	// the lane counters are flushed before they overflow (every 127 registers in 8-bit)
+	constexpr auto max_ite = std::numeric_limits<B>::max() < (1 << 15) ? (int)std::numeric_limits<B>::max() : (1 << 15);
+	const auto vec_loop_size = (size / mipp::nElReg<B>()) * mipp::nElReg<B>();
+
+	auto n_diff = 0;
+	auto i = 0;
+	while (i < vec_loop_size)
+	{
+		const auto stop = std::min(vec_loop_size, i + max_ite * mipp::nElReg<B>());
+
+		auto r_cnt = r_zero;
+		for (; i < stop; i += mipp::nElReg<B>())
+		{
+			mipp::Reg<B> r_in1, r_in2;
+			r_in1.loadu(&in1[i]);
+			r_in2.loadu(&in2[i]);
+
+			r_cnt += mipp::blend(r_one, r_zero, (r_in1 == r_zero) ^ (r_in2 == r_zero));
+		}
+
+		B cnt[mipp::nElReg<B>()];
+		r_cnt.storeu(cnt);
+		for (auto j = 0; j < mipp::nElReg<B>(); j++)
+			n_diff += (int)cnt[j];
+	}
+
+	return n_diff + hamming_distance_seq(in1 + vec_loop_size, in2 + vec_loop_size, size - vec_loop_size);
+}
+
+// there is no portable 64-bit integer comparison in the SIMD instruction sets
+template <>
+inline int hamming_distance<int64_t>(const int64_t *in1, const int64_t *in2, const int size)
+{
+	return hamming_distance_seq(in1, in2, size);
+}
+}
+}
+
+#endif /* HAMMING_DISTANCE_H_ */
@@ -0,0 +1,30 @@
+#include <string>
+#include <sstream>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "SPSC_ring_buffer.hpp"
+
+using namespace aff3ct::tools;
+
+SPSC_ring_buffer
+::SPSC_ring_buffer(const size_t capacity, const std::vector<size_t> &buffers_bytes)
+: n_slots(capacity + 1), head(0), tail(0)
+{
+	if (capacity == 0)
+	{
+		std::stringstream message;
+		message << "'capacity' has to be greater than 0 ('capacity' = " << capacity << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	this->slots.resize(this->n_slots);
+	for (auto &slot : this->slots)
+		for (auto bytes : buffers_bytes)
+			slot.push_back(std::vector<uint8_t>(bytes));
+}
+
+SPSC_ring_buffer
+::~SPSC_ring_buffer()
+{
+}
@@ -0,0 +1,103 @@
+/*!
+ * \file
+ * \brief Lock-free ring buffer between one producer thread and one consumer thread.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef SPSC_RING_BUFFER_HPP
+#define SPSC_RING_BUFFER_HPP
+
+#include <atomic>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class SPSC_ring_buffer
+ *
+ * \brief Lock-free ring buffer between one producer thread and one consumer thread.
+ *
+ * Each slot of the ring is a set of byte buffers allocated once in the constructor. The producer fills the slot
+ * returned by get_slot_write() and publishes it with push(), the consumer reads the slot returned by get_slot_read()
+ * and releases it with pop().
+ */
+class SPSC_ring_buffer
+{
+private:
+	const size_t n_slots; // one slot is always kept empty to distinguish a full ring from an empty one
+	std::vector<std::vector<std::vector<uint8_t>>> slots;
+
+	// the indexes are written by one thread and read by the other: they are padded to avoid false sharing
+	char                padding_head[64];
+	std::atomic<size_t> head; // next slot to read
+	char                padding_mid [64];
+	std::atomic<size_t> tail; // next slot to write
+	char                padding_tail[64];
+
+public:
+	/*!
+	 * \brief Constructor.
+	 *
+	 * \param capacity:      the maximum number of slots in the ring at the same time.
+	 * \param buffers_bytes: the size in bytes of each buffer of a slot.
+	 */
+	SPSC_ring_buffer(const size_t capacity, const std::vector<size_t> &buffers_bytes);
+
+	/*!
+	 * \brief Destructor.
+	 */
+	~SPSC_ring_buffer();
+
+	/*!
+	 * \brief Gets the slot to fill (producer side).
+	 *
+	 * \return the free slot, nullptr if the ring is full.
+	 */
+	inline std::vector<std::vector<uint8_t>>* get_slot_write()
+	{
+		const auto t = this->tail.load(std::memory_order_relaxed);
+		if ((t + 1) % this->n_slots == this->head.load(std::memory_order_acquire))
+			return nullptr;
+		return &this->slots[t];
+	}
+
+	/*!
+	 * \brief Publishes the slot returned by the last call to get_slot_write() (producer side).
+	 */
+	inline void push()
+	{
+		const auto t = this->tail.load(std::memory_order_relaxed);
+		this->tail.store((t + 1) % this->n_slots, std::memory_order_release);
+	}
+
+	/*!
+	 * \brief Gets the oldest published slot (consumer side).
+	 *
+	 * \return the oldest slot, nullptr if the ring is empty.
+	 */
+	inline const std::vector<std::vector<uint8_t>>* get_slot_read()
+	{
+		const auto h = this->head.load(std::memory_order_relaxed);
+		if (h == this->tail.load(std::memory_order_acquire))
+			return nullptr;
+		return &this->slots[h];
+	}
+
+	/*!
+	 * \brief Releases the slot returned by the last call to get_slot_read() (consumer side).
+	 */
+	inline void pop()
+	{
+		const auto h = this->head.load(std::memory_order_relaxed);
+		this->head.store((h + 1) % this->n_slots, std::memory_order_release);
+	}
+};
+}
+}
+
+#endif /* SPSC_RING_BUFFER_HPP */
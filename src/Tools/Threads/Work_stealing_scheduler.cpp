@@ -0,0 +1,89 @@
+#include <string>
+#include <sstream>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Work_stealing_scheduler.hpp"
+
+using namespace aff3ct::tools;
+
+Work_stealing_scheduler
+::Work_stealing_scheduler(const int n_threads)
+: n_threads(n_threads), queues(n_threads > 0 ? n_threads : 0), mutexes(n_threads > 0 ? n_threads : 0)
+{
+	if (n_threads <= 0)
+	{
+		std::stringstream message;
+		message << "'n_threads' has to be greater than 0 ('n_threads' = " << n_threads << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+Work_stealing_scheduler
+::~Work_stealing_scheduler()
+{
+}
+
+void Work_stealing_scheduler
+::push(const int tid, const int item)
+{
+	if (tid < 0 || tid >= n_threads)
+	{
+		std::stringstream message;
+		message << "'tid' has to be positive and smaller than 'n_threads' ('tid' = " << tid
+		        << ", 'n_threads' = " << n_threads << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	std::lock_guard<std::mutex> lock(mutexes[tid]);
+	queues[tid].push_back(item);
+}
+
+bool Work_stealing_scheduler
+::pop(const int tid, int &item)
+{
+	if (tid < 0 || tid >= n_threads)
+	{
+		std::stringstream message;
+		message << "'tid' has to be positive and smaller than 'n_threads' ('tid' = " << tid
+		        << ", 'n_threads' = " << n_threads << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	// the owner takes the last pushed item
+	{
+		std::lock_guard<std::mutex> lock(mutexes[tid]);
+		if (!queues[tid].empty())
+		{
+			item = queues[tid].back();
+			queues[tid].pop_back();
+			return true;
+		}
+	}
+
+	// the thieves take the oldest item, starting with the next thread to spread the steals
+	for (auto i = 1; i < n_threads; i++)
+	{
+		const auto victim = (tid + i) % n_threads;
+
+		std::lock_guard<std::mutex> lock(mutexes[victim]);
+		if (!queues[victim].empty())
+		{
+			item = queues[victim].front();
+			queues[victim].pop_front();
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void Work_stealing_scheduler
+::clear()
+{
+	for (auto tid = 0; tid < n_threads; tid++)
+	{
+		std::lock_guard<std::mutex> lock(mutexes[tid]);
+		queues[tid].clear();
+	}
+}
@@ -0,0 +1,74 @@
+/*!
+ * \file
+ * \brief Distributes work items among threads, the idle threads steal the items of the busy ones.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef WORK_STEALING_SCHEDULER_HPP
+#define WORK_STEALING_SCHEDULER_HPP
+
+#include <deque>
+#include <mutex>
+#include <vector>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Work_stealing_scheduler
+ *
+ * \brief Distributes work items among threads, the idle threads steal the items of the busy ones.
+ *
+ * Each thread owns a deque of items. The owner pushes and pops its items at the back of its deque (LIFO) so it keeps
+ * working on the same item as long as possible. When its deque is empty, the thread steals the oldest item (front)
+ * of an other deque.
+ */
+class Work_stealing_scheduler
+{
+private:
+	const int n_threads;
+	std::vector<std::deque<int>> queues;
+	std::vector<std::mutex     > mutexes;
+
+public:
+	/*!
+	 * \brief Constructor.
+	 *
+	 * \param n_threads: number of threads sharing the scheduler.
+	 */
+	explicit Work_stealing_scheduler(const int n_threads);
+
+	/*!
+	 * \brief Destructor.
+	 */
+	~Work_stealing_scheduler();
+
+	/*!
+	 * \brief Pushes an item at the back of the deque of a thread.
+	 *
+	 * \param tid:  the number id of the thread which owns the deque.
+	 * \param item: the item to push.
+	 */
+	void push(const int tid, const int item);
+
+	/*!
+	 * \brief Pops an item from the back of the deque of the thread, steals an item from the other deques if empty.
+	 *
+	 * \param tid:  the number id of the thread which call this method.
+	 * \param item: the popped item (unchanged if there is none).
+	 *
+	 * \return false if all the deques are empty, true otherwise.
+	 */
+	bool pop(const int tid, int &item);
+
+	/*!
+	 * \brief Removes all the items from the deques.
+	 */
+	void clear();
+};
+}
+}
+
+#endif /* WORK_STEALING_SCHEDULER_HPP */
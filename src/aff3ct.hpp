@@ -24,6 +24,8 @@
 #include <Tools/Perf/Transpose/transpose_selector.h>
 #include <Tools/Perf/Transpose/transpose_NEON.h>
 #include <Tools/Perf/hard_decision.h>
+#include <Tools/Perf/hamming_distance.h>
+#include <Tools/Perf/double_words.h>
 #include <Tools/Display/bash_tools.h>
 
 #include <Tools/Interleaver/Random/Interleaver_core_random.hpp>
@@ -39,11 +41,14 @@
 #include <Tools/Interleaver/Column_row/Interleaver_core_column_row.hpp>
 #include <Tools/Interleaver/LTE/Interleaver_core_LTE.hpp>
 #include <Tools/Threads/Barrier.hpp>
+#include <Tools/Threads/SPSC_ring_buffer.hpp>
+#include <Tools/Threads/Work_stealing_scheduler.hpp>
 #include <Tools/Math/Galois.hpp>
 #include <Tools/Algo/Sort/LC_sorter.hpp>
 #include <Tools/Algo/Sort/LC_sorter_simd.hpp>
 #include <Tools/Algo/PRNG/PRNG_MT19937_simd.hpp>
 #include <Tools/Algo/PRNG/PRNG_MT19937.hpp>
+#include <Tools/Algo/PRNG/PRNG_Threefry.hpp>
 #include <Tools/Algo/Predicate.hpp>
 #include <Tools/Algo/Sparse_matrix/Sparse_matrix.hpp>
 #include <Tools/Algo/Tree/Binary_node.hpp>
@@ -53,6 +58,8 @@
 #include <Tools/Algo/Bit_packer.hpp>
 #include <Tools/Algo/Gaussian_noise_generator/Fast/Gaussian_noise_generator_fast.hpp>
 #include <Tools/Algo/Gaussian_noise_generator/Standard/Gaussian_noise_generator_std.hpp>
+#include <Tools/Algo/Gaussian_noise_generator/Threefry/Gaussian_noise_generator_threefry.hpp>
+#include <Tools/Algo/Gaussian_noise_generator/Ziggurat/Gaussian_noise_generator_ziggurat.hpp>
 #include <Tools/Algo/Gaussian_noise_generator/MKL/Gaussian_noise_generator_MKL.hpp>
 #include <Tools/Algo/Gaussian_noise_generator/Gaussian_noise_generator.hpp>
 #include <Tools/Algo/Gaussian_noise_generator/GSL/Gaussian_noise_generator_GSL.hpp>
@@ -91,8 +98,10 @@
 #include <Tools/Code/LDPC/Standard/DVBS2/DVBS2_constants_64800.hpp>
 #include <Tools/Code/LDPC/Standard/DVBS2/DVBS2_constants_16200.hpp>
 #include <Tools/Code/LDPC/Matrix_handler/LDPC_matrix_handler.hpp>
+#include <Tools/Code/LDPC/Matrix_handler/LDPC_matrix_cache.hpp>
 #include <Tools/Code/LDPC/QC/QC.hpp>
 #include <Tools/Code/LDPC/AList/AList.hpp>
+#include <Tools/Code/LDPC/decoder_LDPC_functions.h>
 #include <Tools/Code/BCH/BCH_polynomial_generator.hpp>
 #include <Tools/Code/SCMA/modem_SCMA_functions.hpp>
 #include <Tools/Code/Turbo/Post_processing_SISO/Post_processing_SISO.hpp>
@@ -147,6 +156,7 @@
 #include <Module/Encoder/LDPC/Encoder_LDPC.hpp>
 #include <Module/Encoder/LDPC/From_H/Encoder_LDPC_from_H.hpp>
 #include <Module/Encoder/LDPC/From_QC/Encoder_LDPC_from_QC.hpp>
+#include <Module/Encoder/LDPC/From_QC/Encoder_LDPC_from_QC_dual_diagonal.hpp>
 #include <Module/Encoder/LDPC/DVBS2/Encoder_LDPC_DVBS2.hpp>
 #include <Module/Encoder/Coset/Encoder_coset.hpp>
 #include <Module/Encoder/User/Encoder_user.hpp>
@@ -209,12 +219,14 @@
 #include <Module/Decoder/Repetition/Decoder_repetition.hpp>
 #include <Module/Decoder/LDPC/BP/Layered/ONMS/Decoder_LDPC_BP_layered_offset_normalize_min_sum.hpp>
 #include <Module/Decoder/LDPC/BP/Layered/ONMS/Decoder_LDPC_BP_layered_ONMS_inter.hpp>
+#include <Module/Decoder/LDPC/BP/Layered/ONMS/Decoder_LDPC_BP_layered_ONMS_intra.hpp>
 #include <Module/Decoder/LDPC/BP/Layered/LSPA/Decoder_LDPC_BP_layered_log_sum_product.hpp>
 #include <Module/Decoder/LDPC/BP/Layered/AMS/Decoder_LDPC_BP_layered_approximate_min_star.hpp>
 #include <Module/Decoder/LDPC/BP/Layered/SPA/Decoder_LDPC_BP_layered_sum_product.hpp>
 #include <Module/Decoder/LDPC/BP/Layered/Decoder_LDPC_BP_layered.hpp>
 #include <Module/Decoder/LDPC/BP/Flooding/Gallager/Decoder_LDPC_BP_flooding_Gallager_A.hpp>
 #include <Module/Decoder/LDPC/BP/Flooding/ONMS/Decoder_LDPC_BP_flooding_offset_normalize_min_sum.hpp>
+#include <Module/Decoder/LDPC/BP/Flooding/ONMS/Decoder_LDPC_BP_flooding_ONMS_inter.hpp>
 #include <Module/Decoder/LDPC/BP/Flooding/LSPA/Decoder_LDPC_BP_flooding_log_sum_product.hpp>
 #include <Module/Decoder/LDPC/BP/Flooding/AMS/Decoder_LDPC_BP_flooding_approximate_min_star.hpp>
 #include <Module/Decoder/LDPC/BP/Flooding/SPA/Decoder_LDPC_BP_flooding_sum_product.hpp>
@@ -276,6 +288,8 @@
 #include <Module/Modem/SCMA/Modem_SCMA.hpp>
 #include <Module/SC_Module.hpp>
 #include <Module/Module.hpp>
+#include <Module/Sequence.hpp>
+#include <Module/Pipeline.hpp>
 #include <Module/Codec/Codec_SIHO.hpp>
 #include <Module/Codec/Polar/Codec_polar.hpp>
 #include <Module/Codec/Codec_SISO.hpp>
@@ -0,0 +1,166 @@
+#include <cmath>
+#include <random>
+#include <memory>
+#include <vector>
+#include <iostream>
+#include <type_traits>
+#include <mipp.h>
+
+#include "Tools/types.h"
+#include "Tools/Code/Polar/Frozenbits_generator/Frozenbits_generator_GA.hpp"
+#include "Module/CRC/Polynomial/CRC_polynomial.hpp"
+#include "Module/Encoder/Polar/Encoder_polar_sys.hpp"
+#include "Module/Decoder/Polar/SCL/Decoder_polar_SCL_naive_sys.hpp"
+#include "Module/Decoder/Polar/SCL/Decoder_polar_SCL_inter_sys.hpp"
+#include "Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_naive_CA_sys.hpp"
+#include "Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_inter_CA_sys.hpp"
+#include "Module/Decoder/Polar/ASCL/Decoder_polar_ASCL_inter_CA_sys.hpp"
+
+#include "test.hpp"
+
+using namespace aff3ct;
+
+/*
+ * The inter-frame SCL and ASCL decoders decode 'mipp::nElReg<Q>()' frames at once, each frame has to be decoded as the
+ * non-inter SCL decoder (one frame at a time) decodes it. With a CRC, the decoders have to agree when the reference
+ * finds a path which verifies the CRC, the choice of the path is free otherwise (both decoders fail).
+ * The metrics are computed the same way in floating-point only (the fixed-point decoders saturate differently).
+ */
+enum class Kind { SCL, SCL_CA, ASCL_FULL, ASCL_PARTIAL };
+
+struct Params
+{
+	int   N, K, L;
+	float ebn0;
+	int   n_waves;
+};
+
+static void run(const Kind kind, const Params &p)
+{
+	const auto n_lanes = mipp::nElReg<Q>();
+	const auto crc_size = 8;
+	const auto rate = (float)p.K / (float)p.N;
+	const auto sigma = std::sqrt(1.f / (2.f * rate * std::pow(10.f, p.ebn0 / 10.f)));
+
+	tools::Frozenbits_generator_GA fb_generator(p.K, p.N, sigma);
+	std::vector<bool> frozen_bits(p.N);
+	fb_generator.generate(frozen_bits);
+
+	module::CRC_polynomial<B> crc    (p.K - crc_size, "8-WCDMA", crc_size, n_lanes);
+	module::CRC_polynomial<B> crc_ref(p.K - crc_size, "8-WCDMA", crc_size, 1      );
+	module::Encoder_polar_sys<B> encoder(p.K, p.N, frozen_bits, 1);
+
+	// the references: the SC decoder (L = 1) then the list sizes tried by the adaptive decoders
+	std::vector<int> list_sizes;
+	switch (kind)
+	{
+		case Kind::SCL:
+		case Kind::SCL_CA:       list_sizes = {p.L};                                          break;
+		case Kind::ASCL_FULL:    for (auto l = 1; l <= p.L; l <<= 1) list_sizes.push_back(l); break;
+		case Kind::ASCL_PARTIAL: list_sizes = {1, p.L};                                       break;
+	}
+
+	std::vector<std::unique_ptr<module::Decoder_SIHO<B,Q>>> refs;
+	for (auto l : list_sizes)
+		if (kind == Kind::SCL || l == 1)
+			refs.push_back(std::unique_ptr<module::Decoder_SIHO<B,Q>>(
+				new module::Decoder_polar_SCL_naive_sys<B,Q>(p.K, p.N, l, frozen_bits, 1)));
+		else
+			refs.push_back(std::unique_ptr<module::Decoder_SIHO<B,Q>>(
+				new module::Decoder_polar_SCL_naive_CA_sys<B,Q>(p.K, p.N, l, frozen_bits, crc_ref, 1)));
+
+	std::unique_ptr<module::Decoder_SIHO<B,Q>> inter;
+	switch (kind)
+	{
+		case Kind::SCL:
+			inter.reset(new module::Decoder_polar_SCL_inter_sys<B,Q>(p.K, p.N, p.L, frozen_bits, n_lanes));
+			break;
+		case Kind::SCL_CA:
+			inter.reset(new module::Decoder_polar_SCL_inter_CA_sys<B,Q>(p.K, p.N, p.L, frozen_bits, crc, n_lanes));
+			break;
+		case Kind::ASCL_FULL:
+		case Kind::ASCL_PARTIAL:
+			inter.reset(new module::Decoder_polar_ASCL_inter_CA_sys<B,Q>(p.K, p.N, p.L, frozen_bits, crc,
+			                                                             kind == Kind::ASCL_FULL, n_lanes));
+			break;
+	}
+
+	std::mt19937 gen(p.N + p.L);
+	std::normal_distribution<float> noise(0.f, sigma);
+
+	std::vector<B> U_K1(p.K - crc_size), U_K2(p.K), X_N(p.N), V_K_ref(p.K);
+	std::vector<Q> Y_N(p.N);
+	mipp::vector<Q> Y_N_inter(p.N * n_lanes);
+	mipp::vector<B> V_K_inter(p.K * n_lanes);
+	std::vector<std::vector<B>> V_K_refs(n_lanes, std::vector<B>(p.K));
+
+	unsigned n_diff = 0;
+	for (auto w = 0; w < p.n_waves; w++)
+	{
+		for (auto f = 0; f < n_lanes; f++)
+		{
+			for (auto &u : U_K1)
+				u = (B)(gen() & 1);
+			crc_ref.build(U_K1, U_K2);
+			encoder.encode(U_K2, X_N);
+
+			for (auto n = 0; n < p.N; n++)
+			{
+				Y_N[n] = (Q)(2.f * ((X_N[n] ? -1.f : 1.f) + noise(gen)) / (sigma * sigma));
+				Y_N_inter[f * p.N + n] = Y_N[n];
+			}
+
+			// the adaptive references stop at the first list size which gives a valid CRC
+			for (auto &ref : refs)
+			{
+				ref->decode_siho(Y_N, V_K_ref);
+				if (kind != Kind::SCL && crc_ref.check(V_K_ref, 1))
+					break;
+			}
+			V_K_refs[f] = V_K_ref;
+		}
+
+		inter->decode_siho(Y_N_inter, V_K_inter);
+
+		for (auto f = 0; f < n_lanes; f++)
+		{
+			std::vector<B> V_K(V_K_inter.begin() + f * p.K, V_K_inter.begin() + (f +1) * p.K);
+			for (auto &v : V_K)
+				v = (B)(v != 0);
+			for (auto &v : V_K_refs[f])
+				v = (B)(v != 0);
+
+			const auto ref_valid = kind == Kind::SCL || crc_ref.check(V_K_refs[f], 1);
+			if (ref_valid)
+				n_diff += V_K != V_K_refs[f];
+			else
+				n_diff += crc_ref.check(V_K, 1);
+		}
+	}
+
+	std::cout << "kind = " << (int)kind << ", N = " << p.N << ", K = " << p.K << ", L = " << p.L
+	          << ", Eb/N0 = " << p.ebn0 << ", frames = " << p.n_waves * n_lanes << ", differences = " << n_diff
+	          << std::endl;
+	TEST_CHECK(n_diff == 0);
+}
+
+int main(int argc, char** argv)
+{
+	if (!std::is_floating_point<Q>::value)
+	{
+		std::cout << "Skipped: the inter-frame and the naive SCL decoders only match in floating-point." << std::endl;
+		return EXIT_SUCCESS;
+	}
+
+	const std::vector<Params> params = {{256, 128, 8, 1.5f,  50},
+	                                    {256, 128, 4, 2.5f,  50},
+	                                    {128,  64, 8, 1.5f,  50},
+	                                    { 64,  40, 2, 1.5f, 100},
+	                                    { 64,  40, 2, 2.5f, 100}};
+
+	for (auto kind : {Kind::SCL, Kind::SCL_CA, Kind::ASCL_FULL, Kind::ASCL_PARTIAL})
+		for (auto &p : params)
+			run(kind, p);
+
+	return test::result();
+}
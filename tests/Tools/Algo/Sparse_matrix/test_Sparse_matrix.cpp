@@ -0,0 +1,210 @@
+#include <random>
+#include <vector>
+#include <string>
+#include <utility>
+#include <algorithm>
+#include <exception>
+
+#include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
+
+#include "test.hpp"
+
+using namespace aff3ct;
+
+/*
+ * Reference: the former representation of 'tools::Sparse_matrix' (one std::vector of indexes per row and per column,
+ * the connections in the insertion order)
+ */
+struct Sparse_matrix_ref
+{
+	unsigned n_rows, n_cols;
+	std::vector<std::vector<unsigned>> row_to_cols;
+	std::vector<std::vector<unsigned>> col_to_rows;
+
+	Sparse_matrix_ref(const unsigned n_rows, const unsigned n_cols)
+	: n_rows(n_rows), n_cols(n_cols), row_to_cols(n_rows), col_to_rows(n_cols) {}
+
+	bool add_connection(const unsigned row_index, const unsigned col_index)
+	{
+		auto &r = this->row_to_cols[row_index];
+		if (std::find(r.begin(), r.end(), col_index) != r.end())
+			return false;
+
+		this->row_to_cols[row_index].push_back(col_index);
+		this->col_to_rows[col_index].push_back(row_index);
+		return true;
+	}
+
+	unsigned max_degree(const std::vector<std::vector<unsigned>> &adj) const
+	{
+		unsigned d = 0;
+		for (auto &a : adj)
+			d = std::max(d, (unsigned)a.size());
+		return d;
+	}
+
+	void self_transpose()
+	{
+		std::swap(this->n_rows,      this->n_cols     );
+		std::swap(this->row_to_cols, this->col_to_rows);
+	}
+
+	void sort_cols_per_density(const std::string &order)
+	{
+		using V = std::vector<unsigned>;
+		if (order == "ASC")
+			std::sort(this->col_to_rows.begin(), this->col_to_rows.end(),
+			          [](const V &i1, const V &i2) { return i1.size() < i2.size(); });
+		else
+			std::sort(this->col_to_rows.begin(), this->col_to_rows.end(),
+			          [](const V &i1, const V &i2) { return i1.size() > i2.size(); });
+
+		for (auto &r : this->row_to_cols)
+			r.clear();
+		for (unsigned i = 0; i < (unsigned)this->col_to_rows.size(); i++)
+			for (auto r : this->col_to_rows[i])
+				this->row_to_cols[r].push_back(i);
+	}
+};
+
+static bool same_adjacency(const tools::Sparse_matrix::Adjacency &adj, const std::vector<std::vector<unsigned>> &ref)
+{
+	if (adj.size() != ref.size())
+		return false;
+
+	// iterate like the decoders do: range-based loops on the rows and on their indexes
+	size_t i = 0;
+	for (auto &a : adj)
+	{
+		if (a.size() != ref[i].size() || std::vector<unsigned>(a) != ref[i])
+			return false;
+
+		size_t j = 0;
+		for (auto v : a)
+			if (v != ref[i][j++])
+				return false;
+		i++;
+	}
+	return i == ref.size();
+}
+
+static void check_same(const tools::Sparse_matrix &H, const Sparse_matrix_ref &ref)
+{
+	TEST_CHECK(H.get_n_rows() == ref.n_rows);
+	TEST_CHECK(H.get_n_cols() == ref.n_cols);
+	TEST_CHECK(H.get_rows_max_degree() == ref.max_degree(ref.row_to_cols));
+	TEST_CHECK(H.get_cols_max_degree() == ref.max_degree(ref.col_to_rows));
+
+	unsigned n_connections = 0;
+	for (auto &r : ref.row_to_cols)
+		n_connections += (unsigned)r.size();
+	TEST_CHECK(H.get_n_connections() == n_connections);
+
+	TEST_CHECK(same_adjacency(H.get_row_to_cols(), ref.row_to_cols));
+	TEST_CHECK(same_adjacency(H.get_col_to_rows(), ref.col_to_rows));
+
+	bool same_rows = true, same_cols = true;
+	for (unsigned r = 0; r < ref.n_rows; r++)
+		same_rows &= std::vector<unsigned>(H.get_cols_from_row(r)) == ref.row_to_cols[r];
+	for (unsigned c = 0; c < ref.n_cols; c++)
+		same_cols &= std::vector<unsigned>(H.get_rows_from_col(c)) == ref.col_to_rows[c] &&
+		             std::vector<unsigned>(H[c]) == ref.col_to_rows[c];
+	TEST_CHECK(same_rows);
+	TEST_CHECK(same_cols);
+
+	bool same_at = true;
+	for (unsigned r = 0; r < ref.n_rows; r++)
+		for (unsigned c = 0; c < ref.n_cols; c++)
+			same_at &= H.at(r, c) == (std::find(ref.row_to_cols[r].begin(), ref.row_to_cols[r].end(), c) !=
+			                          ref.row_to_cols[r].end());
+	TEST_CHECK(same_at);
+}
+
+int main(int argc, char** argv)
+{
+	std::mt19937 gen(12);
+
+	const std::vector<std::pair<unsigned,unsigned>> dims = {{1, 1}, {7, 13}, {48, 96}, {97, 31}};
+	for (auto &d : dims)
+	{
+		const auto n_rows = d.first, n_cols = d.second;
+		tools::Sparse_matrix H(n_rows, n_cols);
+		Sparse_matrix_ref  ref(n_rows, n_cols);
+
+		check_same(H, ref);
+
+		// the reads between the additions merge the pending connections after the compressed ones
+		const unsigned n_additions = 3 * (n_rows + n_cols);
+		for (unsigned k = 0; k < n_additions; k++)
+		{
+			const auto r = (unsigned)(gen() % n_rows);
+			const auto c = (unsigned)(gen() % n_cols);
+
+			bool thrown = false;
+			try { H.add_connection(r, c); } catch (std::exception const&) { thrown = true; }
+			TEST_CHECK(thrown == !ref.add_connection(r, c));
+
+			if (k % (n_rows / 2 +1) == 0)
+				check_same(H, ref);
+		}
+		check_same(H, ref);
+
+		bool thrown = false;
+		try { H.add_connection(n_rows, 0); } catch (std::exception const&) { thrown = true; }
+		TEST_CHECK(thrown);
+		thrown = false;
+		try { H.add_connection(0, n_cols); } catch (std::exception const&) { thrown = true; }
+		TEST_CHECK(thrown);
+		check_same(H, ref);
+
+		// copies, moves and comparisons
+		tools::Sparse_matrix C(H);
+		TEST_CHECK(C == H);
+		check_same(C, ref);
+		tools::Sparse_matrix M(std::move(C));
+		TEST_CHECK(M == H);
+		check_same(M, ref);
+
+		// transposition (the pending connections are transposed too)
+		auto T = H.transpose();
+		auto ref_T = ref;
+		ref_T.self_transpose();
+		check_same(T, ref_T);
+		check_same(H, ref);
+
+		tools::Sparse_matrix P(n_rows, n_cols);
+		Sparse_matrix_ref ref_P(n_rows, n_cols);
+		for (unsigned k = 0; k < n_rows; k++)
+		{
+			const auto r = (unsigned)(gen() % n_rows), c = (unsigned)(gen() % n_cols);
+			if (ref_P.add_connection(r, c))
+				P.add_connection(r, c);
+		}
+		P.self_transpose();
+		ref_P.self_transpose();
+		check_same(P, ref_P);
+
+		// sort per density (same ties order as before)
+		for (auto order : {"DSC", "ASC"})
+		{
+			auto S = H;
+			auto ref_S = ref;
+			S.sort_cols_per_density(order);
+			ref_S.sort_cols_per_density(order);
+			check_same(S, ref_S);
+			TEST_CHECK(S != H || ref_S.col_to_rows == ref.col_to_rows);
+
+			// the connections added after a sort are still appended in the insertion order
+			const auto r = (unsigned)(gen() % n_rows), c = (unsigned)(gen() % n_cols);
+			if (ref_S.add_connection(r, c))
+				S.add_connection(r, c);
+			check_same(S, ref_S);
+		}
+
+		thrown = false;
+		try { H.sort_cols_per_density("MIX"); } catch (std::exception const&) { thrown = true; }
+		TEST_CHECK(thrown);
+	}
+
+	return test::result();
+}
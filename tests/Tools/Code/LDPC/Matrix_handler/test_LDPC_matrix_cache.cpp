@@ -0,0 +1,275 @@
+#ifdef _MSC_VER
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#endif
+
+#include <random>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+
+#include "Tools/Code/LDPC/Matrix_handler/LDPC_matrix_cache.hpp"
+
+#include "test.hpp"
+
+using namespace aff3ct;
+
+using Packed_matrix = tools::LDPC_matrix_handler::Packed_matrix;
+
+static const std::string dir = "test_LDPC_matrix_cache_dir";
+
+// a random H of 'M' check nodes: degree 3 information bits and a dual diagonal for the parity bits (H2 is invertible)
+static tools::Sparse_matrix make_H(const unsigned M, const unsigned seed)
+{
+	std::mt19937 gen(seed);
+	tools::Sparse_matrix H(M, 2 * M);
+	for (unsigned j = 0; j < M; j++)
+	{
+		std::vector<unsigned> rows;
+		while (rows.size() < 3)
+		{
+			const auto r = (unsigned)(gen() % M);
+			if (std::find(rows.begin(), rows.end(), r) == rows.end())
+			{
+				rows.push_back(r);
+				H.add_connection(r, j);
+			}
+		}
+	}
+	for (unsigned i = 0; i < M; i++)
+	{
+		H.add_connection(i, M + i);
+		if (i)
+			H.add_connection(i, M + i -1);
+	}
+	return H;
+}
+
+static std::string cache_filename(const tools::Sparse_matrix &H, const std::string &ext)
+{
+	std::stringstream filename;
+	filename << dir << "/" << std::hex << std::setw(16) << std::setfill('0') << tools::LDPC_matrix_cache::hash(H)
+	         << "." << ext;
+	return filename.str();
+}
+
+template <typename T>
+static void append(std::string &bytes, const T* data, const size_t n_elmts)
+{
+	bytes.append(reinterpret_cast<const char*>(data), n_elmts * sizeof(T));
+}
+
+template <typename T>
+static void overwrite(std::string &bytes, const size_t pos, const T value)
+{
+	std::memcpy(&bytes[pos], &value, sizeof(T));
+}
+
+static std::string header_bytes(const uint32_t kind, const uint64_t key, const uint32_t n_rows, const uint32_t n_cols)
+{
+	const uint32_t version = 1;
+
+	std::string bytes = "AFF3CTLC";
+	append(bytes, &version, 1);
+	append(bytes, &kind,    1);
+	append(bytes, &key,     1);
+	append(bytes, &n_rows,  1);
+	append(bytes, &n_cols,  1);
+	return bytes;
+}
+
+// the columns of each row of G are written in the given order
+static std::string G_bytes(const uint64_t key, const unsigned n_cols, const std::vector<std::vector<uint32_t>> &rows,
+                           const std::vector<unsigned> &info_bits_pos)
+{
+	std::vector<uint32_t> offsets(1, 0), indices;
+	for (auto &r : rows)
+	{
+		indices.insert(indices.end(), r.begin(), r.end());
+		offsets.push_back((uint32_t)indices.size());
+	}
+	const std::vector<uint32_t> info(info_bits_pos.begin(), info_bits_pos.end());
+	const auto n_connections = (uint32_t)indices.size(), n_info = (uint32_t)info.size();
+
+	auto bytes = header_bytes(0, key, (uint32_t)rows.size(), n_cols);
+	append(bytes, &n_connections, 1);
+	append(bytes, &n_info,        1);
+	append(bytes, offsets.data(), offsets.size());
+	append(bytes, indices.data(), indices.size());
+	append(bytes, info   .data(), info   .size());
+	return bytes;
+}
+
+static std::vector<std::vector<uint32_t>> rows_of(const tools::Sparse_matrix &G)
+{
+	std::vector<std::vector<uint32_t>> rows;
+	for (unsigned i = 0; i < G.get_n_rows(); i++)
+	{
+		const auto &cols = G.get_cols_from_row(i);
+		rows.push_back(std::vector<uint32_t>(cols.begin(), cols.end()));
+	}
+	return rows;
+}
+
+static std::string invH2_bytes(const uint64_t key, const Packed_matrix &invH2)
+{
+	const auto n_words = (uint32_t)(invH2.size() + 63) / 64;
+	auto bytes = header_bytes(1, key, (uint32_t)invH2.size(), n_words);
+	for (auto &row : invH2)
+		append(bytes, row.data(), row.size());
+	return bytes;
+}
+
+static std::string read_file(const std::string &filename)
+{
+	std::ifstream file(filename, std::ios::in | std::ios::binary);
+	return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+static void write_file(const std::string &filename, const std::string &bytes)
+{
+	std::ofstream file(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+	file.write(bytes.data(), bytes.size());
+}
+
+int main(int argc, char** argv)
+{
+#ifdef _MSC_VER
+	_mkdir(dir.c_str());
+#elif defined(_WIN32)
+	mkdir(dir.c_str());
+#else
+	mkdir(dir.c_str(), S_IRWXU | S_IRGRP | S_IXGRP | S_IROTH | S_IXOTH);
+#endif
+
+	const unsigned M = 64;
+	const auto H       = make_H(M, 1);
+	const auto H_other = make_H(M, 2);
+	const auto key     = tools::LDPC_matrix_cache::hash(H);
+	const auto G_file     = cache_filename(H, "G"    );
+	const auto invH2_file = cache_filename(H, "invH2");
+	std::remove(G_file    .c_str());
+	std::remove(invH2_file.c_str());
+
+	// the hash depends neither on the orientation of H nor on the order of its connections
+	tools::Sparse_matrix H_reordered(M, 2 * M);
+	for (unsigned i = M; i-- > 0;)
+	{
+		const auto &cols = H.get_cols_from_row(i);
+		for (auto c = cols.size(); c-- > 0;)
+			H_reordered.add_connection(i, cols[c]);
+	}
+	TEST_CHECK(H_reordered != H);
+	TEST_CHECK(tools::LDPC_matrix_cache::hash(H_reordered) == key);
+	TEST_CHECK(tools::LDPC_matrix_cache::hash(H.transpose()) == key);
+	TEST_CHECK(tools::LDPC_matrix_cache::hash(H_other) != key);
+
+	// the references, without cache
+	std::vector<unsigned> info_ref, info;
+	const auto G_ref     = tools::LDPC_matrix_handler::transform_H_to_G(H, info_ref);
+	const auto invH2_ref = tools::LDPC_matrix_handler::invert_H2(H);
+	const auto G_valid     = G_bytes(key, G_ref.get_n_cols(), rows_of(G_ref), info_ref);
+	const auto invH2_valid = invH2_bytes(key, invH2_ref);
+
+	// round trip: the matrices are written in the cache...
+	TEST_CHECK(tools::LDPC_matrix_cache::transform_H_to_G(H, info, dir) == G_ref && info == info_ref);
+	TEST_CHECK(tools::LDPC_matrix_cache::invert_H2(H, dir) == invH2_ref);
+	TEST_CHECK(read_file(G_file    ) == G_valid    );
+	TEST_CHECK(read_file(invH2_file) == invH2_valid);
+	TEST_CHECK(tools::LDPC_matrix_cache::transform_H_to_G(H, info, dir) == G_ref && info == info_ref);
+	TEST_CHECK(tools::LDPC_matrix_cache::invert_H2(H, dir) == invH2_ref);
+
+	// ... and read instead of being computed: a valid G of H with the columns of the rows in an other order and an
+	// arbitrary inv(H2) (not checked against H) are returned as they are
+	auto rows_reversed = rows_of(G_ref);
+	for (auto &r : rows_reversed)
+		std::reverse(r.begin(), r.end());
+	write_file(G_file, G_bytes(key, G_ref.get_n_cols(), rows_reversed, info_ref));
+	const auto G_read = tools::LDPC_matrix_cache::transform_H_to_G(H, info, dir);
+	TEST_CHECK(G_read != G_ref && rows_of(G_read) == rows_reversed && info == info_ref);
+
+	Packed_matrix invH2_zero(invH2_ref.size(), std::vector<uint64_t>(invH2_ref[0].size(), 0));
+	write_file(invH2_file, invH2_bytes(key, invH2_zero));
+	TEST_CHECK(tools::LDPC_matrix_cache::invert_H2(H, dir) == invH2_zero);
+
+	// a connection of G moved to an other column of the same row: the file is consistent but H.G^T != 0
+	unsigned r = 0;
+	while (std::find(info_ref.begin(), info_ref.end(), r) != info_ref.end() || G_ref.get_cols_from_row(r).empty())
+		r++;
+	auto rows_moved = rows_of(G_ref);
+	auto k = 0u;
+	while (std::find(rows_moved[r].begin(), rows_moved[r].end(), k) != rows_moved[r].end())
+		k++;
+	rows_moved[r][0] = k;
+	const auto G_moved = G_bytes(key, G_ref.get_n_cols(), rows_moved, info_ref);
+
+	// the G of an other H written under the name and the hash of H
+	std::vector<unsigned> info_other;
+	const auto G_other = tools::LDPC_matrix_handler::transform_H_to_G(H_other, info_other);
+	const auto G_mixed = G_bytes(key, G_other.get_n_cols(), rows_of(G_other), info_other);
+
+	// the corrupted or truncated files are rejected: the matrices are computed and the files are written again
+	const auto o_offsets = 32 + 8; // the offsets of the rows of G follow the header and the two sizes
+	const auto o_indices = o_offsets + 4 * (G_ref.get_n_rows() +1);
+	const auto o_info    = G_valid.size() - 4 * info_ref.size();
+	const std::vector<std::function<void(std::string&)>> G_corruptions =
+	{
+		[&](std::string &bytes) { bytes[5] = 'X';                                      }, // magic
+		[&](std::string &bytes) { overwrite<uint32_t>(bytes,  8, 2);                   }, // version
+		[&](std::string &bytes) { overwrite<uint32_t>(bytes, 12, 1);                   }, // kind
+		[&](std::string &bytes) { overwrite<uint64_t>(bytes, 16, 42);                  }, // hash
+		[&](std::string &bytes) { overwrite<uint32_t>(bytes, 24, 0xFFFFFFFF);          }, // n_rows
+		[&](std::string &bytes) { overwrite<uint32_t>(bytes, 32, 0xFFFFFFFF);          }, // n_connections
+		[&](std::string &bytes) { bytes.resize(28);                                    }, // truncated header
+		[&](std::string &bytes) { bytes.resize(bytes.size() - 4);                      }, // truncated arrays
+		[&](std::string &bytes) { bytes.append(4, '\0');                               }, // trailing bytes
+		[&](std::string &bytes) { overwrite<uint32_t>(bytes, o_offsets + 4, 0xFFFF);   }, // offsets
+		[&](std::string &bytes) { overwrite<uint32_t>(bytes, o_indices, 0xFFFF);       }, // column of G
+		[&](std::string &bytes) { overwrite<uint32_t>(bytes, o_info, 0xFFFF);          }, // info position
+		[&](std::string &bytes) { overwrite<uint32_t>(bytes, o_info, info_ref.back()); }, // same info position
+		[&](std::string &bytes) { bytes = G_moved;                                     }, // H.G^T != 0
+		[&](std::string &bytes) { bytes = G_mixed;                                     }, // G of an other H
+	};
+
+	for (auto &corrupt : G_corruptions)
+	{
+		auto bytes = G_valid;
+		corrupt(bytes);
+		write_file(G_file, bytes);
+
+		info.clear();
+		TEST_CHECK(tools::LDPC_matrix_cache::transform_H_to_G(H, info, dir) == G_ref && info == info_ref);
+		TEST_CHECK(read_file(G_file) == G_valid);
+	}
+
+	const std::vector<std::function<void(std::string&)>> invH2_corruptions =
+	{
+		[&](std::string &bytes) { overwrite<uint32_t>(bytes, 12, 0);          }, // kind
+		[&](std::string &bytes) { overwrite<uint32_t>(bytes, 24, 0xFFFFFFFF); }, // number of rows
+		[&](std::string &bytes) { overwrite<uint32_t>(bytes, 28, 2);          }, // number of words per row
+		[&](std::string &bytes) { bytes.resize(bytes.size() - 8);             }, // truncated rows
+		[&](std::string &bytes) { bytes.append(8, '\0');                      }, // trailing bytes
+		[&](std::string &bytes) { bytes = G_valid;                            }, // a G file
+	};
+
+	for (auto &corrupt : invH2_corruptions)
+	{
+		auto bytes = invH2_valid;
+		corrupt(bytes);
+		write_file(invH2_file, bytes);
+
+		TEST_CHECK(tools::LDPC_matrix_cache::invert_H2(H, dir) == invH2_ref);
+		TEST_CHECK(read_file(invH2_file) == invH2_valid);
+	}
+
+	return test::result();
+}
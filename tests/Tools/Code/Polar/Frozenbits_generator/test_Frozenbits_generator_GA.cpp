@@ -0,0 +1,158 @@
+#ifndef _USE_MATH_DEFINES
+#define _USE_MATH_DEFINES
+#endif
+
+#include <cmath>
+#include <tuple>
+#include <thread>
+#include <vector>
+#include <numeric>
+#include <iostream>
+#include <algorithm>
+
+#include "Tools/Code/Polar/Frozenbits_generator/Frozenbits_generator_GA.hpp"
+
+#include "test.hpp"
+
+using namespace aff3ct;
+
+/*
+ * Reference: the Gaussian approximation computed without table, channel by channel (the former implementation)
+ */
+static double phi(const double t)
+{
+	if (t < 0.867861)
+		return std::exp(0.0564 * t * t - 0.48560 * t);
+	else
+		return std::exp(-0.4527 * std::pow(t, 0.86) + 0.0218);
+}
+
+static double phi_inv(const double t)
+{
+	if (t > 0.6845772418)
+		return 4.304964539 * (1 - std::sqrt(1 + 0.9567131408 * std::log(t)));
+	else
+		return std::pow((1.0 / -0.4527) * std::log(t) + 0.0218 / 0.4527, 1.0 / 0.86);
+}
+
+static std::vector<double> reference_mean_LLRs(const int N, const float sigma)
+{
+	const auto m = (int)std::log2(N);
+	std::vector<double> z(N, 2.0 / std::pow((double)sigma, 2.0));
+
+	for (auto l = 1; l <= m; l++)
+	{
+		const auto o1 = 1 << (m - l +1);
+		const auto o2 = 1 << (m - l   );
+		for (auto t = 0; t < (1 << (l -1)); t++)
+		{
+			const auto T = z[t * o1];
+			z[t * o1] = phi_inv(1.0 - std::pow(1.0 - phi(T), 2.0));
+			if (z[t * o1] == HUGE_VAL)
+				z[t * o1] = T + M_LN2 / (-0.4527 * 0.86);
+			z[t * o1 + o2] = 2.0 * T;
+		}
+	}
+
+	return z;
+}
+
+static std::vector<bool> generate(const int K, const int N, const float sigma)
+{
+	tools::Frozenbits_generator_GA generator(K, N, sigma);
+	std::vector<bool> frozen_bits(N);
+	generator.generate(frozen_bits);
+	return frozen_bits;
+}
+
+static std::vector<int> info_bits(const std::vector<bool> &frozen_bits)
+{
+	std::vector<int> info;
+	for (auto i = 0; i < (int)frozen_bits.size(); i++)
+		if (!frozen_bits[i])
+			info.push_back(i);
+	return info;
+}
+
+int main(int argc, char** argv)
+{
+	// the information bits at reference (N, K, sigma) points
+	const std::vector<std::tuple<int,int,float,std::vector<int>>> refs =
+	{
+		std::make_tuple( 8,  4, 0.8f, std::vector<int>{3, 5, 6, 7}),
+		std::make_tuple(16,  8, 0.8f, std::vector<int>{7, 9, 10, 11, 12, 13, 14, 15}),
+		std::make_tuple(32, 16, 0.7f, std::vector<int>{11, 13, 14, 15, 19, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30,
+		                                               31}),
+		std::make_tuple(64, 32, 0.6f, std::vector<int>{15, 23, 26, 27, 28, 29, 30, 31, 38, 39, 41, 42, 43, 44, 45,
+		                                               46, 47, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61,
+		                                               62, 63}),
+	};
+	for (auto &r : refs)
+		TEST_CHECK(info_bits(generate(std::get<1>(r), std::get<0>(r), std::get<2>(r))) == std::get<3>(r));
+
+	// same frozen bits as the reference GA, the interpolation of the 'minus' transform can only swap a few channels of
+	// almost the same reliability at the boundary of the information set (the closer the shorter the code)
+	for (auto N : {16, 64, 256, 1024, 4096, 16384, 65536})
+		for (auto sigma : {0.3f, 0.5f, 0.7f, 0.9f, 1.1f, 1.5f, 2.5f})
+			for (auto K : {N / 8, N / 4, N / 2, 3 * N / 4})
+			{
+				const auto z = reference_mean_LLRs(N, sigma);
+				std::vector<int> best_channels(N);
+				std::iota(best_channels.begin(), best_channels.end(), 0);
+				std::stable_sort(best_channels.begin(), best_channels.end(),
+				                 [&z](const int i1, const int i2) { return z[i1] > z[i2]; });
+				std::vector<bool> ref(N, true);
+				for (auto i = 0; i < K; i++)
+					ref[best_channels[i]] = false;
+
+				const auto frozen_bits = generate(K, N, sigma);
+				TEST_CHECK(std::count(frozen_bits.begin(), frozen_bits.end(), true) == N - K);
+
+				const auto boundary = (z[best_channels[K -1]] + z[best_channels[K]]) / 2;
+				auto n_diff = 0;
+				auto max_gap = 0.0;
+				for (auto i = 0; i < N; i++)
+					if (frozen_bits[i] != ref[i])
+					{
+						n_diff++;
+						max_gap = std::max(max_gap, std::abs(z[i] - boundary) / boundary);
+					}
+
+				TEST_CHECK(n_diff <= std::max(2, N / 1000));
+				TEST_CHECK(max_gap < (N <= 4096 ? 1e-3 : 2e-2));
+			}
+
+	// the information sets of a given (N, sigma) are nested
+	for (auto sigma : {0.5f, 0.9f})
+	{
+		const auto N = 1024;
+		auto prev = info_bits(generate(1, N, sigma));
+		for (auto K = 2; K < N; K += 37)
+		{
+			const auto info = info_bits(generate(K, N, sigma));
+			TEST_CHECK(std::includes(info.begin(), info.end(), prev.begin(), prev.end()));
+			prev = info;
+		}
+	}
+
+	// the memoized best channels (same thread, other threads, after being forgotten) are the computed ones
+	const auto ref = generate(512, 2048, 0.65f);
+	TEST_CHECK(generate(512, 2048, 0.65f) == ref);
+
+	std::vector<std::vector<bool>> frozen_bits_thr(8);
+	std::vector<std::thread> threads;
+	for (auto t = 0; t < (int)frozen_bits_thr.size(); t++)
+		threads.push_back(std::thread([t, &frozen_bits_thr]() { frozen_bits_thr[t] = generate(512, 2048, 0.75f); }));
+	for (auto &t : threads)
+		t.join();
+	for (auto &fb : frozen_bits_thr)
+		TEST_CHECK(fb == frozen_bits_thr[0]);
+	TEST_CHECK(frozen_bits_thr[0] != ref);
+
+	for (auto i = 0; i < 64; i++)
+		generate(64, 128, 0.5f + i * 0.01f);
+	TEST_CHECK(generate(512, 2048, 0.65f) == ref);
+	TEST_CHECK(generate(512, 2048, 0.75f) == frozen_bits_thr[0]);
+
+	return test::result();
+}
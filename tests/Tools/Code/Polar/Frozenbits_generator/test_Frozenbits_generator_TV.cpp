@@ -0,0 +1,193 @@
+#ifdef _MSC_VER
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#endif
+
+#include <cmath>
+#include <tuple>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <numeric>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+
+#include "Tools/Code/Polar/Frozenbits_generator/Frozenbits_generator_TV.hpp"
+#include "Tools/Code/Polar/Frozenbits_generator/Frozenbits_generator_GA.hpp"
+
+#include "test.hpp"
+
+using namespace aff3ct;
+
+/*
+ * The generators of a same process share the best channels of a given (N, sigma): each case of the cache has its own
+ * sigma, else the cache would not be read again.
+ */
+struct Frozenbits_generator_TV_test : public tools::Frozenbits_generator_TV
+{
+	using tools::Frozenbits_generator_TV::Frozenbits_generator_TV;
+
+	// the construction alone (no cache)
+	std::vector<uint32_t> constructed()
+	{
+		this->construct();
+		return this->best_channels;
+	}
+};
+
+static const std::string dir = "test_Frozenbits_generator_TV_cache";
+
+static std::string cache_filename(const int N, const float sigma)
+{
+	std::ostringstream s_stream;
+	s_stream << std::setiosflags(std::ios::fixed) << std::setprecision(3) << sigma;
+	return dir + "/" + std::to_string((int)std::log2(N)) + "/N" + std::to_string(N) + "_awgn_s" + s_stream.str() +
+	       "_q100.tv";
+}
+
+static std::string cache_bytes(const int N, const float sigma, const std::vector<uint32_t> &best_channels)
+{
+	const uint32_t version = 1, n = (uint32_t)N, mu = 100;
+
+	std::string bytes = "AFF3CTTV";
+	bytes.append(reinterpret_cast<const char*>(&version), sizeof(version));
+	bytes.append(reinterpret_cast<const char*>(&n      ), sizeof(n      ));
+	bytes.append(reinterpret_cast<const char*>(&mu     ), sizeof(mu     ));
+	bytes.append(reinterpret_cast<const char*>(&sigma  ), sizeof(sigma  ));
+	bytes.append(reinterpret_cast<const char*>(best_channels.data()), best_channels.size() * sizeof(uint32_t));
+	return bytes;
+}
+
+static std::string read_file(const std::string &filename)
+{
+	std::ifstream file(filename, std::ios::in | std::ios::binary);
+	return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+static void write_file(const std::string &filename, const std::string &bytes)
+{
+	std::ofstream file(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+	file.write(bytes.data(), bytes.size());
+}
+
+template <typename T>
+static void overwrite(std::string &bytes, const size_t pos, const T value)
+{
+	std::memcpy(&bytes[pos], &value, sizeof(T));
+}
+
+int main(int argc, char** argv)
+{
+#ifdef _MSC_VER
+	_mkdir(dir.c_str());
+#elif defined(_WIN32)
+	mkdir(dir.c_str());
+#else
+	mkdir(dir.c_str(), S_IRWXU | S_IRGRP | S_IXGRP | S_IROTH | S_IXOTH);
+#endif
+
+	// the information bits at reference (N, K, sigma) points
+	const std::vector<std::tuple<int,int,float,std::vector<int>>> refs =
+	{
+		std::make_tuple( 8,  4, 0.8f, std::vector<int>{3, 5, 6, 7}),
+		std::make_tuple(16,  8, 0.8f, std::vector<int>{7, 9, 10, 11, 12, 13, 14, 15}),
+		std::make_tuple(32, 16, 0.7f, std::vector<int>{11, 13, 14, 15, 19, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30,
+		                                               31}),
+		std::make_tuple(64, 32, 0.6f, std::vector<int>{15, 23, 26, 27, 28, 29, 30, 31, 38, 39, 41, 42, 43, 44, 45,
+		                                               46, 47, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61,
+		                                               62, 63}),
+	};
+	for (auto &r : refs)
+	{
+		const auto K = std::get<1>(r), N = std::get<0>(r);
+		tools::Frozenbits_generator_TV generator(K, N, dir, std::get<2>(r));
+		std::vector<bool> frozen_bits(N);
+		generator.generate(frozen_bits);
+
+		std::vector<int> info;
+		for (auto i = 0; i < N; i++)
+			if (!frozen_bits[i])
+				info.push_back(i);
+		TEST_CHECK(info == std::get<3>(r));
+	}
+
+	// the Gaussian approximation only disagrees on a few channels at the boundary of the information set
+	for (auto N : {32, 64, 128, 256})
+		for (auto sigma : {0.5f, 0.7f, 1.0f, 1.5f})
+			for (auto K : {N / 4, N / 2, 3 * N / 4})
+			{
+				tools::Frozenbits_generator_TV generator_TV(K, N, dir, sigma);
+				tools::Frozenbits_generator_GA generator_GA(K, N, sigma);
+				std::vector<bool> frozen_bits_TV(N), frozen_bits_GA(N);
+				generator_TV.generate(frozen_bits_TV);
+				generator_GA.generate(frozen_bits_GA);
+
+				TEST_CHECK(std::count(frozen_bits_TV.begin(), frozen_bits_TV.end(), true) == N - K);
+
+				auto n_diff = 0;
+				for (auto i = 0; i < N; i++)
+					n_diff += frozen_bits_TV[i] != frozen_bits_GA[i];
+				TEST_CHECK(n_diff <= std::max(2, N / 32));
+			}
+
+	// the construction does not depend on the number of threads
+	TEST_CHECK(Frozenbits_generator_TV_test(128, 256, dir, 0.55f, 1).constructed() ==
+	           Frozenbits_generator_TV_test(128, 256, dir, 0.55f, 4).constructed());
+
+	// round trip: the constructed channels are written in the cache...
+	static const int N = 128, K = 64;
+	std::vector<bool> frozen_bits(N);
+	std::remove(cache_filename(N, 0.45f).c_str());
+	Frozenbits_generator_TV_test generator(K, N, dir, 0.45f);
+	generator.generate(frozen_bits);
+	const auto best_channels = generator.get_best_channels();
+	TEST_CHECK(best_channels == generator.constructed());
+	TEST_CHECK(read_file(cache_filename(N, 0.45f)) == cache_bytes(N, 0.45f, best_channels));
+
+	// ... and the cached channels are read instead of being constructed
+	std::vector<uint32_t> identity(N);
+	std::iota(identity.begin(), identity.end(), 0);
+	write_file(cache_filename(N, 0.46f), cache_bytes(N, 0.46f, identity));
+	Frozenbits_generator_TV_test generator_read(K, N, dir, 0.46f);
+	generator_read.generate(frozen_bits);
+	TEST_CHECK(generator_read.get_best_channels() == identity);
+	TEST_CHECK(generator_read.constructed() != identity);
+
+	// the corrupted or truncated files are rejected: the channels are constructed and the file is written again
+	const std::vector<std::function<void(std::string&)>> corruptions =
+	{
+		[](std::string &bytes) { bytes[3] = 'X';                                      }, // magic
+		[](std::string &bytes) { overwrite<uint32_t>(bytes,  8, 2);                   }, // version
+		[](std::string &bytes) { overwrite<uint32_t>(bytes, 12, N / 2);               }, // N
+		[](std::string &bytes) { overwrite<uint32_t>(bytes, 16, 50);                  }, // Mu
+		[](std::string &bytes) { overwrite<float   >(bytes, 20, 0.5f);                }, // sigma
+		[](std::string &bytes) { bytes.resize(20);                                    }, // truncated header
+		[](std::string &bytes) { bytes.resize(bytes.size() - sizeof(uint32_t));       }, // truncated channels
+		[](std::string &bytes) { overwrite<uint32_t>(bytes, 24 + 4 * 5, 7);           }, // duplicated channel
+		[](std::string &bytes) { overwrite<uint32_t>(bytes, 24 + 4 * 5, (uint32_t)N); }, // channel out of range
+	};
+
+	for (size_t c = 0; c < corruptions.size(); c++)
+	{
+		const auto sigma = 0.30f + 0.01f * (float)c;
+		auto bytes = cache_bytes(N, sigma, identity);
+		corruptions[c](bytes);
+		write_file(cache_filename(N, sigma), bytes);
+
+		Frozenbits_generator_TV_test generator_corrupted(K, N, dir, sigma);
+		generator_corrupted.generate(frozen_bits);
+		const auto channels = generator_corrupted.get_best_channels();
+		const auto expected = generator_corrupted.constructed();
+		TEST_CHECK(channels == expected);
+		TEST_CHECK(read_file(cache_filename(N, sigma)) == cache_bytes(N, sigma, expected));
+	}
+
+	return test::result();
+}
@@ -0,0 +1,42 @@
+#ifndef TEST_HPP_
+#define TEST_HPP_
+
+#include <cstdlib>
+#include <iostream>
+
+/*
+ * Minimal checks for the tests: a failed check is reported and counted, the tests return 'test::result()' so 'ctest'
+ * can tell the tests which pass from the others.
+ */
+namespace aff3ct
+{
+namespace test
+{
+inline unsigned& n_failures()
+{
+	static unsigned n = 0;
+	return n;
+}
+
+inline bool check(const bool cond, const char *expr, const char *file, const int line)
+{
+	if (!cond)
+	{
+		std::cerr << file << ":" << line << ": check failed: " << expr << std::endl;
+		n_failures()++;
+	}
+	return cond;
+}
+
+inline int result()
+{
+	if (n_failures())
+		std::cerr << n_failures() << " check(s) failed." << std::endl;
+	return n_failures() ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+}
+}
+
+#define TEST_CHECK(cond) aff3ct::test::check((cond), #cond, __FILE__, __LINE__)
+
+#endif /* TEST_HPP_ */